@@ -91,7 +91,6 @@ typedef enum
 #if(ALLOCATION_TYPE == EXTERNAL_ALLOCATION)
     LwXMLP_strXMLParseInstanceType objParserExternalInstanceType;
 #endif
-static INT8U u8ReceiveBuffer[MAX_TCP_RECEIVE_BUFFER];
 static StdReturnType APP_srParserEventHandler(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
 static StdReturnType APP_srParserEventHandler(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 {
@@ -252,7 +251,8 @@ void gpioButtonFxn(unsigned int index)
  */
 Void tcpWorker(UArg arg0, UArg arg1)
 {
-    INT32U u32FreeSpace;
+    INT8U  *pu8ReservedRegion;
+    INT32U u32ReservedLength;
     INT32S s32NumberOfReadyBytes = 0;
     INT32S s32SocketError;
     int  clientfd = (int)arg0;
@@ -267,7 +267,7 @@ Void tcpWorker(UArg arg0, UArg arg1)
     LwXMLP_enumParserStatusType objenumParserStatusType;
     StdReturnType srParserStatus = E_OK;
     enumParsingStatType objenumParsingStatType = csParseInit;
-    INT32U u32LastSecondsTime, u32PasreProcessStartTime, u32ActualAddedLength;
+    INT32U u32LastSecondsTime, u32PasreProcessStartTime;
 
     u32LastSecondsTime = SecondsClock_get(); /* startup delay */
     VERBOSE_printf("Init Parsing Procces");
@@ -304,29 +304,31 @@ Void tcpWorker(UArg arg0, UArg arg1)
                  }
                  break;
             case csParseReceiveData:
-                 u32FreeSpace = LwXMLP_u32GetFreeSpace(pstrParserInstanceType);
-                 if(u32FreeSpace > MAX_TCP_RECEIVE_BUFFER)
+                 /* receive directly in the free region of the parser buffer */
+                 pu8ReservedRegion = LwXMLP_pu8ReserveWrite(pstrParserInstanceType, &u32ReservedLength);
+                 s32NumberOfReadyBytes = 0;
+                 if(pu8ReservedRegion != STD_NULL)
                  {
-                     u32FreeSpace = MAX_TCP_RECEIVE_BUFFER;
+                     if(u32ReservedLength > MAX_TCP_RECEIVE_BUFFER)
+                     {
+                         u32ReservedLength = MAX_TCP_RECEIVE_BUFFER;
+                     }
+                     s32NumberOfReadyBytes = recv(clientfd, \
+                                                  pu8ReservedRegion, \
+                                                  u32ReservedLength, \
+                                                  0);
+                     if(s32NumberOfReadyBytes > 0)
+                     {
+                         LwXMLP_vCommitWrite(pstrParserInstanceType, (INT32U)s32NumberOfReadyBytes);
+                         u32LastSecondsTime = SecondsClock_get(); /* update the last receiption time */
+                     }
+                     else
+                     {
+                         /*
+                          * Nothing to do
+                          */
+                     }
                  }
-                 s32NumberOfReadyBytes = recv(clientfd, \
-                                              u8ReceiveBuffer, \
-                                              u32FreeSpace, \
-                                              0);
-                 if(s32NumberOfReadyBytes > 0)
-                 {
-                     u32ActualAddedLength = LwXMLP_u32AddXMLPortion(pstrParserInstanceType, (void *)u8ReceiveBuffer, s32NumberOfReadyBytes);
-                     if(u32ActualAddedLength > 0U)
-                      {
-                          u32LastSecondsTime = SecondsClock_get(); /* update the last receiption time */
-                      }
-                      else
-                      {
-                          /*
-                           * Nothing to do
-                           */
-                      }
-                   }
                  if((s32NumberOfReadyBytes < 0) && (s32NumberOfReadyBytes != SL_EAGAIN))
                  {
                      VERBOSE_printf("Connection Error: %d", s32SocketError);
@@ -56,7 +56,6 @@
 
 
 #define NUMTCPWORKERS 1 /* It should be greater than SOMAXCONN*/
-#define MAX_TCP_RECEIVE_BUFFER 1000
 #define TIME_OUT_ON_CLIENT         2   /* time out in seconds */
 
 INT32U u32counter;
@@ -82,7 +81,6 @@ typedef enum
 #if(ALLOCATION_TYPE == EXTERNAL_ALLOCATION)
     LwXMLP_strXMLParseInstanceType objParserExternalInstanceType;
 #endif
-static INT8U u8ReceiveBuffer[MAX_TCP_RECEIVE_BUFFER];
 static StdReturnType APP_srParserEventHandler(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
 static StdReturnType APP_srParserEventHandler(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 {
@@ -233,7 +231,8 @@ static StdReturnType APP_srParserEventHandler(LwXMLP_strXMLParseInstanceType *ps
  */
 Void tcpWorker(UArg arg0, UArg arg1)
 {
-    INT32U u32ActualAddedLength;
+    INT8U  *pu8ReservedRegion;
+    INT32U u32ReservedLength;
     INT32S s32NumberOfReadyBytes = 0;
     INT32S s32SocketError;
     int  clientfd = (int)arg0;
@@ -280,19 +279,18 @@ Void tcpWorker(UArg arg0, UArg arg1)
                  }
                  break;
             case csParseReceiveData:
-                 s32NumberOfReadyBytes = recv(clientfd, \
-                                              u8ReceiveBuffer, \
-                                              MAX_TCP_RECEIVE_BUFFER, \
-                                              MSG_PEEK| MSG_DONTWAIT);
-                 if(s32NumberOfReadyBytes > 0)
+                 /* receive directly in the free region of the parser buffer */
+                 pu8ReservedRegion = LwXMLP_pu8ReserveWrite(pstrParserInstanceType, &u32ReservedLength);
+                 s32NumberOfReadyBytes = 0;
+                 if(pu8ReservedRegion != STD_NULL)
                  {
-                     u32ActualAddedLength = LwXMLP_u32AddXMLPortion(pstrParserInstanceType, (void *)u8ReceiveBuffer, s32NumberOfReadyBytes);
-                     s32NumberOfReadyBytes = recv(clientfd,\
-                                                  u8ReceiveBuffer, \
-                                                  u32ActualAddedLength, \
-                                                  0);
-                     if(u32ActualAddedLength > 0U)
+                     s32NumberOfReadyBytes = recv(clientfd, \
+                                                  pu8ReservedRegion, \
+                                                  u32ReservedLength, \
+                                                  MSG_DONTWAIT);
+                     if(s32NumberOfReadyBytes > 0)
                      {
+                         LwXMLP_vCommitWrite(pstrParserInstanceType, (INT32U)s32NumberOfReadyBytes);
                          u32LastSecondsTime = SecondsClock_get(); /* update the last receiption time */
                      }
                      else
@@ -51,7 +51,9 @@
  *    serial communication, so on.
  *  - The code/data size can be customize to enable/disable some of the feature on the expense of the code/data size
  *    using some macro definitions.
- *  - Thread-safe (more precisely: reentrant).
+ *  - Thread-safe (more precisely: reentrant), the DTD tables and the DTD cache which are shared by the instances are
+ *    guarded by LwXMLP_mEnterDTDCriticalSection and LwXMLP_mExitDTDCriticalSection of LwXMLP_FCFG.h which shall
+ *    be mapped to a mutex if the instances run in different threads.
  *  - Support two models of memory allocation, static memory allocation and dynamic memory allocation.
  *  - The LWXML processor shall be able to detect the xml fetal errors which will cause the reporting for the error
  *    type and the XML line where the error is occurred then it will cause the termination for reading process.
@@ -78,6 +80,11 @@
  ==================================================================================================================
  */
 #include "LwXMLP_CORE.h"
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_ON)
+    #ifndef _GNU_SOURCE
+        #define _GNU_SOURCE /* memfd_create() is a GNU extension, it shall be defined before the system headers */
+    #endif
+#endif
 #ifndef  LwXMLP_ENCODING_H
     #include "LwXMLP_ENCODING.h"
 #endif
@@ -89,6 +96,19 @@
 #if(ALLOCATION_TYPE == INTERNAL_DYNAMIC_ALLOCATION)
     #include <stdlib.h>
 #endif
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_ON)
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+#if(ENABLE_FAST_TEXT_SCANNING == STD_ON)
+    #if defined(__AVX2__)
+        #include <immintrin.h>
+    #elif defined(__SSE2__)
+        #include <emmintrin.h>
+    #elif defined(__ARM_NEON)
+        #include <arm_neon.h>
+    #endif
+#endif
 
 /*
 ********************************************************************************************************************
@@ -165,6 +185,9 @@
     #define REFERENCE_VALIDATEION_ONLY           0x0020U  /*!< Validate the entity only without resolving*/
     #define DONT_DEREF_LT_GENERAL_ENTITY         0x0200U  /*!< Don't resolve less than general entity */
     #define DONT_DEREF_AS_GENERAL_ENTITY         0x0400U  /*!< Don't resolve ampersand general entity */
+    #define NORMALIZE_ATTRIBUTE_VALUE            0x0800U  /*!< Append the white space of the replacement texts as space and refuse their < */
+    #define VALIDATE_REPLACEMENT_TEXT            0x1000U  /*!< Check the replacement texts as the text of the document is checked */
+    #define PREDEFINED_ENTITIES_COUNT            5U       /*!< The number of the predefined entities lt, gt, amp, apos and quot */
 #endif
 /*
  * DTD portion mask enable feature
@@ -178,15 +201,68 @@
     #define SYSTEM_EXTERNAL_ROW             0x0010U        /*!< Option to enable parsing for SYSTEM external ID inside the DTD portion*/
     #define OPENING_BRACKET_PORTION         0x0020U        /*!< Option to enable parsing for Opening bracket content inside the DTD portion*/
 #endif
+/*
+ * Character classes of cu8CharacterClassTable
+ */
+#define CHARACTER_CLASS_CHAR               0x01U                  /*!< The ASCII character is W3C Char */
+#define CHARACTER_CLASS_NAME_START         0x02U                  /*!< The character is W3C NameStartChar */
+#define CHARACTER_CLASS_NAME               0x04U                  /*!< The character is W3C NameChar */
+#define CHARACTER_CLASS_WHITE_SPACE        0x08U                  /*!< The ASCII character is W3C white space */
+#define CHARACTER_CLASS_LENGTH_SHIFT       4U                     /*!< The shift of the UTF-8 sequence length */
+#if(SUPPORT_ASCII_ONLY == STD_OFF)
+    #define NAME_BLOCK_MIXED                   0x80U                  /*!< The name block isn't uniform and has bitmaps */
+    #define NAME_MIXED_BLOCKS                  8U                     /*!< Number of the not uniform name blocks */
+#endif
+#define ASCII_RUN_LENGTH                   16U                    /*!< The length of the ASCII run which is validated
+                                                                       at once */
+#define TAG_TOKENIZER_LOOKAHEAD            3U                     /*!< The number of loaded TAG bytes which the
+                                                                       tokenizer keeps behind the closer scanning, so
+                                                                       a UTF-8 character is never tokenized partially */
 /*
  * Miscellaneous
  */
 #define MAXIMUM_DIRECTIVE_LENTGH           11U                    /*!< The Maximum length of the Directive including the
                                                                        white space, so the XML shouldn't contain a
                                                                        directive with name larger than this*/
+#if(ENABLE_FAST_TEXT_SCANNING == STD_ON)
+    #define TEXT_SCAN_AMPERSAND_FOUND          0x01U                  /*!< The scanned text segment contains ampersand */
+    #define TEXT_SCAN_NON_WHITE_SPACE_FOUND    0x02U                  /*!< The scanned text segment contains non white
+                                                                           space character */
+    #define TEXT_SCAN_INVALID_CHARACTER_FOUND  0x04U                  /*!< The scanned text segment contains ASCII
+                                                                           character which isn't W3C Char */
+    #define TEXT_SCAN_VALIDATION_REQUIRED      0x08U                  /*!< The scanned text segment contains non ASCII
+                                                                           or closing bracket character, so it shall be
+                                                                           validated completely from its first one */
+    #if defined(__AVX2__)
+        #define TEXT_BLOCK_LENGTH                  32U                    /*!< The length of the text block */
+        #define TEXT_BLOCK_MASK_BITS               1U                     /*!< The bits of a byte in the block masks */
+    #elif defined(__SSE2__)
+        #define TEXT_BLOCK_LENGTH                  16U                    /*!< The length of the text block */
+        #define TEXT_BLOCK_MASK_BITS               1U                     /*!< The bits of a byte in the block masks */
+    #elif defined(__ARM_NEON)
+        #define TEXT_BLOCK_LENGTH                  16U                    /*!< The length of the text block */
+        #define TEXT_BLOCK_MASK_BITS               4U                     /*!< The bits of a byte in the block masks */
+    #else
+        #define TEXT_BLOCK_LENGTH                  4U                     /*!< The length of the text block */
+        #define TEXT_BLOCK_MASK_BITS               8U                     /*!< The bits of a byte in the block masks */
+    #endif
+#endif
+#define NAME_HASH_OFFSET_BASIS             2166136261U            /*!< The initial value of the FNV-1a name hash */
+#define NAME_HASH_PRIME                    16777619U              /*!< The multiplier of the FNV-1a name hash */
+#define SCAN_WORD_ONES                     0x01010101U            /*!< One in every byte of the scanning word */
+#define SCAN_WORD_LOW_BITS                 0x7F7F7F7FU            /*!< The lower 7 bits of every byte of the word */
+#if(ENABLE_DTD_CACHE == STD_ON)
+    #define DTD_CACHE_MAGIC_NUMBER             0x4C584443U            /*!< The first word of a serialized DTD cache */
+    #define DTD_CACHE_HEADER_WORDS             3U                     /*!< The number of words of the header of a
+                                                                           serialized DTD cache: the magic number, the
+                                                                           entry size and the entries count */
+#endif
+#define SCAN_WORD_HIGH_BITS                0x80808080U            /*!< The high bit of every byte of the word */
 #if(ENABLE_ENCODING == STD_ON)
     #define MAX_ENCODING_LENGTH                4U                     /*!< Max number of bytes per characters per any
                                                                             supported encoding type */
+    #define TRANSCODING_BLOCK_LENGTH           64U                    /*!< The output bytes per transcoding step of the
+                                                                            committed portions */
 #endif
 /*
 ********************************************************************************************************************
@@ -195,6 +271,19 @@
 ************************************************************************************************************************
 ********************************************************************************************************************
 */
+/*
+ * It returns a word which has the high bit set in every byte of u32Word that equal to u8Character, the lower 7 bits
+ * are added first so no carry can propagate between the bytes and then the result is exact per byte
+ */
+#define LwXMLP_mMatchWordBytes(u32Word, u8Character) \
+    (~(((((u32Word) ^ ((INT32U)(u8Character) * SCAN_WORD_ONES)) & SCAN_WORD_LOW_BITS) + \
+         SCAN_WORD_LOW_BITS) | ((u32Word) ^ ((INT32U)(u8Character) * SCAN_WORD_ONES))) & \
+     SCAN_WORD_HIGH_BITS)
+/*
+ * It returns the number of the bytes marked by LwXMLP_mMatchWordBytes in the word
+ */
+#define LwXMLP_mCountMatchedBytes(u32Mask) \
+    ((((u32Mask) >> 7U) * SCAN_WORD_ONES) >> 24U)
 /*
 ********************************************************************************************************************
 ************************************************************************************************************************
@@ -229,6 +318,16 @@
 #if(ALLOCATION_TYPE == INTERNAL_STATIC_ALLOCATION)
     static strStaticInstancesType objstrStaticInstancesArray[TOTAL_STATIC_XML_INSTANCES];
 #endif
+#if(ENABLE_DTD_CACHE == STD_ON)
+    static strDTDCacheType objstrDTDCacheType; /* shared by all the instances, it is accessed inside the DTD critical section */
+#endif
+#if(ENABLE_DTD_TABLES == STD_ON)
+    static strDTDTablesType objstrEmptyDTDTablesType; /* referred by the instances which have no declarations */
+    #if(ALLOCATION_TYPE != INTERNAL_DYNAMIC_ALLOCATION)
+    static strDTDTablesType objstrDTDTablesArray[MAX_DTD_TABLES]; /* the pool and the reference counts of the tables are
+                                                                     accessed inside the DTD critical section */
+    #endif
+#endif
 
 /*
 ********************************************************************************************************************
@@ -237,6 +336,131 @@
 ************************************************************************************************************************
 ********************************************************************************************************************
 */
+/*
+ * The class of every byte, the lower nibble holds the CHARACTER_CLASS_XXX flags of the ASCII characters and the upper
+ * nibble holds the length of the UTF-8 sequence started by the byte (zero for ASCII and continuation bytes), it is
+ * generated from the W3C Char, NameStartChar, NameChar and S productions
+ */
+static const INT8U cu8CharacterClassTable[256] =
+{
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x09U, 0x09U, 0x00U, 0x00U, 0x09U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x09U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U, 0x05U, 0x05U, 0x01U,
+    0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x05U, 0x07U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U,
+    0x01U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
+    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x01U, 0x01U, 0x01U, 0x01U, 0x07U,
+    0x01U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U,
+    0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x07U, 0x01U, 0x01U, 0x01U, 0x01U, 0x01U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U,
+    0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U, 0x20U,
+    0x30U, 0x30U, 0x30U, 0x30U, 0x30U, 0x30U, 0x30U, 0x30U, 0x30U, 0x30U, 0x30U, 0x30U, 0x30U, 0x30U, 0x30U, 0x30U,
+    0x40U, 0x40U, 0x40U, 0x40U, 0x40U, 0x40U, 0x40U, 0x40U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U
+};
+#if(SUPPORT_ASCII_ONLY == STD_OFF)
+/*
+ * The NameStartChar/NameChar class of every 256 code points block of the BMP, if the block isn't uniform the value is
+ * NAME_BLOCK_MIXED ORed with the index of its bitmaps in cu8NameStartBitmapTable and cu8NameBitmapTable
+ */
+static const INT8U cu8NameBlockTable[256] =
+{
+    0x80U, 0x06U, 0x06U, 0x81U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x82U, 0x83U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U, 0x06U, 0x06U, 0x84U,
+    0x85U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U,
+    0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x06U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x06U, 0x06U, 0x06U, 0x06U, 0x86U, 0x06U, 0x87U
+};
+/*
+ * One bit per code point for the mixed blocks, set if the code point is NameStartChar
+ */
+static const INT8U cu8NameStartBitmapTable[NAME_MIXED_BLOCKS][32] =
+{
+    {
+        0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+        0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xFFU, 0xFFU, 0x7FU, 0xFFU, 0xFFU, 0xFFU, 0x7FU, 0xFFU
+    },
+    {
+        0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xFFU, 0xBFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+    },
+    {
+        0x00U, 0x30U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+    },
+    {
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U
+    },
+    {
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0x00U
+    },
+    {
+        0xFEU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+    },
+    {
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0xFFU, 0xFFU
+    },
+    {
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x3FU
+    }
+};
+/*
+ * One bit per code point for the mixed blocks, set if the code point is NameChar
+ */
+static const INT8U cu8NameBitmapTable[NAME_MIXED_BLOCKS][32] =
+{
+    {
+        0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+        0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x00U, 0xFFU, 0xFFU, 0x7FU, 0xFFU, 0xFFU, 0xFFU, 0x7FU, 0xFFU
+    },
+    {
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xBFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+    },
+    {
+        0x00U, 0x30U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x80U, 0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+    },
+    {
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U
+    },
+    {
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0x00U
+    },
+    {
+        0xFEU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+    },
+    {
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0x00U, 0x00U, 0x00U, 0xFFU, 0xFFU
+    },
+    {
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+        0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x3FU
+    }
+};
+#endif
 
 
 
@@ -252,11 +476,47 @@ static BOOLEAN       LwXMLP_bXMLPathIsEmpty(LwXMLP_strXMLParseInstanceType const
 static BOOLEAN       LwXMLP_bIsWhiteSpace(INT8U const *pu8Character);
 static BOOLEAN       LwXMLP_bIsLessThanCharacter(INT8U const *pu8Character);
 static BOOLEAN       LwXMLP_bMoreCharacterAtEndOfXML(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
-static BOOLEAN       LwXMLP_bNewAttribute(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
-                                                 INT8U                          const *pu8NewAttributeString);
+static BOOLEAN       LwXMLP_bNewAttribute(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
+static INT32U        LwXMLP_u32HashBytes(INT32U u32Hash, INT8U const *pu8Bytes, INT32U u32Length);
+#if(ENABLE_NAME_INTERNING == STD_ON)
+static INT16S        LwXMLP_s16FindInternedName(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                INT8U                          const *pu8Name, \
+                                                INT32U                                u32NameHash, \
+                                                INT32U                               *pu32Slot);
+#endif
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+static INT16S        LwXMLP_s16FindEntity(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                          INT8U                          const *pu8EntityName, \
+                                          INT32U                                u32EntityNameLength, \
+                                          LwXMLP_enumReferenceTypeType          objenumReferenceTypeType, \
+                                          INT32U                               *pu32Slot);
+static BOOLEAN       LwXMLP_bStoreEntity(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                         INT8U                    const *pu8EntityName, \
+                                         INT8U                    const *pu8EntityValue);
+static void          LwXMLP_vCommitEntity(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, INT32U u32Slot);
+#endif
+#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
+static INT16S        LwXMLP_s16FindAttributeListElement(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                        INT8U                          const *pu8ElementName, \
+                                                        INT32U                                u32ElementNameHash, \
+                                                        INT32U                               *pu32Slot);
+static INT16S        LwXMLP_s16FindAttributeDeclaration(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                        INT16S                                s16ElementIndex, \
+                                                        INT8U                          const *pu8AttributeName, \
+                                                        INT32U                                u32AttributeNameLength, \
+                                                        INT32U                                u32AttributeNameHash);
+static void          LwXMLP_vCommitAttributeDeclaration(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                        INT8U                    const *pu8ElementName);
+static void          LwXMLP_vAddDefaultAttributes(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
+#endif
 static INT8U         LwXMLP_u8ValidCharacter(INT8U const *pu8Character);
 static INT8U         LwXMLP_u8ValidNameStartCharacter(INT8U const *pu8Character);
 static INT8U         LwXMLP_u8ValidNameCharacter(INT8U const *pu8Character);
+#if(SUPPORT_ASCII_ONLY == STD_OFF)
+    static INT8U     LwXMLP_u8DecodeUTF8(INT8U const *pu8Character, INT32U *pu32CodePoint);
+    static INT8U     LwXMLP_u8GetNameClass(INT32U u32CodePoint);
+#endif
+static BOOLEAN       LwXMLP_bIsPlainASCIIRun(INT8U const *pu8DataString);
 static INT8U        *LwXMLP_pu8GetCurrentCharacter(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
 static INT8U         LwXMLP_u8CheckBOM(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType,\
                                               const INT8U                          *pu8XMLPortion, \
@@ -267,18 +527,53 @@ static INT32U        LwXMLP_u32GetReadyData(LwXMLP_strXMLParseInstanceType const
 #if(ENABLE_ATTRIBUTE_Normalization == STD_ON)
     static void LwXMLP_vMoveStringBlockLeft(INT8U *pu8StringBlockAddress, INT32U u32MoveLength);
     static void          LwXMLP_vNormalizeAttributes(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
-#endif
-#if((ENABLE_ENTITY_SUPPORT == STD_ON) && (ENABLE_ATTRIBUTE_Normalization == STD_ON))
-    static LwXMLP_enumErrorType LwXMLP_enumValidateAttributeValue(INT8U const *pu8AttributeValue);
+    static void          LwXMLP_vReplaceAttributeWhiteSpace(INT8U  *pu8AttributeValue, \
+                                                            INT32U  u32AttributeLength);
+    static INT32U        LwXMLP_u32NormalizeAttributeValue(INT8U                *pu8AttributeValue, \
+                                                           INT32U                u32AttributeLength, \
+                                                           enumAttibuteTypeType  objenumAttibuteTypeType);
 #endif
 static void          LwXMLP_vConsumeCharacter(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
 static void          LwXMLP_vConsumeCharacterBulk(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
                                                          INT32U                        u32AdvancedLength);
+static void          LwXMLP_vUpdateLineAndColumn(INT32U       *pu32LineNumber, \
+                                                 INT32U       *pu32CoulmnNumber, \
+                                                 INT8U  const *pu8Segment, \
+                                                 INT32U        u32SegmentLength);
+static void          LwXMLP_vWriteCircularBuffer(LwXMLP_strXMLParseInstanceType       *pstrParserInstanceType, \
+                                                 INT8U                          const *pu8Data, \
+                                                 INT32U                                u32DataLength);
+#if(ENABLE_IN_PLACE_TOKENIZATION == STD_ON)
+static void          LwXMLP_vRelocateTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, INT32U u32TagLength);
+static INT8U        *LwXMLP_pu8RelocateTagPointer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                  INT8U                          *pu8Pointer, \
+                                                  INT32U                          u32TagLength);
+#endif
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_ON)
+static StdReturnType LwXMLP_srMapCircularBuffer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
+static void          LwXMLP_vUnmapCircularBuffer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
+#endif
+static StdReturnType LwXMLP_srCheckPortionEncoding(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                   const INT8U                          *pu8XMLPortionBuffer, \
+                                                         INT32U                          u32PortionSize, \
+                                                         INT8U                          *pu8BOMLength);
+#if(ENABLE_ENCODING == STD_ON)
+    static StdReturnType LwXMLP_srTranscodeStagedInput(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
+    static INT32U        LwXMLP_u32GetCompleteStagedLength(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+#endif
 static void LwXMLP_vCheckDeclerationEncoding(LwXMLP_strXMLParseInstanceType       *pstrParserInstanceType, \
                                              INT8U                          const *pu8MLPortionBuffer,\
                                              INT32U                                 u32PortionLengthLength);
 static void          LwXMLP_vCopy(INT8U *pu8Destination, INT8U const *pu8Source, INT32U u32Length);
 static void          LwXMLP_vCheckavailableData(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
+#if(ENABLE_FAST_TEXT_SCANNING == STD_ON)
+    static INT32U        LwXMLP_u32ScanTextBlock(INT8U             const *pu8Block, \
+                                                 INT32U                   u32WriteOffset, \
+                                                 strTextLoaderType       *pstrTextLoaderType);
+    static INT32U        LwXMLP_u32LoadTextSegment(INT8U       const *pu8Segment, \
+                                                   INT32U             u32SegmentLength, \
+                                                   strTextLoaderType *pstrTextLoaderType);
+#endif
 static void          LwXMLP_vCheckTagForDirective(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
 static void          LwXMLP_vUpdatePathWithStartTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
 static void          LwXMLP_vRemoveTagfromPath(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
@@ -286,21 +581,78 @@ static void          LwXMLP_vLoadDirectiveToBuffer(LwXMLP_strXMLParseInstanceTyp
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
     static LwXMLP_enumErrorType LwXMLP_enumUpdateEntityReference(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
                                                                         INT8U                          *pu8BufferString,\
-                                                                        INT32U                          u32MaxBlockLength,\
+                                                                        INT32U                         *pu32StringLength,\
+                                                                        INT32U                          u32BlockLength,\
+                                                                        INT32U                          u32BufferSize,\
                                                                         INT32U                          u32UpdateOptionMask);
-    static BOOLEAN LwXMLP_bValideEntity(INT8U* pu8Entity);
+    static LwXMLP_enumErrorType LwXMLP_enumExpandReferences(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                            strReferenceExpansionType      *pstrReferenceExpansionType, \
+                                                            INT32U                          u32UpdateOptionMask);
+    static void          LwXMLP_vWriteExpansion(strReferenceExpansionType       *pstrReferenceExpansionType, \
+                                                INT8U                     const *pu8Bytes, \
+                                                INT32U                           u32BytesLength, \
+                                                INT8U                     const *pu8InputCursor, \
+                                                INT8U                            u8SourceDepth);
+    static INT8U         LwXMLP_u8FindPredefinedEntity(INT8S const * const *ps8PredefinedEntityName, \
+                                                       INT8U         const *pu8EntityName, \
+                                                       INT32U               u32EntityNameLength);
+    static void          LwXMLP_vRecordFoundReference(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                      LwXMLP_enumReferenceTypeType    objenumReferenceTypeType, \
+                                                      INT16U                          u16EntityIndex);
+    static BOOLEAN LwXMLP_bValideEntity(INT8U const *pu8Entity);
     static INT8U         LwXMLP_u8ConvertCodePointToUTF8(INT32U u32CodePoint, INT8U *pu8UTF8Code);
-    static void          LwXMLP_vMoveBlockRight(INT8U  *pu8StringBlockAddress, \
-                                                       INT32U  u32MoveLength, \
-                                                       INT32U  u32BlockLength);
-    static void          LwXMLP_vMoveBlockLeft(INT8U* pu8StringBlockAddress, \
-                                                      INT32U u32MoveLength, \
-                                                      INT32U u32BlockLength);
-    static void LwXMLP_vSwitchToSecondLevelBuffer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, INT8U const *pu8PortionBuffer, INT32U u32PortionLength);
+    static INT16S        LwXMLP_s16FindMarkupReference(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                       INT8U                    const *pu8Text, \
+                                                       INT32U                         *pu32ReferenceOffset, \
+                                                       INT32U                         *pu32ReferenceNumber);
+    static INT32U        LwXMLP_u32GetReferenceEnd(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                   INT32U                                u32ReferenceNumber);
+    static void          LwXMLP_vPushInputSource(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                 INT16S                          s16EntityIndex, \
+                                                 BOOLEAN                         bSilentMode, \
+                                                 BOOLEAN                         bValueIsReplayed);
+    static void          LwXMLP_vPopInputSource(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
+    static BOOLEAN       LwXMLP_bChargeExpansion(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                 INT32U                          u32ExpansionLength, \
+                                                 INT32U                         *pu32ProbedLength);
+#endif
+#if(ENABLE_DTD_CACHE == STD_ON)
+    static BOOLEAN       LwXMLP_bScanDTDCacheKey(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
+    static void          LwXMLP_vAttachDTDCacheEntry(LwXMLP_strXMLParseInstanceType       *pstrParserInstanceType, \
+                                                     strDTDCacheEntryType           const *pstrDTDCacheEntryType);
+    static void          LwXMLP_vStoreDTDCacheEntry(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+    static void          LwXMLP_vFreeDTDCacheEntry(strDTDCacheEntryType *pstrDTDCacheEntryType);
+    static void          LwXMLP_vSerializeBytes(INT8U       *pu8Buffer, \
+                                                INT32U       u32BufferSize, \
+                                                INT32U      *pu32SerializedLength, \
+                                                void  const *pvBytes, \
+                                                INT32U       u32BytesLength);
+    static BOOLEAN       LwXMLP_bDeserializeBytes(INT8U const *pu8Buffer, \
+                                                  INT32U       u32BufferLength, \
+                                                  INT32U      *pu32ReadLength, \
+                                                  void        *pvBytes, \
+                                                  INT32U       u32BytesLength);
+    static void          LwXMLP_vSerializeDTDCacheEntry(strDTDCacheEntryType const *pstrDTDCacheEntryType, \
+                                                        INT8U                      *pu8Buffer, \
+                                                        INT32U                      u32BufferSize, \
+                                                        INT32U                     *pu32SerializedLength);
+    static BOOLEAN       LwXMLP_bDeserializeDTDCacheEntry(strDTDCacheEntryType       *pstrDTDCacheEntryType, \
+                                                          INT8U                const *pu8Buffer, \
+                                                          INT32U                      u32BufferLength, \
+                                                          INT32U                     *pu32ReadLength);
+    static BOOLEAN       LwXMLP_bCheckDTDTables(strDTDTablesType const *pstrDTDTablesType);
+#endif
+#if(ENABLE_DTD_TABLES == STD_ON)
+    static void          LwXMLP_vResetDTDTables(strDTDTablesType *pstrDTDTablesType);
+    static strDTDTablesType *LwXMLP_pstrAllocateDTDTables(void);
+    static void          LwXMLP_vReleaseDTDTables(strDTDTablesType *pstrDTDTablesType);
+    static BOOLEAN       LwXMLP_bOwnDTDTables(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
 #endif
 static void LwXMLP_vLoadTagToBuffer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
 static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
+static void LwXMLP_vTokenizeTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, INT32U u32TokenLimit);
 static void LwXMLP_vCheckTagCloserAndType(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
+static void LwXMLP_vConsumeTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
 static StdReturnType LwXMLP_srInitParserObject(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType,\
                                                       LwXLMP_psrFuncCallBackType      objpsrFuncCallBackType);
 static void LwXMLP_vCheckWellFormedDecl(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
@@ -314,8 +666,12 @@ static void LwXMLP_vCheckWellFormedDecl(LwXMLP_strXMLParseInstanceType *pstrPars
     static void LwXMLP_vCheckWellFormedCDATA(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
 #endif
 static BOOLEAN LwXMLP_bReachEndOfDirective(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
+static void LwXMLP_vResetDirectiveScanner(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
+static void LwXMLP_vResetTagScanner(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
+static INT8U const *LwXMLP_pu8GetReadyCharacter(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                INT32U                                u32Offset);
 #if(ENABLE_EOL_NORMALIZATION == STD_ON)
-    static void LwXMLP_vNormalizeEndOfLine(INT8U *pu8StringBuffer);
+    static INT32U LwXMLP_u32NormalizeEndOfLine(INT8U *pu8StringBuffer, INT32U u32StringLength);
 #endif
 
 #if(ENABLE_DTD_RECEIPTION == STD_ON)
@@ -369,14 +725,24 @@ static BOOLEAN LwXMLP_bReachEndOfDirective(LwXMLP_strXMLParseInstanceType *pstrP
 @return        The free amount in the circular buffer or
 @return        0: if pstrParserInstanceType is passed as STD_NULL incorrectly.
 
-@note
+@note          0 is returned while an entity value is under parsing
 
 ***********************************************************************************************************************/
 INT32U LwXMLP_u32GetFreeSpace(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
 {
     INT32U u32FreeSpace;
 
-    if(pstrParserInstanceType != STD_NULL)
+    if(pstrParserInstanceType == STD_NULL)
+    {
+        u32FreeSpace = 0U;
+    }
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+    else if(pstrParserInstanceType->u8InputSourceDepth > 0U)
+    {/* an entity value is under parsing, the free locations belong to it */
+        u32FreeSpace = 0U;
+    }
+#endif
+    else
     {
 #if(ENABLE_ENCODING == STD_ON)
         u32FreeSpace = pstrParserInstanceType->u32FreeLocations/MAX_ENCODING_LENGTH;
@@ -384,10 +750,6 @@ INT32U LwXMLP_u32GetFreeSpace(LwXMLP_strXMLParseInstanceType const *pstrParserIn
         u32FreeSpace = pstrParserInstanceType->u32FreeLocations;
 #endif
     }
-    else
-    {
-        u32FreeSpace = 0U;
-    }
 
     return u32FreeSpace;
 }
@@ -421,68 +783,33 @@ INT32U LwXMLP_u32AddXMLPortion(      LwXMLP_strXMLParseInstanceType *pstrParserI
           INT8U         u8BOMLength = 0;
     const INT8U        *pu8NewXMLPortionBuffer = pu8XMLPortionBuffer;
           INT32U        u32ActualAddedLength;
-          INT32U        u32ByteIndex;
           StdReturnType srStatus = E_OK;
     pstrParserInstanceType->u32NewLength = u32RequiredAddPortionSize;
-    /* no addition shall be made if the second level parsing is being used */
+    /* no addition shall be made while an entity value is parsed instead of the circular buffer */
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
-    if(pstrParserInstanceType->bSecondLevelBufferEnabled == STD_FALSE)
+    if(pstrParserInstanceType->u8InputSourceDepth == 0U)
     {
 #endif
         if(pstrParserInstanceType->bBOMIsChecked == STD_FALSE)
         {
-            pstrParserInstanceType->bBOMIsChecked = STD_TRUE;
-            u8BOMLength                           = LwXMLP_u8CheckBOM(pstrParserInstanceType, \
-                                                                      pu8XMLPortionBuffer, \
-                                                                      u32RequiredAddPortionSize);
-            pu8NewXMLPortionBuffer                = &pu8XMLPortionBuffer[u8BOMLength];
-            pstrParserInstanceType->u32NewLength  = u32RequiredAddPortionSize - u8BOMLength;
-            /*
-             * If no BOM is available, we will allow adding to XML deceleration
-             * only to be parsed to detect the encoding scheme
-             */
-            if((u8BOMLength == 0U) && (pu8XMLPortionBuffer[1] == QUESTION_MARK_ASCII_CHARACTER))
+            srStatus               = LwXMLP_srCheckPortionEncoding(pstrParserInstanceType, \
+                                                                   pu8XMLPortionBuffer, \
+                                                                   u32RequiredAddPortionSize, \
+                                                                   &u8BOMLength);
+            pu8NewXMLPortionBuffer = &pu8XMLPortionBuffer[u8BOMLength];
+        }
+        else
+        {
+            pu8NewXMLPortionBuffer = pu8XMLPortionBuffer;
+        }
+    #if(ENABLE_ENCODING == STD_ON)
+        if((srStatus == E_OK) && (pu8NewXMLPortionBuffer != STD_NULL) && \
+           ((pstrParserInstanceType->objenumEncodingTypeType == csEncoding_UTF8) || \
+            (pstrParserInstanceType->objenumEncodingTypeType == csEncoding_NONE)))
+        {/* UTF-8 needs no transcoding, so it is written to the circular buffer without the encoding buffer */
+            if(pstrParserInstanceType->u32FreeLocations < pstrParserInstanceType->u32NewLength)
             {
-            /*
-             * Look for end of deceleration inside the buffer
-             */
-               for(u32ByteIndex = 0U; u32ByteIndex < u32RequiredAddPortionSize; ++u32ByteIndex)
-               {
-                   if(pu8XMLPortionBuffer[u32ByteIndex] == GREATER_THAN_ASCII_CHARACTER)
-                   {
-                       LwXMLP_vCheckDeclerationEncoding(pstrParserInstanceType, pu8XMLPortionBuffer, u32ByteIndex + 1U);
-                       if(pstrParserInstanceType->objenumErrorType == csNoError)
-                       {
-                           /*
-                            * Nothing to do
-                            */
-                       }
-                       else
-                       {
-                           srStatus = E_NOT_OK;
-                       }
-                       break;
-                   }
-                   else
-                   {
-                       /*
-                        * Nothing to do
-                        */
-                   }
-               }
-               if(pstrParserInstanceType->objenumEncodingTypeType == csEncoding_NONE)
-               {
-                   /*
-                    * Wait till receive complete deceleration
-                    */
-                   pstrParserInstanceType->u32NewLength = 0U;
-               }
-               else
-               {
-                   /*
-                    * Nothing to do
-                    */
-               }
+                pstrParserInstanceType->u32NewLength = pstrParserInstanceType->u32FreeLocations;
             }
             else
             {
@@ -490,13 +817,9 @@ INT32U LwXMLP_u32AddXMLPortion(      LwXMLP_strXMLParseInstanceType *pstrParserI
                  * Nothing to do
                  */
             }
+            u32ActualAddedLength = u8BOMLength + pstrParserInstanceType->u32NewLength;
         }
-        else
-        {
-            pu8NewXMLPortionBuffer = pu8XMLPortionBuffer;
-        }
-    #if(ENABLE_ENCODING == STD_ON)
-        if(srStatus == E_OK)
+        else if(srStatus == E_OK)
         {
             /* it isn't allowed to have encoded length larger than the free amount of circular buffer */
             pstrParserInstanceType->u32Length = pstrParserInstanceType->u32FreeLocations;
@@ -532,29 +855,11 @@ INT32U LwXMLP_u32AddXMLPortion(      LwXMLP_strXMLParseInstanceType *pstrParserI
     #endif
         if(srStatus == E_OK)
         {
-            if(pstrParserInstanceType->u32NewLength > 0U)
-            {
-                for(u32ByteIndex = 0; u32ByteIndex < pstrParserInstanceType->u32NewLength; u32ByteIndex++)
-                {
-                    if(pstrParserInstanceType->pu8CircularBufferHead == pstrParserInstanceType->pu8CircularBufferEnd)
-                    {
-                        pstrParserInstanceType->pu8CircularBufferHead = pstrParserInstanceType->u8XMLCircularBuffer;
-                    }
-                    else
-                    {
-                        /* nothing to do here */
-                    }
-                    *pstrParserInstanceType->pu8CircularBufferHead = pu8NewXMLPortionBuffer[u32ByteIndex];
-                    pstrParserInstanceType->pu8CircularBufferHead++;
-                }
-            }
-            else
-            {
-                /*
-                 * Nothing to do
-                 */
-            }
+            LwXMLP_vWriteCircularBuffer(pstrParserInstanceType, pu8NewXMLPortionBuffer, pstrParserInstanceType->u32NewLength);
             pstrParserInstanceType->u32FreeLocations -= pstrParserInstanceType->u32NewLength;
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+            pstrParserInstanceType->u32ReceivedBytes += pstrParserInstanceType->u32NewLength;
+#endif
         }
         else
         {
@@ -570,229 +875,668 @@ INT32U LwXMLP_u32AddXMLPortion(      LwXMLP_strXMLParseInstanceType *pstrParserI
 
     return u32ActualAddedLength;
 }
-#if((ALLOCATION_TYPE == INTERNAL_STATIC_ALLOCATION) || (ALLOCATION_TYPE == INTERNAL_DYNAMIC_ALLOCATION))
 /**********************************************************************************************************************/
-/*!\fn         StdReturnType LwXMLP_srInitParserInternal(LwXMLP_strXMLParseInstanceType  **pstrParserInstanceType,\
-                                                         LwXLMP_psrFuncCallBackType        objpsrFuncCallBackType)
-
-@brief         It is responsible to allocate parser instance either statically or dynamically depending on ALLOCATION_TYPE
-               macro definition and if the allocation is succeeded the instants  members will be initialized with
-               the needed initial value beside the user callback function in objpsrFuncCallBackType
+/*!\fn         INT8U *LwXMLP_pu8ReserveWrite(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                             INT32U                         *pu32ReservedLength)
 
-@param[out]    pstrParserInstanceType    : address of the pointer to the XML instance that will be created
+@brief         It is responsible to return a contiguous free region of the parser memory, so the application can
+               receive the next XML portion (e.g. by recv or read) directly in it and then pass its length to
+               LwXMLP_vCommitWrite instead of copying it by LwXMLP_u32AddXMLPortion
 
-@param[in]     objpsrFuncCallBackType    : pointer to the application call back which should be fired up on
-                                           encountering a XML syntax construction like start TAG, end TAG, Data, so on.
+@param[in,out] pstrParserInstanceType    : pointer to the XML instance
+@param[out]    pu32ReservedLength        : it is loaded with the length of the returned region
 
-@return        E_OK    : if the allocation/initialization process done successfully
-@return        E_NOT_OK: if the allocation/initialization process failed or the one of the passing parameters is STD_NULL
+@return        pointer to the region or,
+@return        STD_NULL: if there is no free region now, an error is detected or an invalid parameter is passed
 
-@note          the number of internal instances are configured by the user, it the upper layer wants to run multiple
-               parsers instances at the same time, and the maximum number of the multiple instances shall be configured
-               using the macro TOTAL_STATIC_XML_INSTANCES
+@note          The region is at the head of the circular buffer for UTF-8 documents, so the free locations are
+               returned as at most two regions per wrap, one till the end of the circular buffer and one from its
+               start. The region is in the encoding buffer if the document shall be transcoded, and the staged bytes
+               which weren't transcoded by the last commit are transcoded first. The region is valid till the next
+               commit, and LwXMLP_u32AddXMLPortion shall not be invoked between the reservation and the commit
 ***********************************************************************************************************************/
-StdReturnType LwXMLP_srInitParserInternal(LwXMLP_strXMLParseInstanceType  **pstrParserInstanceType,\
-                                          LwXLMP_psrFuncCallBackType        objpsrFuncCallBackType)
+INT8U *LwXMLP_pu8ReserveWrite(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                              INT32U                         *pu32ReservedLength)
 {
-    StdReturnType srInitParserStatus = E_OK;
+    INT8U  *pu8ReservedRegion = STD_NULL;
+    INT32U  u32ReservedLength = 0U;
 
-    if((pstrParserInstanceType != STD_NULL) && (objpsrFuncCallBackType != STD_NULL))
+    if((pstrParserInstanceType != STD_NULL) && (pu32ReservedLength != STD_NULL))
     {
-    #if(ALLOCATION_TYPE == INTERNAL_STATIC_ALLOCATION)
-        *pstrParserInstanceType = LwXMLP_pstrGetStaticInstance();
-    #else
-       *pstrParserInstanceType = (LwXMLP_strXMLParseInstanceType *)calloc(1, sizeof(LwXMLP_strXMLParseInstanceType));
-    #endif
-        if(*pstrParserInstanceType != STD_NULL)
+        if(pstrParserInstanceType->objenumErrorType != csNoError)
         {
-            srInitParserStatus = LwXMLP_srInitParserObject(*pstrParserInstanceType, objpsrFuncCallBackType);
+            /*
+             * Nothing to do
+             */
+        }
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+        else if(pstrParserInstanceType->u8InputSourceDepth > 0U)
+        {/* no addition shall be made while an entity value is parsed instead of the circular buffer */
+        }
+#endif
+#if(ENABLE_ENCODING == STD_ON)
+        else if((pstrParserInstanceType->bBOMIsChecked == STD_TRUE) && \
+                (pstrParserInstanceType->objenumEncodingTypeType != csEncoding_UTF8) && \
+                (pstrParserInstanceType->objenumEncodingTypeType != csEncoding_NONE))
+        {
+            if(LwXMLP_srTranscodeStagedInput(pstrParserInstanceType) == E_OK)
+            {
+                u32ReservedLength = pstrParserInstanceType->u32FreeLocations/MAX_ENCODING_LENGTH;
+                if(u32ReservedLength > pstrParserInstanceType->u32StagedInputLength)
+                {
+                    u32ReservedLength -= pstrParserInstanceType->u32StagedInputLength;
+                }
+                else
+                {
+                    u32ReservedLength = 0U;
+                }
+                pu8ReservedRegion = &pstrParserInstanceType->u8XMLEncodingBuffer[pstrParserInstanceType->u32StagedInputLength];
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
         }
+#endif
         else
         {
-            srInitParserStatus = E_NOT_OK;
-            LwXMLP_mVerbose(VERBOSE_LEVEL_SERIOUS|VERBOSE_MESSAGE_ON, "Can't allocate the parser instance");
+            if(pstrParserInstanceType->pu8CircularBufferHead == pstrParserInstanceType->pu8CircularBufferEnd)
+            {
+                pstrParserInstanceType->pu8CircularBufferHead = pstrParserInstanceType->pu8CircularBufferStart;
+            }
+            else
+            {
+                /* nothing to do here */
+            }
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_ON)
+            /* the second view of the circular buffer follows the first one, so all the free locations are contiguous */
+            u32ReservedLength = pstrParserInstanceType->u32FreeLocations;
+#else
+            u32ReservedLength = (INT32U)(pstrParserInstanceType->pu8CircularBufferEnd - \
+                                         pstrParserInstanceType->pu8CircularBufferHead);
+#endif
+#if(ENABLE_ENCODING == STD_ON)
+            if((pstrParserInstanceType->bBOMIsChecked == STD_FALSE) && \
+               (u32ReservedLength > (pstrParserInstanceType->u32FreeLocations/MAX_ENCODING_LENGTH)))
+            {/* the first portion may need to be transcoded */
+                u32ReservedLength = pstrParserInstanceType->u32FreeLocations/MAX_ENCODING_LENGTH;
+            }
+            else
+#endif
+            if(u32ReservedLength > pstrParserInstanceType->u32FreeLocations)
+            {
+                u32ReservedLength = pstrParserInstanceType->u32FreeLocations;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+            pu8ReservedRegion = pstrParserInstanceType->pu8CircularBufferHead;
         }
+        if(u32ReservedLength == 0U)
+        {
+            pu8ReservedRegion = STD_NULL;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+        pstrParserInstanceType->u32ReservedLength = u32ReservedLength;
+        *pu32ReservedLength                       = u32ReservedLength;
     }
     else
     {
-        srInitParserStatus = E_NOT_OK;
-    }
-
-    return srInitParserStatus;
-}
-#elif(ALLOCATION_TYPE == EXTERNAL_ALLOCATION)
-StdReturnType  LwXMLP_srInitParserExternal(LwXMLP_strXMLParseInstanceType  *pstrParserInstanceType,\
-                                           LwXLMP_psrFuncCallBackType       objpsrFuncCallBackType)
-{
-    StdReturnType srInitParserStatus = E_OK;
-
-    if((pstrParserInstanceType != STD_NULL) && (objpsrFuncCallBackType != STD_NULL))
-    {
-        srInitParserStatus = LwXMLP_srInitParserObject(pstrParserInstanceType, objpsrFuncCallBackType);
-    }
-    else
-    {
-        srInitParserStatus = E_NOT_OK;
+        /*
+         * Nothing to do
+         */
     }
 
-    return srInitParserStatus;
+    return pu8ReservedRegion;
 }
-#endif
 /**********************************************************************************************************************/
-/*!\fn         StdReturnType  LwXMLP_srInitParserExternal(LwXMLP_strXMLParseInstanceType  *pstrParserInstanceType,\
-                                                          LwXLMP_psrFuncCallBackType       objpsrFuncCallBackType)
+/*!\fn         void LwXMLP_vCommitWrite(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                        INT32U                          u32WrittenLength)
 
+@brief         It is responsible to add the bytes which are written by the application to the region of the last
+               LwXMLP_pu8ReserveWrite to the parser, the BOM and the XML declaration of the first portion are checked
+               and the portion is transcoded as LwXMLP_u32AddXMLPortion does
 
-@brief         It is responsible to initialize the parser instances members. it should receive the new instance
-               that had been allocated by the user externally
-
-@param[out]    pstrParserInstanceType    : address of the pointer to the XML instance to be init
+@param[in,out] pstrParserInstanceType    : pointer to the XML instance
+@param[in]     u32WrittenLength          : the number of the written bytes, it is limited to the reserved length
 
-@param[in]     objpsrFuncCallBackType    : pointer to the application call back which should be fired up on
-                                           encountering a XML syntax construction like start TAG, end TAG, Data, so on.
-
-@return        E_OK    : if the initialization process done successfully
-@return        E_NOT_OK: if the initialization process failed or the one of the passing parameters is STD_NULL
+@return        None
 
-@note          The instance of pstrParserInstanceType shall be allocated by the upper layer which invoke
-               LwXMLP_srInitParserExternal
+@note          All the written bytes are taken by the parser, the bytes of an incomplete character are kept to be
+               transcoded with the next portion, and the encoding error is reported by LwXMLP_enumGetError
 ***********************************************************************************************************************/
-/**********************************************************************************************************************/
-/*!\fn         StdReturnType LwXMLP_srCloseParser(LwXMLP_strXMLParseInstanceType  *pstrParserInstanceType)
-
-@brief         It is responsible to release/deallocate the parser instance, such that the behavior of the
-               API depends on the parser instance allocation type as the following:
-               Internal static allocation : mark the internal static buffer as a free instance
-               Internal dynamic allocation: Invoke free
-               External allocation        : Nothing
-
-@param[in]     pstrParserInstanceType    : the pointer to the XML instance that will be released/deallocated
-
-@return         E_OK    : if the parser instance release/deallocate done successfully
-@return         E_NOT_OK: if the parser instance release/deallocate failed
-
-@note
-***********************************************************************************************************************/
-StdReturnType LwXMLP_srCloseParser(LwXMLP_strXMLParseInstanceType  *pstrParserInstanceType)
-{
-    StdReturnType srCloseStatus;
+void LwXMLP_vCommitWrite(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                         INT32U                          u32WrittenLength)
+{
+    INT8U  u8BOMLength = 0U;
+    INT32U u32CommittedLength;
 
     if(pstrParserInstanceType != STD_NULL)
     {
-#if(ALLOCATION_TYPE == INTERNAL_STATIC_ALLOCATION)
-        srCloseStatus = LwXMLP_srReleaseStaticInstance(pstrParserInstanceType);
-#elif (ALLOCATION_TYPE == INTERNAL_DYNAMIC_ALLOCATION)
-        free((void*)pstrParserInstanceType);
-        srCloseStatus = E_OK;
-#else
-        pstrParserInstanceType->bReachXMLEnd = STD_TRUE;
-        srCloseStatus = E_OK;
+        u32CommittedLength = pstrParserInstanceType->u32ReservedLength;
+        if(u32CommittedLength > u32WrittenLength)
+        {
+            u32CommittedLength = u32WrittenLength;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+        pstrParserInstanceType->u32ReservedLength = 0U;
+        if(u32CommittedLength == 0U)
+        {
+            /*
+             * Nothing to do
+             */
+        }
+#if(ENABLE_ENCODING == STD_ON)
+        else if((pstrParserInstanceType->bBOMIsChecked == STD_TRUE) && \
+                (pstrParserInstanceType->objenumEncodingTypeType != csEncoding_UTF8) && \
+                (pstrParserInstanceType->objenumEncodingTypeType != csEncoding_NONE))
+        {
+            pstrParserInstanceType->u32StagedInputLength += u32CommittedLength;
+            (void)LwXMLP_srTranscodeStagedInput(pstrParserInstanceType);
+        }
+#endif
+        else
+        {
+            if(pstrParserInstanceType->bBOMIsChecked == STD_FALSE)
+            {/* the first portion is at the start of the region, the BOM is removed from it */
+                if(LwXMLP_srCheckPortionEncoding(pstrParserInstanceType, pstrParserInstanceType->pu8CircularBufferHead, \
+                                                 u32CommittedLength, &u8BOMLength) == E_OK)
+                {
+                    u32CommittedLength -= u8BOMLength;
+                    (void)memmove(pstrParserInstanceType->pu8CircularBufferHead, \
+                                  &pstrParserInstanceType->pu8CircularBufferHead[u8BOMLength], \
+                                  u32CommittedLength);
+                }
+                else
+                {
+                    u32CommittedLength = 0U;
+                }
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+#if(ENABLE_ENCODING == STD_ON)
+            if((pstrParserInstanceType->objenumEncodingTypeType != csEncoding_UTF8) && \
+               (pstrParserInstanceType->objenumEncodingTypeType != csEncoding_NONE))
+            {/* the first portion shall be transcoded */
+                (void)memcpy(pstrParserInstanceType->u8XMLEncodingBuffer, pstrParserInstanceType->pu8CircularBufferHead, \
+                             u32CommittedLength);
+                pstrParserInstanceType->u32StagedInputLength = u32CommittedLength;
+                u32CommittedLength                           = 0U;
+                (void)LwXMLP_srTranscodeStagedInput(pstrParserInstanceType);
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+#endif
+            pstrParserInstanceType->pu8CircularBufferHead  = &pstrParserInstanceType->pu8CircularBufferHead[u32CommittedLength];
+            pstrParserInstanceType->u32FreeLocations      -= u32CommittedLength;
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_ON)
+            if(pstrParserInstanceType->pu8CircularBufferHead > pstrParserInstanceType->pu8CircularBufferEnd)
+            {/* the portion is written through the second view, continue from the first one */
+                pstrParserInstanceType->pu8CircularBufferHead -= MAX_CIRCULAR_BUFFER_SIZE;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+#endif
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+            pstrParserInstanceType->u32ReceivedBytes      += u32CommittedLength;
 #endif
+        }
     }
     else
     {
-        srCloseStatus = E_NOT_OK;
+        /*
+         * Nothing to do
+         */
     }
-
-    return srCloseStatus;
 }
 /**********************************************************************************************************************/
-/*!\fn         LwXMLP_enumXMLEventTypes LwXMLP_enumGetXMLEventType(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
-
-@brief         It is responsible to return the fired event type for the given parser instance pstrParserInstanceType
-
-@param[in]     pstrParserInstanceType    : the pointer to the XML instance
-
-@return        the event types which may be one of the following:
-               - csUnkownEvent, Event isn't known
-               - csStartElementEvent, Event that should be fired up on detecting start element
-               - csEndElementEvent, Event that should be fired up on detecting End element
-               - csProcessInstructionEvent, Event that should be fired up on detecting Processing Instruction
-               - csTextNodeEvent, Event that should be fired up on detecting text node
-               - csCommentEvent, Event that should be fired up on detecting comment
-               - csCDataEvent,  Event that should be fired up on detecting CData
-               - csNotationEvent, Event that should be fired up on detection Notation
-
-@note
+/*!\fn         INT32U LwXMLP_u32AddXMLPortionV(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                               const LwXMLP_strXMLSegmentType       *pstrXMLSegmentType, \
+                                                     INT32U                          u32SegmentCount, \
+                                                     INT32U                         *pu32AcceptedLength)
+
+@brief         It is responsible to add an XML portion which is split in a list of segments (e.g. a chain of network
+               buffers) to the parser by one call without gathering the segments in a staging buffer
+
+@param[in,out] pstrParserInstanceType    : pointer to the XML instance
+@param[in]     pstrXMLSegmentType        : the list of the segments in the order of the document
+@param[in]     u32SegmentCount           : the number of the segments in the list
+@param[out]    pu32AcceptedLength        : array of u32SegmentCount entries which is loaded with the number of the
+                                           accepted bytes of every segment, or STD_NULL if it isn't needed
+
+@return        The number of the accepted bytes of all the segments or,
+@return        0xFFFFFFFF: if the portion can't be decoded, the error is reported by LwXMLP_enumGetError
+
+@note          The segments are copied to the regions of LwXMLP_pu8ReserveWrite, so a region is filled from as many
+               segments as it can hold. Hence the BOM, the XML declaration, the UTF-8 sequences and the UTF-16
+               characters (including the surrogate pairs) may be split at any segment boundary. The accepted bytes of
+               a segment are its leading bytes, the application shall add the rest of the segment and the next
+               segments later. The bytes of an incomplete UTF-16 character at the end of the portion aren't accepted,
+               so they shall be added again with the rest of the character
 ***********************************************************************************************************************/
-LwXMLP_enumXMLEventTypes LwXMLP_enumGetXMLEventType(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+INT32U LwXMLP_u32AddXMLPortionV(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                const LwXMLP_strXMLSegmentType       *pstrXMLSegmentType, \
+                                      INT32U                          u32SegmentCount, \
+                                      INT32U                         *pu32AcceptedLength)
 {
-    LwXMLP_enumXMLEventTypes objenumXMLEventTypes;
+    INT8U  *pu8ReservedRegion = STD_NULL;
+    INT32U  u32ReservedLength = 0U, u32WrittenLength, u32CopiedLength;
+    INT32U  u32SegmentIndex   = 0U, u32SegmentOffset = 0U;
+    INT32U  u32AddedLength    = 0U;
+#if(ENABLE_ENCODING == STD_ON)
+    INT32U  u32HeldLength;
+#endif
 
-    if(pstrParserInstanceType != STD_NULL)
+    if((pstrParserInstanceType != STD_NULL) && (pstrXMLSegmentType != STD_NULL))
     {
-        objenumXMLEventTypes = pstrParserInstanceType->objenumXMLEventTypes;
+        for(u32SegmentIndex = 0U; (pu32AcceptedLength != STD_NULL) && (u32SegmentIndex < u32SegmentCount); u32SegmentIndex++)
+        {
+            pu32AcceptedLength[u32SegmentIndex] = 0U;
+        }
+        u32SegmentIndex = 0U;
+        while(u32SegmentIndex < u32SegmentCount)
+        {
+            if(u32SegmentOffset == pstrXMLSegmentType[u32SegmentIndex].u32SegmentLength)
+            {/* the segment is completely accepted or empty */
+                u32SegmentIndex++;
+                u32SegmentOffset = 0U;
+            }
+            else
+            {
+                pu8ReservedRegion = LwXMLP_pu8ReserveWrite(pstrParserInstanceType, &u32ReservedLength);
+                if(pu8ReservedRegion == STD_NULL)
+                {/* no free region, the rest of the segments shall be added later */
+                    u32SegmentIndex = u32SegmentCount;
+                }
+                else
+                {
+                    /* fill the region from the successive segments */
+                    u32WrittenLength = 0U;
+                    while((u32WrittenLength < u32ReservedLength) && (u32SegmentIndex < u32SegmentCount))
+                    {
+                        u32CopiedLength = pstrXMLSegmentType[u32SegmentIndex].u32SegmentLength - u32SegmentOffset;
+                        if(u32CopiedLength > (u32ReservedLength - u32WrittenLength))
+                        {
+                            u32CopiedLength = u32ReservedLength - u32WrittenLength;
+                        }
+                        else
+                        {
+                            /*
+                             * Nothing to do
+                             */
+                        }
+                        (void)memcpy(&pu8ReservedRegion[u32WrittenLength], \
+                                     &pstrXMLSegmentType[u32SegmentIndex].pu8Segment[u32SegmentOffset], \
+                                     u32CopiedLength);
+                        u32WrittenLength += u32CopiedLength;
+                        u32SegmentOffset += u32CopiedLength;
+                        if(pu32AcceptedLength != STD_NULL)
+                        {
+                            pu32AcceptedLength[u32SegmentIndex] += u32CopiedLength;
+                        }
+                        else
+                        {
+                            /*
+                             * Nothing to do
+                             */
+                        }
+                        if(u32SegmentOffset == pstrXMLSegmentType[u32SegmentIndex].u32SegmentLength)
+                        {
+                            u32SegmentIndex++;
+                            u32SegmentOffset = 0U;
+                        }
+                        else
+                        {
+                            /*
+                             * Nothing to do
+                             */
+                        }
+                    }
+                    LwXMLP_vCommitWrite(pstrParserInstanceType, u32WrittenLength);
+                    u32AddedLength += u32WrittenLength;
+                }
+            }
+        }
+        if(pstrParserInstanceType->objenumErrorType == csEncodingError)
+        {
+            u32AddedLength = 0xFFFFFFFFU;
+        }
+#if(ENABLE_ENCODING == STD_ON)
+        else if(pstrParserInstanceType->u32StagedInputLength > 0U)
+        {/* the bytes of the incomplete character at the end aren't accepted, they are taken back from the staging */
+            u32HeldLength = pstrParserInstanceType->u32StagedInputLength - \
+                            LwXMLP_u32GetCompleteStagedLength(pstrParserInstanceType);
+            if(u32HeldLength > u32AddedLength)
+            {/* the rest of the character was staged by a previous call */
+                u32HeldLength = u32AddedLength;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+            pstrParserInstanceType->u32StagedInputLength -= u32HeldLength;
+            u32AddedLength                               -= u32HeldLength;
+            for(u32SegmentIndex = u32SegmentCount; \
+                (pu32AcceptedLength != STD_NULL) && (u32HeldLength > 0U) && (u32SegmentIndex > 0U); \
+                u32SegmentIndex--)
+            {
+                u32CopiedLength = pu32AcceptedLength[u32SegmentIndex - 1U];
+                if(u32CopiedLength > u32HeldLength)
+                {
+                    u32CopiedLength = u32HeldLength;
+                }
+                else
+                {
+                    /*
+                     * Nothing to do
+                     */
+                }
+                pu32AcceptedLength[u32SegmentIndex - 1U] -= u32CopiedLength;
+                u32HeldLength                            -= u32CopiedLength;
+            }
+        }
+#endif
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
     }
     else
     {
-        objenumXMLEventTypes = csUnkownEvent;
+        /*
+         * Nothing to do
+         */
     }
 
-    return objenumXMLEventTypes;
-
+    return u32AddedLength;
 }
+#if((ALLOCATION_TYPE == INTERNAL_STATIC_ALLOCATION) || (ALLOCATION_TYPE == INTERNAL_DYNAMIC_ALLOCATION))
 /**********************************************************************************************************************/
-/*!\fn         INT8U *LwXMLP_pu8GetParsedText(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+/*!\fn         StdReturnType LwXMLP_srInitParserInternal(LwXMLP_strXMLParseInstanceType  **pstrParserInstanceType,\
+                                                         LwXLMP_psrFuncCallBackType        objpsrFuncCallBackType)
 
-@brief         It is responsible to return the current parsed text string
+@brief         It is responsible to allocate parser instance either statically or dynamically depending on ALLOCATION_TYPE
+               macro definition and if the allocation is succeeded the instants  members will be initialized with
+               the needed initial value beside the user callback function in objpsrFuncCallBackType
 
-@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+@param[out]    pstrParserInstanceType    : address of the pointer to the XML instance that will be created
 
-@return        pointer to parsed text node string
-@return        STD_NULL: if pstrParserInstanceType is passed as STD_NULL incorrectly.
+@param[in]     objpsrFuncCallBackType    : pointer to the application call back which should be fired up on
+                                           encountering a XML syntax construction like start TAG, end TAG, Data, so on.
 
-@note          this API shall be invoked from the upper layer when a csCDataEvent is fired, if it invoked in any other
-               time, the returned value should be meaningless
+@return        E_OK    : if the allocation/initialization process done successfully
+@return        E_NOT_OK: if the allocation/initialization process failed or the one of the passing parameters is STD_NULL
+
+@note          the number of internal instances are configured by the user, it the upper layer wants to run multiple
+               parsers instances at the same time, and the maximum number of the multiple instances shall be configured
+               using the macro TOTAL_STATIC_XML_INSTANCES
 ***********************************************************************************************************************/
-INT8U *LwXMLP_pu8GetParsedText(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+StdReturnType LwXMLP_srInitParserInternal(LwXMLP_strXMLParseInstanceType  **pstrParserInstanceType,\
+                                          LwXLMP_psrFuncCallBackType        objpsrFuncCallBackType)
 {
-    INT8U *pu8ParsedDataBuffer;
+    StdReturnType srInitParserStatus = E_OK;
 
-    if(pstrParserInstanceType != STD_NULL)
+    if((pstrParserInstanceType != STD_NULL) && (objpsrFuncCallBackType != STD_NULL))
     {
-        pu8ParsedDataBuffer = pstrParserInstanceType->pu8ParsedDataBuffer;
+    #if(ALLOCATION_TYPE == INTERNAL_STATIC_ALLOCATION)
+        *pstrParserInstanceType = LwXMLP_pstrGetStaticInstance();
+    #else
+       *pstrParserInstanceType = (LwXMLP_strXMLParseInstanceType *)calloc(1, sizeof(LwXMLP_strXMLParseInstanceType));
+    #endif
+        if(*pstrParserInstanceType != STD_NULL)
+        {
+            srInitParserStatus = LwXMLP_srInitParserObject(*pstrParserInstanceType, objpsrFuncCallBackType);
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_ON)
+            if(srInitParserStatus == E_NOT_OK)
+            {/* the circular buffer can't be mapped, so the instance is given back */
+                (void)LwXMLP_srCloseParser(*pstrParserInstanceType);
+                *pstrParserInstanceType = STD_NULL;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+#endif
+        }
+        else
+        {
+            srInitParserStatus = E_NOT_OK;
+            LwXMLP_mVerbose(VERBOSE_LEVEL_SERIOUS|VERBOSE_MESSAGE_ON, "Can't allocate the parser instance");
+        }
     }
     else
     {
-        pu8ParsedDataBuffer = STD_NULL;
+        srInitParserStatus = E_NOT_OK;
     }
 
-    return pu8ParsedDataBuffer;
+    return srInitParserStatus;
 }
-/**********************************************************************************************************************/
-/*!\fn         INT8U *LwXMLP_pu8GetParsedNotation(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
-
-@brief         This API is responsible to return the current parsed notation string
-
-@param[in]     pstrParserInstanceType    : the pointer to the XML instance
-
-@return        pointer to parsed text node string
-@return        STD_NULL: if pstrParserInstanceType is passed as STD_NULL incorrectly.
-
-@note          this API shall be invoked from the upper layer when a csNotationEvent is fired, if it invoked in any
-               other time, the returned value should be meaningless
-***********************************************************************************************************************/
-INT8U *LwXMLP_pu8GetParsedNotation(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+#elif(ALLOCATION_TYPE == EXTERNAL_ALLOCATION)
+StdReturnType  LwXMLP_srInitParserExternal(LwXMLP_strXMLParseInstanceType  *pstrParserInstanceType,\
+                                           LwXLMP_psrFuncCallBackType       objpsrFuncCallBackType)
 {
-    INT8U *pu8ParsedNotaion;
+    StdReturnType srInitParserStatus = E_OK;
 
-    if(pstrParserInstanceType != STD_NULL)
+    if((pstrParserInstanceType != STD_NULL) && (objpsrFuncCallBackType != STD_NULL))
     {
-        pu8ParsedNotaion = pstrParserInstanceType->pu8ParsedNotaion;
+        srInitParserStatus = LwXMLP_srInitParserObject(pstrParserInstanceType, objpsrFuncCallBackType);
     }
     else
     {
-        pu8ParsedNotaion = STD_NULL;
+        srInitParserStatus = E_NOT_OK;
     }
 
-    return pu8ParsedNotaion;
+    return srInitParserStatus;
 }
+#endif
 /**********************************************************************************************************************/
-/*!\fn         INT8U *LwXMLP_pu8GetElementName(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
-
-@brief         This API is responsible to return the current Element name string
+/*!\fn         StdReturnType  LwXMLP_srInitParserExternal(LwXMLP_strXMLParseInstanceType  *pstrParserInstanceType,\
+                                                          LwXLMP_psrFuncCallBackType       objpsrFuncCallBackType)
 
-@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@brief         It is responsible to initialize the parser instances members. it should receive the new instance
+               that had been allocated by the user externally
+
+@param[out]    pstrParserInstanceType    : address of the pointer to the XML instance to be init
+
+@param[in]     objpsrFuncCallBackType    : pointer to the application call back which should be fired up on
+                                           encountering a XML syntax construction like start TAG, end TAG, Data, so on.
+
+@return        E_OK    : if the initialization process done successfully
+@return        E_NOT_OK: if the initialization process failed or the one of the passing parameters is STD_NULL
+
+@note          The instance of pstrParserInstanceType shall be allocated by the upper layer which invoke
+               LwXMLP_srInitParserExternal
+***********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*!\fn         StdReturnType LwXMLP_srCloseParser(LwXMLP_strXMLParseInstanceType  *pstrParserInstanceType)
+
+@brief         It is responsible to release/deallocate the parser instance, such that the behavior of the
+               API depends on the parser instance allocation type as the following:
+               Internal static allocation : mark the internal static buffer as a free instance
+               Internal dynamic allocation: Invoke free
+               External allocation        : Nothing
+               The DTD tables which are referred by the instance and the mappings of the virtual ring buffer are
+               released for all the allocation types
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance that will be released/deallocated
+
+@return         E_OK    : if the parser instance release/deallocate done successfully
+@return         E_NOT_OK: if the parser instance release/deallocate failed
+
+@note          Every initialized instance shall be closed, otherwise its DTD tables aren't returned to the pool
+***********************************************************************************************************************/
+StdReturnType LwXMLP_srCloseParser(LwXMLP_strXMLParseInstanceType  *pstrParserInstanceType)
+{
+    StdReturnType srCloseStatus;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+#if(ENABLE_DTD_TABLES == STD_ON)
+        if(pstrParserInstanceType->pstrDTDTablesType != STD_NULL)
+        {
+            LwXMLP_mEnterDTDCriticalSection();
+            LwXMLP_vReleaseDTDTables(pstrParserInstanceType->pstrDTDTablesType);
+            LwXMLP_mExitDTDCriticalSection();
+            pstrParserInstanceType->pstrDTDTablesType = STD_NULL;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+#endif
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_ON)
+        LwXMLP_vUnmapCircularBuffer(pstrParserInstanceType);
+#endif
+#if(ALLOCATION_TYPE == INTERNAL_STATIC_ALLOCATION)
+        srCloseStatus = LwXMLP_srReleaseStaticInstance(pstrParserInstanceType);
+#elif (ALLOCATION_TYPE == INTERNAL_DYNAMIC_ALLOCATION)
+        free((void*)pstrParserInstanceType);
+        srCloseStatus = E_OK;
+#else
+        pstrParserInstanceType->bReachXMLEnd = STD_TRUE;
+        srCloseStatus = E_OK;
+#endif
+    }
+    else
+    {
+        srCloseStatus = E_NOT_OK;
+    }
+
+    return srCloseStatus;
+}
+/**********************************************************************************************************************/
+/*!\fn         LwXMLP_enumXMLEventTypes LwXMLP_enumGetXMLEventType(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         It is responsible to return the fired event type for the given parser instance pstrParserInstanceType
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        the event types which may be one of the following:
+               - csUnkownEvent, Event isn't known
+               - csStartElementEvent, Event that should be fired up on detecting start element
+               - csEndElementEvent, Event that should be fired up on detecting End element
+               - csProcessInstructionEvent, Event that should be fired up on detecting Processing Instruction
+               - csTextNodeEvent, Event that should be fired up on detecting text node
+               - csCommentEvent, Event that should be fired up on detecting comment
+               - csCDataEvent,  Event that should be fired up on detecting CData
+               - csNotationEvent, Event that should be fired up on detection Notation
+
+@note
+***********************************************************************************************************************/
+LwXMLP_enumXMLEventTypes LwXMLP_enumGetXMLEventType(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    LwXMLP_enumXMLEventTypes objenumXMLEventTypes;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        objenumXMLEventTypes = pstrParserInstanceType->objenumXMLEventTypes;
+    }
+    else
+    {
+        objenumXMLEventTypes = csUnkownEvent;
+    }
+
+    return objenumXMLEventTypes;
+
+}
+/**********************************************************************************************************************/
+/*!\fn         INT8U *LwXMLP_pu8GetParsedText(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         It is responsible to return the current parsed text string
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        pointer to parsed text node string
+@return        STD_NULL: if pstrParserInstanceType is passed as STD_NULL incorrectly.
+
+@note          this API shall be invoked from the upper layer when a csCDataEvent is fired, if it invoked in any other
+               time, the returned value should be meaningless
+***********************************************************************************************************************/
+INT8U *LwXMLP_pu8GetParsedText(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    INT8U *pu8ParsedDataBuffer;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        pu8ParsedDataBuffer = pstrParserInstanceType->pu8ParsedDataBuffer;
+    }
+    else
+    {
+        pu8ParsedDataBuffer = STD_NULL;
+    }
+
+    return pu8ParsedDataBuffer;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT8U *LwXMLP_pu8GetParsedNotation(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         This API is responsible to return the current parsed notation string
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        pointer to parsed text node string
+@return        STD_NULL: if pstrParserInstanceType is passed as STD_NULL incorrectly.
+
+@note          this API shall be invoked from the upper layer when a csNotationEvent is fired, if it invoked in any
+               other time, the returned value should be meaningless
+***********************************************************************************************************************/
+INT8U *LwXMLP_pu8GetParsedNotation(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    INT8U *pu8ParsedNotaion;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        pu8ParsedNotaion = pstrParserInstanceType->pu8ParsedNotaion;
+    }
+    else
+    {
+        pu8ParsedNotaion = STD_NULL;
+    }
+
+    return pu8ParsedNotaion;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT8U *LwXMLP_pu8GetElementName(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         This API is responsible to return the current Element name string
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
 
 @return        Pointer to the current Element name string
 @return        STD_NULL: if pstrParserInstanceType is passed as STD_NULL incorrectly.
@@ -846,6 +1590,34 @@ INT8U const *LwXMLP_pu8GetCurrentPath(LwXMLP_strXMLParseInstanceType const *pstr
     return pu8XMLPath;
 }
 /**********************************************************************************************************************/
+/*!\fn         INT32U LwXMLP_u32GetElementDepth(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         It is responsible to return the number of the open elements, so the root element has depth 1 inside its
+               start and end events
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        The depth of the element under processing
+@return        0: if pstrParserInstanceType is passed as STD_NULL incorrectly.
+
+@note
+***********************************************************************************************************************/
+INT32U LwXMLP_u32GetElementDepth(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    INT32U u32ElementDepth;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        u32ElementDepth = pstrParserInstanceType->u32ElementDepth;
+    }
+    else
+    {
+        u32ElementDepth = 0U;
+    }
+
+    return u32ElementDepth;
+}
+/**********************************************************************************************************************/
 /*!\fn         INT8U *LwXMLP_pu8GetParsedComment(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
 
 @brief         It is responsible to return the current parsed comment string
@@ -1064,1452 +1836,3753 @@ INT8U * LwXMLP_pu8GetAttributeValue(LwXMLP_strXMLParseInstanceType const *pstrPa
     return pu8AttributeValue;
 }
 /**********************************************************************************************************************/
-/*!\fn         LwXMLP_enumParserStatusType LwXMLP_enumXMLParserEngine(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+/*!\fn         LwXMLP_strXMLSpanType LwXMLP_strGetParsedText(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
 
-@brief         it is the core engine of the parser which parse the available portion of the XML document according
-               to the following properties and limitations:
-               - It is online streaming processor (incremental processor) such that it can generate correct partial
-                 output from partial input and this gives a degree of freedom on the XML document size, i.e. there
-                 is no restriction on the XML document size.
-               - It is SAX or event-based processor. Such that it reads an XML document from beginning to end, and each
-                 time it encounters a syntax construction, it notifies the application that is running it, and the
-                 application must implement the appropriate methods to handle the callbacks and get the functionality
-                 needed.
-               - It can receive the XML document from different stream type like file stream and IP stream (TCP/UDP),
-                 serial communication, so on.
-               - The code/data size can be customize to enable/disable some of the feature on the expense of the
-                 code/data size using some macro definitions.
-               - Thread-safe (more precisely: reentrant).
-               - Support two models of memory allocation, static memory allocation and dynamic memory allocation.
-               - It shall be able to detect the xml fetal errors which will cause the reporting for the error type and
-                 the XML line where the error is occurred then it will cause the termination for reading process.
-               - Support only for encoding types UTF-8, UTF-16BE and UTF-16LE.
+@brief         It is responsible to return the current parsed text string with its length
 
-@param[in,out]     pstrParserInstanceType    : pointer to the XML instance to get the current info and to be loaded
-                                               with the new value
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
 
-@return        the status of the parser engine which may be one of the following:
-               - csUnkownEvent, Event isn't known
-               - csStartElementEvent, Event that should be fired up on detecting start element
-               - csEndElementEvent, Event that should be fired up on detecting End element
-               - csProcessInstructionEvent, Event that should be fired up on detecting Processing Instruction
-               - csTextNodeEvent, Event that should be fired up on detecting text node
-               - csCommentEvent, Event that should be fired up on detecting comment
-               - csCDataEvent,  Event that should be fired up on detecting CData
-               - csNotationEvent, Event that should be fired up on detection Notation
+@return        the pointer to the string and its length
+@return        STD_NULL and 0: if pstrParserInstanceType is passed as STD_NULL incorrectly.
 
-@note          The XML parser engine shall be continuously invoked till parsing done or the parsing encountered an error
+@note          this API shall be invoked from the upper layer when a csTextNodeEvent or csCDataEvent is fired, if it invoked
+               in any other time, the returned value should be meaningless
 ***********************************************************************************************************************/
-LwXMLP_enumParserStatusType LwXMLP_enumXMLParserEngine(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+LwXMLP_strXMLSpanType LwXMLP_strGetParsedText(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
 {
-          BOOLEAN                      bStopLookingForData  = STD_FALSE;
-    const INT8U                       *pu8CurrentCharacter;
-          StdReturnType                srStatus;
-          LwXMLP_enumParserStatusType  objenumParserStatusType = csUnkownParserStatus;
+    LwXMLP_strXMLSpanType objstrXMLSpanType;
 
-    LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Start parsing round");
-    /* looking for the data of the XML node*/
-    while(bStopLookingForData == STD_FALSE)
+    if(pstrParserInstanceType != STD_NULL)
     {
-        pu8CurrentCharacter = LwXMLP_pu8GetCurrentCharacter(pstrParserInstanceType);
-        if(LwXMLP_u32GetReadyData(pstrParserInstanceType) == 0U)
-        {
-            LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "There is no data for parsing");
-            objenumParserStatusType = csContinueAddingXMLData;
-            bStopLookingForData = STD_TRUE;
-        }
-        else if(LwXMLP_bIsLessThanCharacter(pu8CurrentCharacter) == STD_TRUE)
-        {
-            LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found <");
-            bStopLookingForData = STD_TRUE;
-        }
-#if(ENABLE_DTD_RECEIPTION == STD_ON)
-        else if(pstrParserInstanceType->bParsingDTDInProgress == STD_TRUE)
-        {
-            LwXMLP_vCheckDTDPortion(pstrParserInstanceType);
-            if(pstrParserInstanceType->objenumErrorType == csNoError)
-            {
-                objenumParserStatusType = csContinueParsingXMLData;
-            }
-            else
-            {
-                objenumParserStatusType = csParserError;
-            }
-            bStopLookingForData = STD_TRUE;
-        }
-#endif
-        else
-        {
-            LwXMLP_vCheckavailableData(pstrParserInstanceType);
-            if(pstrParserInstanceType->objenumErrorType == csNoError)
-            {
-                if(pstrParserInstanceType->bEndOfDataIsFound == STD_TRUE)
-                {   /* data shall be available inside TAG*/
-                    if(pstrParserInstanceType->u32PathLength != 0U)
-                    {
-#if(ENABLE_EOL_NORMALIZATION == STD_ON)
-                        LwXMLP_vNormalizeEndOfLine(pstrParserInstanceType->u8XMLworkingBuffer);
+        objstrXMLSpanType.pu8Span       = pstrParserInstanceType->pu8ParsedDataBuffer;
+        objstrXMLSpanType.u32SpanLength = pstrParserInstanceType->u32ParsedDataLength;
+    }
+    else
+    {
+        objstrXMLSpanType.pu8Span       = STD_NULL;
+        objstrXMLSpanType.u32SpanLength = 0U;
+    }
+
+    return objstrXMLSpanType;
+}
+/**********************************************************************************************************************/
+/*!\fn         LwXMLP_strXMLSpanType LwXMLP_strGetElementName(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         It is responsible to return the current Element name string with its length
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        the pointer to the string and its length
+@return        STD_NULL and 0: if pstrParserInstanceType is passed as STD_NULL incorrectly.
+
+@note          this API shall be invoked from the upper layer when a csStartElementEvent or csEndElementEvent is fired,
+               if it invoked in any other time, the returned value should be meaningless
+***********************************************************************************************************************/
+LwXMLP_strXMLSpanType LwXMLP_strGetElementName(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    LwXMLP_strXMLSpanType objstrXMLSpanType;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        objstrXMLSpanType.pu8Span       = pstrParserInstanceType->pu8ElementName;
+        objstrXMLSpanType.u32SpanLength = pstrParserInstanceType->u32ElementNameLength;
+    }
+    else
+    {
+        objstrXMLSpanType.pu8Span       = STD_NULL;
+        objstrXMLSpanType.u32SpanLength = 0U;
+    }
+
+    return objstrXMLSpanType;
+}
+/**********************************************************************************************************************/
+/*!\fn         LwXMLP_strXMLSpanType LwXMLP_strGetCurrentPath(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         It is responsible to return the current path of the XML element under processing with its length
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        the pointer to the string and its length
+@return        STD_NULL and 0: if pstrParserInstanceType is passed as STD_NULL incorrectly.
+
+@note
+***********************************************************************************************************************/
+LwXMLP_strXMLSpanType LwXMLP_strGetCurrentPath(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    LwXMLP_strXMLSpanType objstrXMLSpanType;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        objstrXMLSpanType.pu8Span       = (INT8U const *)&pstrParserInstanceType->u8XMLPathBuffer[0];
+        objstrXMLSpanType.u32SpanLength = pstrParserInstanceType->u32PathLength;
+    }
+    else
+    {
+        objstrXMLSpanType.pu8Span       = STD_NULL;
+        objstrXMLSpanType.u32SpanLength = 0U;
+    }
+
+    return objstrXMLSpanType;
+}
+/**********************************************************************************************************************/
+/*!\fn         LwXMLP_strXMLSpanType LwXMLP_strGetParsedComment(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         It is responsible to return the current parsed comment string with its length
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        the pointer to the string and its length
+@return        STD_NULL and 0: if pstrParserInstanceType is passed as STD_NULL incorrectly.
+
+@note          this API shall be invoked from the upper layer when a csCommentEvent event is fired, if it invoked in
+               any other time, the returned value should be meaningless
+***********************************************************************************************************************/
+LwXMLP_strXMLSpanType LwXMLP_strGetParsedComment(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    LwXMLP_strXMLSpanType objstrXMLSpanType;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        objstrXMLSpanType.pu8Span       = pstrParserInstanceType->pu8ParsedComments;
+        objstrXMLSpanType.u32SpanLength = pstrParserInstanceType->u32ParsedCommentsLength;
+    }
+    else
+    {
+        objstrXMLSpanType.pu8Span       = STD_NULL;
+        objstrXMLSpanType.u32SpanLength = 0U;
+    }
+
+    return objstrXMLSpanType;
+}
+/**********************************************************************************************************************/
+/*!\fn         LwXMLP_strXMLSpanType LwXMLP_strGetParsedPITarget(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         It is responsible to return the current parsed processing instruction target string with its length
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        the pointer to the string and its length
+@return        STD_NULL and 0: if pstrParserInstanceType is passed as STD_NULL incorrectly.
+
+@note          this API shall be invoked from the upper layer when a csProcessInstructionEvent event is fired, if it
+               invoked in any other time, the returned value should be meaningless
+***********************************************************************************************************************/
+LwXMLP_strXMLSpanType LwXMLP_strGetParsedPITarget(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    LwXMLP_strXMLSpanType objstrXMLSpanType;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        objstrXMLSpanType.pu8Span       = pstrParserInstanceType->pu8ParsedPITarget;
+        objstrXMLSpanType.u32SpanLength = pstrParserInstanceType->u32ParsedPITargetLength;
+    }
+    else
+    {
+        objstrXMLSpanType.pu8Span       = STD_NULL;
+        objstrXMLSpanType.u32SpanLength = 0U;
+    }
+
+    return objstrXMLSpanType;
+}
+/**********************************************************************************************************************/
+/*!\fn         LwXMLP_strXMLSpanType LwXMLP_strGetParsedPIData(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         It is responsible to return the current parsed processing instruction data string with its length
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        the pointer to the string and its length
+@return        STD_NULL and 0: if pstrParserInstanceType is passed as STD_NULL incorrectly.
+
+@note          the pointer is STD_NULL and the length is 0 if the processing instruction has no data
+***********************************************************************************************************************/
+LwXMLP_strXMLSpanType LwXMLP_strGetParsedPIData(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    LwXMLP_strXMLSpanType objstrXMLSpanType;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        objstrXMLSpanType.pu8Span       = pstrParserInstanceType->pu8ParsedPIContent;
+        objstrXMLSpanType.u32SpanLength = pstrParserInstanceType->u32ParsedPIContentLength;
+    }
+    else
+    {
+        objstrXMLSpanType.pu8Span       = STD_NULL;
+        objstrXMLSpanType.u32SpanLength = 0U;
+    }
+
+    return objstrXMLSpanType;
+}
+/**********************************************************************************************************************/
+/*!\fn         LwXMLP_strXMLSpanType LwXMLP_strGetAttributeName(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                                INT16S                                s16AttributeIndex)
+
+@brief         It is responsible to return the attribute name string which its index is defined by
+               s16AttributeIndex with its length
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@param[in]     s16AttributeIndex          : Index of the parsed attribute
+
+@return        the pointer to the string and its length
+@return        STD_NULL and 0: if pstrParserInstanceType is passed as STD_NULL incorrectly or the s16AttributeIndex
+               isn't correct.
+
+@note          it is the span of LwXMLP_pu8GetAttributeName, so the upper layer doesn't need to measure the string
+***********************************************************************************************************************/
+LwXMLP_strXMLSpanType LwXMLP_strGetAttributeName(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                 INT16S                                s16AttributeIndex)
+{
+    LwXMLP_strXMLSpanType objstrXMLSpanType;
+
+    if((pstrParserInstanceType != STD_NULL) && \
+       (s16AttributeIndex >= 0) && (s16AttributeIndex < pstrParserInstanceType->s16AttributeCounts))
+    {
+        objstrXMLSpanType.pu8Span       = pstrParserInstanceType->pu8AttributeNameArray[s16AttributeIndex];
+        objstrXMLSpanType.u32SpanLength = pstrParserInstanceType->u32AttributeNameLengthArray[s16AttributeIndex];
+    }
+    else
+    {
+        objstrXMLSpanType.pu8Span       = STD_NULL;
+        objstrXMLSpanType.u32SpanLength = 0U;
+    }
+
+    return objstrXMLSpanType;
+}
+/**********************************************************************************************************************/
+/*!\fn         LwXMLP_strXMLSpanType LwXMLP_strGetAttributeValue(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                                 INT16S                                s16AttributeIndex)
+
+@brief         It is responsible to return the attribute value string which its index is defined by
+               s16AttributeIndex with its length
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@param[in]     s16AttributeIndex          : Index of the parsed attribute
+
+@return        the pointer to the string and its length
+@return        STD_NULL and 0: if pstrParserInstanceType is passed as STD_NULL incorrectly or the s16AttributeIndex
+               isn't correct.
+
+@note          it is the span of LwXMLP_pu8GetAttributeValue, so the upper layer doesn't need to measure the string
+***********************************************************************************************************************/
+LwXMLP_strXMLSpanType LwXMLP_strGetAttributeValue(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                  INT16S                                s16AttributeIndex)
+{
+    LwXMLP_strXMLSpanType objstrXMLSpanType;
+
+    if((pstrParserInstanceType != STD_NULL) && \
+       (s16AttributeIndex >= 0) && (s16AttributeIndex < pstrParserInstanceType->s16AttributeCounts))
+    {
+        objstrXMLSpanType.pu8Span       = pstrParserInstanceType->pu8AttributeValueArray[s16AttributeIndex];
+        objstrXMLSpanType.u32SpanLength = pstrParserInstanceType->u32AttributeValueLengthArray[s16AttributeIndex];
+    }
+    else
+    {
+        objstrXMLSpanType.pu8Span       = STD_NULL;
+        objstrXMLSpanType.u32SpanLength = 0U;
+    }
+
+    return objstrXMLSpanType;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT32U LwXMLP_u32GetAttributeNameHash(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                     INT16S                                s16AttributeIndex)
+
+@brief         It is responsible to return the hash of the attribute name which its index is defined by
+               s16AttributeIndex, the hash is computed once while the TAG is tokenized
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@param[in]     s16AttributeIndex          : Index of the parsed attribute
+
+@return        the hash of the attribute name, it equals LwXMLP_u32GetNameHash of the same name
+@return        0: if pstrParserInstanceType is passed as STD_NULL incorrectly or the s16AttributeIndex isn't correct.
+
+@note          the equal hashes don't guarantee equal names, so the names shall be compared if the hashes are equal
+***********************************************************************************************************************/
+INT32U LwXMLP_u32GetAttributeNameHash(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                      INT16S                                s16AttributeIndex)
+{
+    INT32U u32AttributeNameHash;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        if((s16AttributeIndex >= 0) && (s16AttributeIndex < pstrParserInstanceType->s16AttributeCounts))
+        {
+            u32AttributeNameHash = pstrParserInstanceType->u32AttributeHashArray[s16AttributeIndex];
+        }
+        else
+        {
+            u32AttributeNameHash = 0U;
+        }
+    }
+    else
+    {
+        u32AttributeNameHash = 0U;
+    }
+
+    return u32AttributeNameHash;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT32U LwXMLP_u32GetNameHash(INT8U const *pu8Name)
+
+@brief         It is responsible to return the hash of a name string by the same function which is used by the parser
+               for the attributes names, so the application can prepare the hashes of the names it looks for
+
+@param[in]     pu8Name    : the name string with NULL terminator
+
+@return        the hash of the name
+@return        0: if pu8Name is passed as STD_NULL incorrectly
+
+@note
+***********************************************************************************************************************/
+INT32U LwXMLP_u32GetNameHash(INT8U const *pu8Name)
+{
+    INT32U u32NameHash;
+
+    if(pu8Name != STD_NULL)
+    {
+        u32NameHash = LwXMLP_u32HashBytes(NAME_HASH_OFFSET_BASIS, pu8Name, strlen((INT8S const *)pu8Name));
+    }
+    else
+    {
+        u32NameHash = 0U;
+    }
+
+    return u32NameHash;
+}
+#if(ENABLE_NAME_INTERNING == STD_ON)
+/**********************************************************************************************************************/
+/*!\fn         StdReturnType LwXMLP_srAddNameId(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                const INT8U                          *pu8Name, \
+                                                      INT32U                          u32NameId)
+
+@brief         It is responsible to give an ID to an element or attribute name, so the upper layer can dispatch the
+               events by LwXMLP_u32GetElementId and LwXMLP_u32GetAttributeId instead of comparing the names
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@param[in]     pu8Name                   : the name string with NULL terminator
+
+@param[in]     u32NameId                 : the ID of the name, it shall not be LwXMLP_UNKNOWN_NAME_ID
+
+@return        E_OK    : if the name is added
+@return        E_NOT_OK: if one of the passing parameters is invalid, the name is already added or MAX_INTERNED_NAMES
+                         names are already added
+
+@note          The names shall be added after the initialization of the instance, and the name string isn't copied
+               so it shall be kept valid as long as the instance is used
+***********************************************************************************************************************/
+StdReturnType LwXMLP_srAddNameId(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                 const INT8U                          *pu8Name, \
+                                       INT32U                          u32NameId)
+{
+    StdReturnType        srAddNameIdStatus;
+    INT32U               u32NameHash, u32Slot;
+    strInternedNameType *pstrInternedNameType;
+
+    if((pstrParserInstanceType != STD_NULL) && (pu8Name != STD_NULL) && (u32NameId != LwXMLP_UNKNOWN_NAME_ID) && \
+       (pstrParserInstanceType->u32InternedNameCount < MAX_INTERNED_NAMES))
+    {
+        u32NameHash = LwXMLP_u32HashBytes(NAME_HASH_OFFSET_BASIS, pu8Name, strlen((INT8S const *)pu8Name));
+        if((pu8Name[0] != NULL_ASCII_CHARACTER) && \
+           (LwXMLP_s16FindInternedName(pstrParserInstanceType, pu8Name, u32NameHash, &u32Slot) < 0))
+        {
+            pstrInternedNameType              = \
+                &pstrParserInstanceType->objstrInternedNameArray[pstrParserInstanceType->u32InternedNameCount];
+            pstrInternedNameType->pu8Name     = pu8Name;
+            pstrInternedNameType->u32NameHash = u32NameHash;
+            pstrInternedNameType->u32NameId   = u32NameId;
+            pstrParserInstanceType->s16NameIdHashTable[u32Slot] = (INT16S)pstrParserInstanceType->u32InternedNameCount;
+            pstrParserInstanceType->u32InternedNameCount++;
+            srAddNameIdStatus = E_OK;
+        }
+        else
+        {
+            srAddNameIdStatus = E_NOT_OK;
+        }
+    }
+    else
+    {
+        srAddNameIdStatus = E_NOT_OK;
+    }
+
+    return srAddNameIdStatus;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT32U LwXMLP_u32GetElementId(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         It is responsible to return the ID of the current element name, the ID is looked up by the name hash
+               which is computed while the TAG is tokenized
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        the ID which is given to the element name by LwXMLP_srAddNameId
+@return        LwXMLP_UNKNOWN_NAME_ID: if the name isn't given an ID, the event isn't a start or end element event or
+                                       pstrParserInstanceType is passed as STD_NULL incorrectly.
+
+@note
+***********************************************************************************************************************/
+INT32U LwXMLP_u32GetElementId(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    INT32U u32ElementId, u32Slot;
+    INT16S s16NameIndex;
+
+    u32ElementId = LwXMLP_UNKNOWN_NAME_ID;
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        if((pstrParserInstanceType->objenumXMLEventTypes == csStartElementEvent) || \
+           (pstrParserInstanceType->objenumXMLEventTypes == csEndElementEvent))
+        {
+            s16NameIndex = LwXMLP_s16FindInternedName(pstrParserInstanceType, \
+                                                      pstrParserInstanceType->pu8ElementName, \
+                                                      pstrParserInstanceType->u32ElementNameHash, \
+                                                      &u32Slot);
+            if(s16NameIndex >= 0)
+            {
+                u32ElementId = pstrParserInstanceType->objstrInternedNameArray[s16NameIndex].u32NameId;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+
+    return u32ElementId;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT32U LwXMLP_u32GetAttributeId(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                               INT16S                                s16AttributeIndex)
+
+@brief         It is responsible to return the ID of the attribute name which its index is defined by
+               s16AttributeIndex, the ID is looked up by the name hash which is computed while the TAG is tokenized
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@param[in]     s16AttributeIndex          : Index of the parsed attribute
+
+@return        the ID which is given to the attribute name by LwXMLP_srAddNameId
+@return        LwXMLP_UNKNOWN_NAME_ID: if the name isn't given an ID, the s16AttributeIndex isn't correct or
+                                       pstrParserInstanceType is passed as STD_NULL incorrectly.
+
+@note
+***********************************************************************************************************************/
+INT32U LwXMLP_u32GetAttributeId(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                INT16S                                s16AttributeIndex)
+{
+    INT32U u32AttributeId, u32Slot;
+    INT16S s16NameIndex;
+
+    u32AttributeId = LwXMLP_UNKNOWN_NAME_ID;
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        if((s16AttributeIndex >= 0) && (s16AttributeIndex < pstrParserInstanceType->s16AttributeCounts))
+        {
+            s16NameIndex = LwXMLP_s16FindInternedName(pstrParserInstanceType, \
+                                                      pstrParserInstanceType->pu8AttributeNameArray[s16AttributeIndex], \
+                                                      pstrParserInstanceType->u32AttributeHashArray[s16AttributeIndex], \
+                                                      &u32Slot);
+            if(s16NameIndex >= 0)
+            {
+                u32AttributeId = pstrParserInstanceType->objstrInternedNameArray[s16NameIndex].u32NameId;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+
+    return u32AttributeId;
+}
+#endif
+/**********************************************************************************************************************/
+/*!\fn         LwXMLP_enumParserStatusType LwXMLP_enumXMLParserEngine(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+@brief         it is the core engine of the parser which parse the available portion of the XML document according
+               to the following properties and limitations:
+               - It is online streaming processor (incremental processor) such that it can generate correct partial
+                 output from partial input and this gives a degree of freedom on the XML document size, i.e. there
+                 is no restriction on the XML document size.
+               - It is SAX or event-based processor. Such that it reads an XML document from beginning to end, and each
+                 time it encounters a syntax construction, it notifies the application that is running it, and the
+                 application must implement the appropriate methods to handle the callbacks and get the functionality
+                 needed.
+               - It can receive the XML document from different stream type like file stream and IP stream (TCP/UDP),
+                 serial communication, so on.
+               - The code/data size can be customize to enable/disable some of the feature on the expense of the
+                 code/data size using some macro definitions.
+               - Thread-safe (more precisely: reentrant), the shared DTD tables and DTD cache are guarded by
+                 LwXMLP_mEnterDTDCriticalSection and LwXMLP_mExitDTDCriticalSection.
+               - Support two models of memory allocation, static memory allocation and dynamic memory allocation.
+               - It shall be able to detect the xml fetal errors which will cause the reporting for the error type and
+                 the XML line where the error is occurred then it will cause the termination for reading process.
+               - Support only for encoding types UTF-8, UTF-16BE and UTF-16LE.
+
+@param[in,out]     pstrParserInstanceType    : pointer to the XML instance to get the current info and to be loaded
+                                               with the new value
+
+@return        the status of the parser engine which may be one of the following:
+               - csUnkownEvent, Event isn't known
+               - csStartElementEvent, Event that should be fired up on detecting start element
+               - csEndElementEvent, Event that should be fired up on detecting End element
+               - csProcessInstructionEvent, Event that should be fired up on detecting Processing Instruction
+               - csTextNodeEvent, Event that should be fired up on detecting text node
+               - csCommentEvent, Event that should be fired up on detecting comment
+               - csCDataEvent,  Event that should be fired up on detecting CData
+               - csNotationEvent, Event that should be fired up on detection Notation
+
+@note          The XML parser engine shall be continuously invoked till parsing done or the parsing encountered an error
+***********************************************************************************************************************/
+LwXMLP_enumParserStatusType LwXMLP_enumXMLParserEngine(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+{
+          BOOLEAN                      bStopLookingForData  = STD_FALSE;
+    const INT8U                       *pu8CurrentCharacter;
+          StdReturnType                srStatus;
+          LwXMLP_enumParserStatusType  objenumParserStatusType = csUnkownParserStatus;
+
+    LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Start parsing round");
+    /* looking for the data of the XML node*/
+    while(bStopLookingForData == STD_FALSE)
+    {
+        pu8CurrentCharacter = LwXMLP_pu8GetCurrentCharacter(pstrParserInstanceType);
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+        if((pstrParserInstanceType->u8InputSourceDepth > 0U) && (LwXMLP_u32GetReadyData(pstrParserInstanceType) == 0U))
+        {
+            LwXMLP_vPopInputSource(pstrParserInstanceType);
+            if(pstrParserInstanceType->objenumErrorType != csNoError)
+            {
+                objenumParserStatusType = csParserError;
+                bStopLookingForData     = STD_TRUE;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+        }
+        else
+#endif
+        if(LwXMLP_u32GetReadyData(pstrParserInstanceType) == 0U)
+        {
+            LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "There is no data for parsing");
+            objenumParserStatusType = csContinueAddingXMLData;
+            bStopLookingForData = STD_TRUE;
+        }
+#if(ENABLE_DTD_CACHE == STD_ON)
+        else if(pstrParserInstanceType->objenumDTDCacheStateType == csDTDCacheScanning)
+        {
+            if(LwXMLP_bScanDTDCacheKey(pstrParserInstanceType) == STD_FALSE)
+            {
+                objenumParserStatusType = csContinueAddingXMLData;
+                bStopLookingForData     = STD_TRUE;
+            }
+            else
+            {
+                /*
+                 * The subset is attached or it will be parsed
+                 */
+            }
+        }
+#endif
+        else if(LwXMLP_bIsLessThanCharacter(pu8CurrentCharacter) == STD_TRUE)
+        {
+            LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found <");
+            bStopLookingForData = STD_TRUE;
+        }
+#if(ENABLE_DTD_RECEIPTION == STD_ON)
+        else if(pstrParserInstanceType->bParsingDTDInProgress == STD_TRUE)
+        {
+            LwXMLP_vCheckDTDPortion(pstrParserInstanceType);
+            if(pstrParserInstanceType->objenumErrorType == csNoError)
+            {
+                objenumParserStatusType = csContinueParsingXMLData;
+            }
+            else
+            {
+                objenumParserStatusType = csParserError;
+            }
+            bStopLookingForData = STD_TRUE;
+        }
+#endif
+        else
+        {
+            LwXMLP_vCheckavailableData(pstrParserInstanceType);
+            if(pstrParserInstanceType->objenumErrorType == csNoError)
+            {
+                if(pstrParserInstanceType->bEndOfDataIsFound == STD_TRUE)
+                {   /* data shall be available inside TAG*/
+                    if(pstrParserInstanceType->u32PathLength != 0U)
+                    {
+                        pstrParserInstanceType->objenumXMLEventTypes = csTextNodeEvent;
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                        if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
+                        {
+#endif
+                            srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
+                            if(srStatus == E_OK)
+                            {
+                                objenumParserStatusType = csContinueParsingXMLData;
+                            }
+                            else
+                            {
+                                /*Terminate XML reception due to error at the user side*/
+                                objenumParserStatusType                  = csParserError;
+                                pstrParserInstanceType->objenumErrorType = csCallBackErrorOnData;
+                            }
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                        }
+                        else
+                        {
+                            objenumParserStatusType = csContinueParsingXMLData;
+                        }
+#endif
+                    }
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                    else if(pstrParserInstanceType->u8InputSourceDepth > 0U)
+                    {
+                        objenumParserStatusType = csContinueParsingXMLData;
+                    }
+#endif
+                    else
+                    {
+                        objenumParserStatusType                  = csParserError;
+                        pstrParserInstanceType->objenumErrorType = csDataWithoutStartTag;
+                    }
+                    bStopLookingForData = STD_TRUE;
+                }
+                else
+                {/* No Data or markup is found */
+                    /*
+                     * check if we reach the end of the XML and there is no more markup for parsing
+                     */
+                    if(pstrParserInstanceType->bReachXMLEnd == STD_TRUE)
+                    {
+                        pu8CurrentCharacter = LwXMLP_pu8GetCurrentCharacter(pstrParserInstanceType);
+                        if(LwXMLP_bIsLessThanCharacter(pu8CurrentCharacter) == STD_FALSE)
+                        {
+                            objenumParserStatusType = csParsingFinished;
+                        }
+                        else
+                        {
+                            objenumParserStatusType = csContinueAddingXMLData;
+                        }
+                    }
+                    else
+                    {
+                        objenumParserStatusType = csContinueAddingXMLData;
+                    }
+                    bStopLookingForData     = STD_TRUE;
+                }
+            }
+            else
+            {
+                /*Terminate XML reception due to error */
+                objenumParserStatusType = csParserError;
+                bStopLookingForData     = STD_TRUE;
+            }
+        }
+    }
+    if(objenumParserStatusType == csUnkownParserStatus)
+    {
+        /*we need to check <> */
+        /*we need to check < */
+        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Parsing the content of <>");
+        LwXMLP_vCheckTagForDirective(pstrParserInstanceType);
+        if(pstrParserInstanceType->objenumErrorType == csNoError)
+        {
+            if(pstrParserInstanceType->bTagContainDirective == STD_TRUE)
+            {
+                /* grab what ever is in-between '<' and '>' and put it in s8XMLBuffer*/
+                LwXMLP_vLoadDirectiveToBuffer(pstrParserInstanceType);
+                if(pstrParserInstanceType->objenumErrorType == csNoError)
+                {
+                    if(pstrParserInstanceType->bEndOfDirectiveFound == STD_TRUE)
+                    {
+                        /* the TAG start or end are currently loaded to the working buffer */
+                        switch(pstrParserInstanceType->objenumDirectiveTypeType)
+                        {
+                            case csProcessingInstructionMarkup:
+                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
+#if(ENABLE_PI_WELL_FORM_CHECK == STD_ON)
+                                 LwXMLP_vParsePI(pstrParserInstanceType);
+                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
+                                 {
+                                     pstrParserInstanceType->objenumXMLEventTypes = csProcessInstructionEvent;
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                                     if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
+                                     {
+#endif
+                                         srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
+                                         if(srStatus == E_OK)
+                                         {
+                                             if((LwXMLP_bMoreCharacterAtEndOfXML(pstrParserInstanceType) == STD_FALSE) &&
+                                                (pstrParserInstanceType->bReachXMLEnd == STD_TRUE))
+                                             {
+                                                 objenumParserStatusType = csParsingFinished;
+                                             }
+                                             else
+                                             {
+                                                 objenumParserStatusType = csContinueParsingXMLData;
+                                             }
+                                         }
+                                         else
+                                         {
+                                             /*Terminate XML reception due to error at the user side*/
+                                             objenumParserStatusType                  = csParserError;
+                                             pstrParserInstanceType->objenumErrorType = csCallBackErrorOnPIDirective;
+                                         }
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                                     }
+                                     else
+                                     {
+                                         objenumParserStatusType = csContinueParsingXMLData;
+                                     }
+#endif
+                                 }
+                                 else
+                                 {
+                                     objenumParserStatusType = csParserError;
+                                 }
+#else
+                                 objenumParserStatusType = csContinueParsingXMLData;
+#endif
+                                 break;
+                            case csCommentMarkup:
+                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
+#if(ENABLE_DTD_RECEIPTION == STD_ON)
+                                 /* the comment is reported with its --> footer */
+                                 pstrParserInstanceType->u32ParsedCommentsLength = pstrParserInstanceType->u32DirectiveLength - 4U;
+#else
+                                 /* the --> footer is removed while the comment is loaded */
+                                 pstrParserInstanceType->u32ParsedCommentsLength = pstrParserInstanceType->u32DirectiveLength - 7U;
+#endif
+#if(ENABLE_COMMENT_WELL_FORM_CHECK == STD_ON)
+                                 LwXMLP_vCheckWellFormedComment(pstrParserInstanceType);
+#endif
+                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
+                                 {
+                                      pstrParserInstanceType->objenumXMLEventTypes = csCommentEvent;
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                                      if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
+                                      {
+#endif
+                                          srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
+                                          if(srStatus == E_OK)
+                                          {
+                                              if(pstrParserInstanceType->bReachXMLEnd == STD_TRUE)
+                                              {
+                                                  if(LwXMLP_bMoreCharacterAtEndOfXML(pstrParserInstanceType) == STD_FALSE)
+                                                  {
+                                                      objenumParserStatusType = csParsingFinished;
+                                                  }
+                                                  else
+                                                  {
+                                                      objenumParserStatusType = csContinueParsingXMLData;
+                                                  }
+                                              }
+                                              else
+                                              {
+                                                  objenumParserStatusType = csContinueParsingXMLData;
+                                              }
+                                          }
+                                          else
+                                          {
+                                              /*Terminate XML reception due to error at the user side*/
+                                              objenumParserStatusType                  = csParserError;
+                                              pstrParserInstanceType->objenumErrorType = csCallBackErrorOnComment;
+                                          }
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                                      }
+                                      else
+                                      {
+                                          objenumParserStatusType = csContinueParsingXMLData;
+                                      }
+#endif
+                                 }
+                                 else
+                                 {
+                                      objenumParserStatusType = csParserError;
+                                 }
+                                 break;
+                            case csDeclarationMarkup:
+                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
+#if(ENABLE_DECL_WELL_FORM_CHECK == STD_ON)
+                                 LwXMLP_vCheckWellFormedDecl(pstrParserInstanceType);
+                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
+                                 {
+                                     objenumParserStatusType = csContinueParsingXMLData;
+                                 }
+                                 else
+                                 {
+                                     objenumParserStatusType = csParserError;
+                                 }
+#else
+                                 objenumParserStatusType = csContinueParsingXMLData;
+#endif
+                                 break;
+#if(ENABLE_DTD_RECEIPTION == STD_ON)
+                            case csDTDElementMarkup:
+#if(ENABLE_DECL_WELL_FORM_CHECK == STD_ON)
+                                 LwXMLP_vValidateElement(pstrParserInstanceType);
+                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
+                                 {
+                                     objenumParserStatusType = csContinueParsingXMLData;
+                                 }
+                                 else
+                                 {
+                                     objenumParserStatusType = csParserError;
+                                 }
+#else
+                                 objenumParserStatusType = csContinueParsingXMLData;
+#endif
+                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
+                                 break;
+                            case csDTDEntitytMarkup:
+                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
+#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
+                                 if(pstrParserInstanceType->bFoundExternalEntity == STD_TRUE)
+                                 {
+                                     /*
+                                      * They must not process entity declarations or attribute-list declarations
+                                      * encountered after a reference to a parameter entity that is not read,
+                                      */
+                                 }
+                                 else if(LwXMLP_bOwnDTDTables(pstrParserInstanceType) == STD_FALSE)
+                                 {
+                                     pstrParserInstanceType->objenumErrorType = csDTDTablesExhausted;
+                                 }
+                                 else
+                                 {
+                                     LwXMLP_vCheckWellFormedEntity(pstrParserInstanceType);
+                                 }
+                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
+                                 {
+                                     objenumParserStatusType = csContinueParsingXMLData;
+                                 }
+                                 else
+                                 {
+                                     objenumParserStatusType = csParserError;
+                                 }
+#else
+                                 objenumParserStatusType = csContinueParsingXMLData;
+#endif
+                                 break;
+                            case csDTDNotationtMarkup:
+#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
+                                 LwXMLP_vValidateNotation(pstrParserInstanceType);
+                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
+                                 {
+#if 0
+                                     pstrParserInstanceType->objenumXMLEventTypes = csNotationEvent;
+                                     srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
+                                     if(srStatus == E_OK)
+                                     {
+                                         objenumParserStatusType = csContinueParsingXMLData;
+                                     }
+                                     else
+                                     {
+                                         /*Terminate XML reception due to error at the user side*/
+                                         objenumParserStatusType                  = csParserError;
+                                         pstrParserInstanceType->objenumErrorType = csCallBackErrorOnData;
+                                     }
+#endif
+                                     objenumParserStatusType = csContinueParsingXMLData;
+                                 }
+                                 else
+                                 {
+                                     objenumParserStatusType = csParserError;
+                                 }
+#else
+                                 objenumParserStatusType = csContinueParsingXMLData;
+#endif
+                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
+                                 break;
+                            case csDTDAttlistMarkup:
+#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
+                                 if(pstrParserInstanceType->bFoundExternalEntity == STD_TRUE)
+                                 {
+                                     /*
+                                      * They must not process entity declarations or attribute-list declarations
+                                      * encountered after a reference to a parameter entity that is not read,
+                                      */
+                                 }
+                                 else if(LwXMLP_bOwnDTDTables(pstrParserInstanceType) == STD_FALSE)
+                                 {
+                                     pstrParserInstanceType->objenumErrorType = csDTDTablesExhausted;
+                                 }
+                                 else
+                                 {
+                                     LwXMLP_vValidateAttributeList(pstrParserInstanceType);
+                                 }
+                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
+                                 {
+                                     objenumParserStatusType = csContinueParsingXMLData;
+                                 }
+                                 else
+                                 {
+                                     objenumParserStatusType = csParserError;
+                                 }
+#else
+                                 objenumParserStatusType = csContinueParsingXMLData;
+#endif
+                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
+                                 break;
+                            case csInternalDTDMarkup:
+                            case csExternalDTDMarkup:
+                            case csDTDMarkup:
+                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
+#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
+                                 LwXMLP_vValidateDTD(pstrParserInstanceType);
+                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
+                                 {
+                                     objenumParserStatusType = csContinueParsingXMLData;
+#if(ENABLE_DTD_CACHE == STD_ON)
+                                     if((pstrParserInstanceType->objenumDirectiveTypeType == csInternalDTDMarkup) && \
+                                        (pstrParserInstanceType->bParsingDTDInProgress == STD_TRUE) && \
+                                        (pstrParserInstanceType->u8InputSourceDepth == 0U))
+                                     {/* look the internal subset up in the DTD cache before parsing it */
+                                         pstrParserInstanceType->objenumDTDCacheStateType = csDTDCacheScanning;
+                                         pstrParserInstanceType->u32DTDCacheScanOffset    = 0U;
+                                         pstrParserInstanceType->u32DTDCacheSubsetHash    = NAME_HASH_OFFSET_BASIS;
+                                         pstrParserInstanceType->u32DTDCacheMarkupOffset  = 0U;
+                                         pstrParserInstanceType->u8DTDCacheQuote          = 0U;
+                                         pstrParserInstanceType->bDTDCacheInsideMarkup    = STD_FALSE;
+                                     }
+                                     else
+                                     {
+                                         /*
+                                          * Nothing to do
+                                          */
+                                     }
+#endif
+                                 }
+                                 else
+                                 {
+                                     objenumParserStatusType = csParserError;
+                                 }
+#else
+                                 objenumParserStatusType = csContinueParsingXMLData;
+#endif
+                                 break;
+#else
+                            case csDTDMarkup:
+                                 /*
+                                  * Nothing to do
+                                  */
+                                 break;
+#endif
+                            case csCDATAMarkup:
+#if(ENABLE_CDATA_WELL_FORM_CHECK == STD_ON)
+                                 LwXMLP_vCheckWellFormedCDATA(pstrParserInstanceType);
+                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
+                                 {
+                                     pstrParserInstanceType->objenumXMLEventTypes = csCDataEvent;
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                                     if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
+                                     {
+#endif
+                                         if(pstrParserInstanceType->u32PathLength != 0U)
+                                         {
+#if(ENABLE_EOL_NORMALIZATION == STD_ON)
+                                             pstrParserInstanceType->u32ParsedDataLength = \
+                                                     LwXMLP_u32NormalizeEndOfLine(pstrParserInstanceType->pu8ParsedDataBuffer, \
+                                                                                  pstrParserInstanceType->u32ParsedDataLength);
+#endif
+                                             srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
+                                             if(srStatus == E_OK)
+                                             {
+                                                 objenumParserStatusType = csContinueParsingXMLData;
+                                             }
+                                             else
+                                             {
+                                                 /*Terminate XML reception due to error at the user side*/
+                                                 objenumParserStatusType                  = csParserError;
+                                                 pstrParserInstanceType->objenumErrorType = csCallBackErrorOnData;
+                                             }
+                                         }
+                                         else
+                                         {
+                                             objenumParserStatusType                  = csParserError;
+                                             pstrParserInstanceType->objenumErrorType = csInvalidRootToken;
+                                         }
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                                     }
+                                     else
+                                     {
+                                         objenumParserStatusType = csContinueParsingXMLData;
+                                     }
+#endif
+                                 }
+                                 else
+                                 {
+                                     objenumParserStatusType = csParserError;
+                                 }
+#else
+                                 objenumParserStatusType = csContinueParsingXMLData;
+#endif
+                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
+                                 break;
+                            default:
+                                 objenumParserStatusType = csContinueAddingXMLData;
+                                 break;
+                        }
+                    }
+                    else /* we couldn't find the end of the directive*/
+                    {
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                        /* at this point if we were parsing mixed content and we didn't find a markup, we shall consume what we have */
+                        if(pstrParserInstanceType->u8InputSourceDepth > 0U)
+                        {
+                            LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, LwXMLP_u32GetReadyData(pstrParserInstanceType));
+                            objenumParserStatusType                  = csParserError;
+                            pstrParserInstanceType->objenumErrorType = csMissingEndOfEntity;
+                        }
+                        else
+                        {
+                            objenumParserStatusType = csContinueAddingXMLData;
+                            LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "There is no data for parsing");
+                        }
+#else
+                        objenumParserStatusType = csContinueAddingXMLData;
+                        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "There is no data for parsing");
+#endif
+                    }
+                }
+                else
+                {
+                    objenumParserStatusType = csParserError;
+                }
+            }
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+            else if((pstrParserInstanceType->bParsingDTDInProgress == STD_TRUE) && \
+                    (pstrParserInstanceType->u8InputSourceDepth == 0U))
+            {
+                pstrParserInstanceType->objenumErrorType = csNoError;
+                pstrParserInstanceType->objenumErrorType = csDTDMissingPortionError;
+                LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "DTD is missing portion");
+            }
+#endif
+            else
+            {
+                /* grab what ever is in-between '<' and '>' and put it in s8XMLBuffer*/
+                LwXMLP_vLoadTagToBuffer(pstrParserInstanceType);
+                if(pstrParserInstanceType->objenumErrorType == csNoError)
+                {
+                    if(pstrParserInstanceType->bTagCloserIsFound == STD_TRUE)
+                    {
+                        /* the TAG start or end are currently loaded to the working buffer */
+                        switch(pstrParserInstanceType->objenumTagTypeType)
+                        {
+                            case csStartTagType:
+                                 if(pstrParserInstanceType->bReachXMLEnd == STD_FALSE)
+                                 {
+                                     LwXMLP_vUpdatePathWithStartTag(pstrParserInstanceType);
+                                     /* consume the read TAG */
+                                     LwXMLP_vConsumeTag(pstrParserInstanceType);
+                                     if(pstrParserInstanceType->objenumErrorType == csNoError)
+                                     {
+                                         pstrParserInstanceType->objenumXMLEventTypes = csStartElementEvent;
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                                         if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
+                                         {
+#endif
+                                             srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
+                                             if(srStatus == E_OK)
+                                             {
+                                                 objenumParserStatusType = csContinueParsingXMLData;
+                                             }
+                                             else
+                                             {
+                                                 /*Terminate XML reception due to error at the user side*/
+                                                 objenumParserStatusType                  = csParserError;
+                                                 pstrParserInstanceType->objenumErrorType = csCallBackErrorOnStartElement;
+                                             }
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                                         }
+                                         else
+                                         {
+                                             objenumParserStatusType = csContinueParsingXMLData;
+                                         }
+#endif
+                                     }
+                                     else
+                                     {
+                                         /*Terminate XML reception due to error at the user side*/
+                                         objenumParserStatusType = csParserError;
+                                     }
+                                 }
+                                 else
+                                 {
+                                     pstrParserInstanceType->objenumErrorType = csExtraContentAtTheEnd;
+                                     objenumParserStatusType                  = csParserError;
+                                 }
+                                 break;
+                            case csEndTagType:
+                                 pstrParserInstanceType->objenumXMLEventTypes = csEndElementEvent;
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                                 if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
+                                 {
+#endif
+                                     srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
+                                     if(srStatus == E_OK)
+                                     {
+                                         LwXMLP_vRemoveTagfromPath(pstrParserInstanceType);
+                                         /* consume the read TAG */
+                                         LwXMLP_vConsumeTag(pstrParserInstanceType);
+                                         if(pstrParserInstanceType->objenumErrorType == csNoError)
+                                         {
+                                             if(LwXMLP_bXMLPathIsEmpty(pstrParserInstanceType) == STD_TRUE)
+                                             {
+                                                 pstrParserInstanceType->bReachXMLEnd = STD_TRUE;
+                                                 /* check for extra content at the end of the document */
+                                                 if(LwXMLP_bMoreCharacterAtEndOfXML(pstrParserInstanceType) == STD_TRUE)
+                                                 {/* The only allowed content at the end of the XML document is PI and comment */
+                                                     LwXMLP_vCheckTagForDirective(pstrParserInstanceType);
+                                                     if((pstrParserInstanceType->objenumErrorType == csNoError)&&
+                                                       (pstrParserInstanceType->bTagContainDirective == STD_TRUE)&&
+                                                       ((pstrParserInstanceType->objenumDirectiveTypeType == csProcessingInstructionMarkup) ||\
+                                                        (pstrParserInstanceType->objenumDirectiveTypeType == csCommentMarkup)))
+                                                     {
+                                                         objenumParserStatusType = csContinueParsingXMLData;
+                                                     }
+                                                     else
+                                                     {
+                                                         objenumParserStatusType                  = csParserError;
+                                                         pstrParserInstanceType->objenumErrorType = csExtraContentAtTheEnd;
+                                                     }
+                                                 }
+                                                 else
+                                                 {
+                                                     objenumParserStatusType = csParsingFinished;
+                                                 }
+                                             }
+                                             else
+                                             {
+                                                 objenumParserStatusType = csContinueParsingXMLData;
+                                             }
+                                         }
+                                         else
+                                         {
+                                             objenumParserStatusType = csParserError;
+                                         }
+                                     }
+                                     else
+                                     {
+                                         /*Terminate XML reception due to error at the user side*/
+                                         objenumParserStatusType = csParserError;
+                                         pstrParserInstanceType->objenumErrorType = csCallBackErrorOnStartElement;
+                                     }
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                                 }
+                                 else
+                                 {
+                                     LwXMLP_vRemoveTagfromPath(pstrParserInstanceType);
+                                     /* consume the read TAG */
+                                     LwXMLP_vConsumeTag(pstrParserInstanceType);
+                                     objenumParserStatusType = csContinueParsingXMLData;
+                                 }
+#endif
+                                 break;
+                            case csEmptyTagType:
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                                 if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
+                                 {
+#endif
+                                     LwXMLP_vUpdatePathWithStartTag(pstrParserInstanceType);
+                                     pstrParserInstanceType->objenumXMLEventTypes = csStartElementEvent;
+                                     srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
+                                     if(srStatus == E_OK)
+                                     {
+                                         pstrParserInstanceType->objenumXMLEventTypes = csEndElementEvent;
+                                         srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
+                                         if(srStatus == E_OK)
+                                         {
+                                             LwXMLP_vRemoveTagfromPath(pstrParserInstanceType);
+                                             if(pstrParserInstanceType->objenumErrorType == csNoError)
+                                             {
+                                                 LwXMLP_vConsumeTag(pstrParserInstanceType);
+                                                 if(LwXMLP_bXMLPathIsEmpty(pstrParserInstanceType) == STD_TRUE)
+                                                 {
+                                                     pstrParserInstanceType->bReachXMLEnd = STD_TRUE;
+                                                     objenumParserStatusType              = csParsingFinished;
+                                                     /* check for extra content at the end of the document */
+                                                     if(LwXMLP_bMoreCharacterAtEndOfXML(pstrParserInstanceType) == STD_TRUE)
+                                                     {/* The only allowed content at the end of the XML document is PI and comment */
+                                                         LwXMLP_vCheckTagForDirective(pstrParserInstanceType);
+                                                         if((pstrParserInstanceType->objenumErrorType == csNoError)&&
+                                                           (pstrParserInstanceType->bTagContainDirective == STD_TRUE)&&
+                                                           ((pstrParserInstanceType->objenumDirectiveTypeType == csProcessingInstructionMarkup) ||\
+                                                            (pstrParserInstanceType->objenumDirectiveTypeType == csCommentMarkup)))
+                                                         {
+                                                             objenumParserStatusType = csContinueParsingXMLData;
+                                                         }
+                                                         else
+                                                         {
+                                                             objenumParserStatusType                  = csParserError;
+                                                             pstrParserInstanceType->objenumErrorType = csExtraContentAtTheEnd;
+                                                         }
+                                                     }
+                                                     else
+                                                     {
+                                                         objenumParserStatusType = csParsingFinished;
+                                                     }
+                                                 }
+                                                 else
+                                                 {
+                                                     objenumParserStatusType = csContinueParsingXMLData;
+                                                 }
+                                             }
+                                             else
+                                             {
+                                                 objenumParserStatusType = csParserError;
+                                             }
+                                         }
+                                         else
+                                         {
+                                             /*Terminate XML reception due to error at the user side*/
+                                             objenumParserStatusType = csParserError;
+                                             pstrParserInstanceType->objenumErrorType = csCallBackErrorOnStartElement;
+                                         }
+                                     }
+                                     else
+                                     {
+                                         /*Terminate XML reception due to error at the user side*/
+                                         objenumParserStatusType = csParserError;
+                                         pstrParserInstanceType->objenumErrorType = csCallBackErrorOnStartElement;
+                                     }
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                                 }
+                                 else
+                                 {
+                                     objenumParserStatusType = csContinueParsingXMLData;
+                                     LwXMLP_vConsumeTag(pstrParserInstanceType);
+                                 }
+#endif
+                                 break;
+                            case csUnkownTagType:
+                            default:
+                                /*Terminate XML reception due to error */
+                                objenumParserStatusType = csParserError;
+                                pstrParserInstanceType->objenumErrorType = csUnexpectedElementType;
+                                break;
+                        }
+                    }
+                    else
+                    {
+                        /* at this point if we were parsing mixed content and we didn't find a markup, we shall consume what we have */
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                        if(pstrParserInstanceType->u8InputSourceDepth > 0U)
+                        {
+                            LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, LwXMLP_u32GetReadyData(pstrParserInstanceType));
+                            objenumParserStatusType = csContinueParsingXMLData;
+                        }
+                        else
+#endif
+                        if(pstrParserInstanceType->bReachXMLEnd == STD_TRUE)
+                        {
+                            objenumParserStatusType = csParsingFinished;
+                        }
+                        else
+                        {
+                            objenumParserStatusType = csContinueAddingXMLData;
+                        }
+                        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "There is no data for parsing");
+                    }
+                }
+                else
+                {
+                    /*Terminate XML reception due to error, The error type will be set by LwXMLP_srLoadTagToBuffer */
+                    objenumParserStatusType = csParserError;
+                }
+            }
+        }
+        else
+        {
+            /*Terminate XML reception due to error, the error type will be set by LwXMLP_srCheckTagForDirective */
+            objenumParserStatusType = csParserError;
+        }
+    }
+
+    return objenumParserStatusType;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT8S const *LwXMLP_ps8GetErrorString(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         It is responsible to return the error string description of the received parser instance
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        Pointer to constant of the error string
+
+@note
+***********************************************************************************************************************/
+INT8S const *LwXMLP_ps8GetErrorString(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    const INT8S *ps8XMLErrorString;
+
+#if(SUPPORT_ERROR_STRING == STD_ON)
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        switch(pstrParserInstanceType->objenumErrorType)
+        {
+            case csInvalidPassingParameter:
+                 ps8XMLErrorString = "the parser received invalid passing parameter";
+                 break;
+            case csInternalError:
+                 ps8XMLErrorString = "Error detected in the internal buffer during parsing";
+                 break;
+            case csFeatureNotSupported:
+                 ps8XMLErrorString = "Feature isn't supported by the parser, it my be disabled by the user";
+                 break;
+            case csAttributeInEndTag:
+                 ps8XMLErrorString = "Attribute in End TAG isn't allowed";
+                 break;
+            case csMissingSeparator:
+                 ps8XMLErrorString = "missing separator in choice";
+                 break;
+            case csInvalidDirectReference:
+                 ps8XMLErrorString = "Direct reference to an entity with &lt;";
+                 break;
+            case csGeneralEntityInDTD:
+                 ps8XMLErrorString = "Found General entity in DTD";
+                 break;
+            case csPartialCharacterReference:
+                 ps8XMLErrorString = "Found Partial Character Reference";
+                 break;
+            case csIncompleteEntityContent:
+                 ps8XMLErrorString = "Incomplete entity content";
+                 break;
+            case csInvalidOperator:
+                 ps8XMLErrorString = "Invalid Operator";
+                 break;
+            case csMissingPITarget:
+                 ps8XMLErrorString = "Missing PI Target ";
+                 break;
+            case csEntityRefereToItself:
+                 ps8XMLErrorString = "It isn't allowed to let the entity to refer to itself";
+                 break;
+            case csMissingEndOfEntity:
+                 ps8XMLErrorString = "Missing End of Entity";
+                 break;
+            case csDTDInvalidDefaultDeclaration:
+                 ps8XMLErrorString = "DTD Invalid Attribute Default Declaration";
+                 break;
+            case csDTDInvalidAttributeType:
+                 ps8XMLErrorString = "DTD Invalid Attribute Type";
+                 break;
+            case csDTDMissingSystemIDError:
+                 ps8XMLErrorString = "DTD is missing System ID";
+                 break;
+            case csInvalidParameterEntity:
+                 ps8XMLErrorString = "DTD Invalid parameter entity";
+                 break;
+            case csDTDMissingPortionError:
+                 ps8XMLErrorString = "DTD is missing portion";
+                 break;
+            case csInvalidAttributeValue:
+                 ps8XMLErrorString = "Invalid Attribute Value";
+                 break;
+            case csInvalidRootToken:
+                 ps8XMLErrorString = "Invalid Token at the root document";
+                 break;
+            case csIllegalWhiteSpace:
+                 ps8XMLErrorString = "Illegal WhiteSpace";
+                 break;
+            case csMissingWhiteSpaceCharacter:
+                 ps8XMLErrorString = "Missing WhiteSpace";
+                 break;
+            case csDTDCapitalPortionError:
+                 ps8XMLErrorString = "DTD small letter portion is used";
+                 break;
+            case csMissingAttributeValue:
+                 ps8XMLErrorString = "Attribute value is missing";
+                 break;
+            case csWrongDirectiveEnd:
+                 ps8XMLErrorString = "Can't find the end of the directive";
+                 break;
+            case csDoubleHyphenInComment:
+                 ps8XMLErrorString = "Double Hyphen inside the comment";
+                 break;
+            case csMissingEqual:
+                 ps8XMLErrorString = "The = is missing between the attribute name and the attribute value";
+                 break;
+            case csMissingQuote:
+                 ps8XMLErrorString = "missing quote";
+                 break;
+            case csQuotesMissmatch:
+                 ps8XMLErrorString = "Quotes miss match";
+                 break;
+            case csInvalidStartNameCharacter:
+                 ps8XMLErrorString = "Invalid Start Name Character";
+                 break;
+            case csInvalidNameCharacter:
+                 ps8XMLErrorString = "Invalid Name Character";
+                 break;
+            case csInvalidPIName:
+                ps8XMLErrorString = "Invalid PI Name";
+                 break;
+            case csInvalidXMLCharacter:
+                 ps8XMLErrorString = "Invalid XML Character";
+                 break;
+            case csCallBackErrorOnPIDirective:
+                 ps8XMLErrorString = "User Callback Error on the Process Instruction";
+                 break;
+            case csCallBackErrorOnStartElement:
+                 ps8XMLErrorString = "User Callback Error on the start TAG";
+                 break;
+            case csCallBackErrorOnData:
+                 ps8XMLErrorString = "User Callback Error on the text node";
+                 break;
+            case csCallBackErrorOnEndElement:
+                ps8XMLErrorString = "User Callback Error on the End element";
+                 break;
+            case csCallBackErrorOnComment:
+                 ps8XMLErrorString = "User Callback Error on the comment";
+                 break;
+            case csUnexpectedElementType:
+                 ps8XMLErrorString = "Unexpected element Type";
+                 break;
+            case csFailedToGetElementInfo:
+                 ps8XMLErrorString = "Failed to Extract element info";
+                 break;
+            case csFailedToAddElementToPath:
+                 ps8XMLErrorString = "Failed to add new element to the Path buffer";
+                 break;
+            case csFailedToExtractAttributes:
+                 ps8XMLErrorString = "Failed to Extract the attributes";
+                 break;
+            case csWrongNesting:
+                ps8XMLErrorString = "Wrong nesting";
+                 break;
+            case csLargeElementLength:
+                 ps8XMLErrorString = "Long element length";
+                 break;
+            case csWrongAttributeFormat:
+                 ps8XMLErrorString = "Missing attribute value";
+                 break;
+            case csWrongDeclarationLocation:
+                 ps8XMLErrorString = "Wrong Declaration Location";
+                 break;
+            case csUnsupportedEncodingScheme:
+                ps8XMLErrorString = "unsupported encoding scheme";
+                 break;
+            case csUnExpectedDirectiveType:
+                 ps8XMLErrorString = "Received unexpected directive type";
+                 break;
+            case csNoError:
+                 ps8XMLErrorString = "No Error";
+                 break;
+            case csEncodingError:
+                 ps8XMLErrorString = "problem occurred during encoding XML portion";
+                 break;
+            case csMissingSemicolon:
+                 ps8XMLErrorString = "missing semi-colon from entity reference";
+                 break;
+            case csExtraContentAtTheEnd:
+                 ps8XMLErrorString = "Extra content at the end of the document";
+                 break;
+            case csRepeatedAttributeName:
+                 ps8XMLErrorString = "Repeated attribute Name";
+                 break;
+            case csInvalidSDeclOrder:
+                 ps8XMLErrorString = "Invalid SDecl Order";
+                 break;
+            case csLargeResolvingTrialsProperty:
+                 ps8XMLErrorString = "More entities need to be resolved, increase MAX_ENTITY_RESOLVING_TRIALS";
+                 break;
+            case csLargeChildrenOperatorsProperty:
+                 ps8XMLErrorString = "Can't process all received attributes, increase MAX_OPERATORS_COUNT";
+                 break;
+            case csLargeNumberOfAttributes:
+                 ps8XMLErrorString = "Can't process all received attributes, increase MAX_NUMBER_OF_ATTRIBUTES";
+                 break;
+            case csLargeElementProperty:
+                 ps8XMLErrorString = "Can't load the element into working buffer, increase MAX_CIRCULAR_BUFFER_SIZE & MAX_WORKING_BUFFER_SIZE";
+                 break;
+            case csLargeDatalength:
+                 ps8XMLErrorString = "Can't load the data into working buffer, increase MAX_CIRCULAR_BUFFER_SIZE & MAX_WORKING_BUFFER_SIZE";
+                 break;
+            case csLargeDTDPortionlength:
+                 ps8XMLErrorString = "Can't load the DTD portion into working buffer, increase MAX_CIRCULAR_BUFFER_SIZE & MAX_WORKING_BUFFER_SIZE";
+                 break;
+            case csLargeDirectiveProperty:
+                 ps8XMLErrorString = "Can't load the Directive into working buffer, increase MAX_CIRCULAR_BUFFER_SIZE & MAX_WORKING_BUFFER_SIZE";
+                 break;
+            case csLargeAttributeNameProperty:
+                 ps8XMLErrorString = "Can't load attribute name, increase MAX_ATTRIBUTES_NAME_LENGTH";
+                 break;
+            case csLargeElementNameProperty:
+                 ps8XMLErrorString = "Can't load element name, increase MAX_ELEMENT_NAME_LENGTH";
+                 break;
+            case csLargeEntityCountProperty:
+                 ps8XMLErrorString = "Can't load entity, increase MAX_ENTITIES";
+                 break;
+            case csLargeEntityNameProperty:
+                 ps8XMLErrorString = "Can't load entity name, increase MAX_ENTITY_ARENA_SIZE";
+                 break;
+            case csLargeEntityValueProperty:
+                 ps8XMLErrorString = "Can't load entity value, increase MAX_ENTITY_ARENA_SIZE";
+                 break;
+            case csLargeNumberOfAttributeList:
+                 ps8XMLErrorString = "Can't load Attribute list declarations, increase MAX_ATTRIBUTES_LIST";
+                 break;
+            case csDataWithoutStartTag:
+                 ps8XMLErrorString = "Found data without being included in a start TAG";
+                 break;
+            case csInvalidReference:
+                 ps8XMLErrorString = "Invalid Reference";
+                 break;
+            case csInvalidVersionOrder:
+                 ps8XMLErrorString = "Invalid Version Attribute Order";
+                 break;
+            case csParsedEntityError:
+                 ps8XMLErrorString = "Parsed entity isn't well-formed";
+                 break;
+            case csPEReferencesinInInternalSubset:
+                 ps8XMLErrorString = "PEReferences forbidden in internal subset";
+                 break;
+            case csEncodingDiscrepancy:
+                 ps8XMLErrorString = "The parser detected Discrepancy between BOM and encoding type in deceleration";
+                 break;
+            case csEntityExpansionBudgetExceeded:
+                 ps8XMLErrorString = "The expansion of the entities exceeded the budget of the parser instance";
+                 break;
+            case csDTDTablesExhausted:
+                 ps8XMLErrorString = "There are no free DTD tables to hold the declarations of the document";
+                 break;
+            case csMaximumXMLError:
+            default:
+                 ps8XMLErrorString = "Unknown Error";
+                 break;
+        }
+    }
+    else
+    {
+        ps8XMLErrorString = "The parser received invalid passing parameter";
+    }
+#else
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        ps8XMLErrorString = "Error String isn't supported";
+    }
+    else
+    {
+        ps8XMLErrorString = "The parser received invalid passing parameter";
+    }
 #endif
-                        pstrParserInstanceType->objenumXMLEventTypes = csTextNodeEvent;
+    return (ps8XMLErrorString);
+}
+/**********************************************************************************************************************/
+/*!\fn         INT32U LwXMLP_u32GetLineOfError(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         It is responsible to return the line number where the error is occurred for the received parser
+               instance
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        The line number where the error is occurred or,
+@return        0: if the pstrParserInstanceType is received incorrectly STD_NULL
+
+@note
+***********************************************************************************************************************/
+INT32U LwXMLP_u32GetLineOfError(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    INT32U u32LineNumber;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        u32LineNumber = pstrParserInstanceType->u32LineNumber;
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                        if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
-                        {
+        if(pstrParserInstanceType->u8InputSourceDepth > 0U)
+        {/* the error is reported at the reference of the outermost entity */
+            u32LineNumber = pstrParserInstanceType->objstrInputSourceType[0U].u32ResumeLineNumber;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
 #endif
-                            srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
-                            if(srStatus == E_OK)
-                            {
-                                objenumParserStatusType = csContinueParsingXMLData;
-                            }
-                            else
-                            {
-                                /*Terminate XML reception due to error at the user side*/
-                                objenumParserStatusType                  = csParserError;
-                                pstrParserInstanceType->objenumErrorType = csCallBackErrorOnData;
-                            }
+    }
+    else
+    {
+        u32LineNumber = 0U;
+    }
+
+    return (u32LineNumber);
+}
+/**********************************************************************************************************************/
+/*!\fn         INT32U LwXMLP_u32GetCoulmnOfError(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         This API is responsible to return the column number where the error is occurred for the received parser
+               instance
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        The line number where the error is occurred or,
+@return        0: if the pstrParserInstanceType is received incorrectly STD_NULL
+
+@note
+***********************************************************************************************************************/
+INT32U LwXMLP_u32GetCoulmnOfError(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    INT32U u32CoulmnNumber;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        u32CoulmnNumber = pstrParserInstanceType->u32CoulmnNumber;
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                        }
-                        else
-                        {
-                            objenumParserStatusType = csContinueParsingXMLData;
-                        }
+        if(pstrParserInstanceType->u8InputSourceDepth > 0U)
+        {/* the error is reported at the reference of the outermost entity */
+            u32CoulmnNumber = pstrParserInstanceType->objstrInputSourceType[0U].u32ResumeCoulmnNumber;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
 #endif
-                    }
+    }
+    else
+    {
+        u32CoulmnNumber = 0U;
+    }
+
+    return (u32CoulmnNumber);
+}
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                    else if(pstrParserInstanceType->bSecondLevelBufferEnabled == STD_TRUE)
-                    {
-                        objenumParserStatusType = csContinueParsingXMLData;
-                    }
+/**********************************************************************************************************************/
+/*!\fn         StdReturnType LwXMLP_srSetExpansionBudget(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                         INT32U                          u32MaxExpandedBytes, \
+                                                         INT32U                          u32MaxExpansionRatio, \
+                                                         INT8U                           u8MaxExpansionDepth)
+
+@brief         It is responsible to set the budget of the entity expansion for the received parser instance, the
+               budget bounds the work of the expansion per received byte of an untrusted document
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@param[in]     u32MaxExpandedBytes       : the maximum number of the entity value bytes which can be scanned
+
+@param[in]     u32MaxExpansionRatio      : the maximum ratio between the scanned entity value bytes and the received
+                                           document bytes, it is checked after ENTITY_EXPANSION_RATIO_THRESHOLD bytes
+                                           are scanned, 0 disables the ratio check
+
+@param[in]     u8MaxExpansionDepth       : the maximum number of the nested entity values, from 1 to
+                                           MAX_ENTITY_RESOLVING_DEPTH
+
+@return        E_OK    : if the budget is set
+@return        E_NOT_OK: if one of the passing parameters is invalid
+
+@note          The budget shall be set after the initialization of the instance, otherwise the defaults
+               MAX_ENTITY_EXPANSION_BYTES, MAX_ENTITY_EXPANSION_RATIO and MAX_ENTITY_RESOLVING_DEPTH are used, if the
+               budget is exceeded the parsing is stopped by the error csEntityExpansionBudgetExceeded
+***********************************************************************************************************************/
+StdReturnType LwXMLP_srSetExpansionBudget(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                          INT32U                          u32MaxExpandedBytes, \
+                                          INT32U                          u32MaxExpansionRatio, \
+                                          INT8U                           u8MaxExpansionDepth)
+{
+    StdReturnType srSetBudgetStatus;
+
+    if((pstrParserInstanceType != STD_NULL) && (u8MaxExpansionDepth > 0U) && \
+       (u8MaxExpansionDepth <= MAX_ENTITY_RESOLVING_DEPTH) && \
+       (u32MaxExpandedBytes >= pstrParserInstanceType->u32ExpandedBytes))
+    {
+        pstrParserInstanceType->u32MaxExpandedBytes  = u32MaxExpandedBytes;
+        pstrParserInstanceType->u32MaxExpansionRatio = u32MaxExpansionRatio;
+        pstrParserInstanceType->u8MaxExpansionDepth  = u8MaxExpansionDepth;
+        srSetBudgetStatus = E_OK;
+    }
+    else
+    {
+        srSetBudgetStatus = E_NOT_OK;
+    }
+
+    return srSetBudgetStatus;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT32U LwXMLP_u32GetExpandedBytes(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         This API is responsible to return the number of the entity value bytes which are scanned since the
+               initialization of the instance, a value is counted once for every reference which is expanded
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        The number of the scanned entity value bytes or,
+@return        0: if the pstrParserInstanceType is received incorrectly STD_NULL
+
+@note
+***********************************************************************************************************************/
+INT32U LwXMLP_u32GetExpandedBytes(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    INT32U u32ExpandedBytes;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        u32ExpandedBytes = pstrParserInstanceType->u32ExpandedBytes;
+    }
+    else
+    {
+        u32ExpandedBytes = 0U;
+    }
+
+    return (u32ExpandedBytes);
+}
+/**********************************************************************************************************************/
+/*!\fn         INT32U LwXMLP_u32GetExpandedReferences(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         This API is responsible to return the number of the entity references which are expanded since the
+               initialization of the instance
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        The number of the expanded entity references or,
+@return        0: if the pstrParserInstanceType is received incorrectly STD_NULL
+
+@note
+***********************************************************************************************************************/
+INT32U LwXMLP_u32GetExpandedReferences(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    INT32U u32ExpandedReferences;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        u32ExpandedReferences = pstrParserInstanceType->u32ExpandedReferences;
+    }
+    else
+    {
+        u32ExpandedReferences = 0U;
+    }
+
+    return (u32ExpandedReferences);
+}
 #endif
-                    else
-                    {
-                        objenumParserStatusType                  = csParserError;
-                        pstrParserInstanceType->objenumErrorType = csDataWithoutStartTag;
-                    }
-                    bStopLookingForData = STD_TRUE;
-                }
-                else
-                {/* No Data or markup is found */
-                    /*
-                     * check if we reach the end of the XML and there is no more markup for parsing
-                     */
-                    if(pstrParserInstanceType->bReachXMLEnd == STD_TRUE)
-                    {
-                        pu8CurrentCharacter = LwXMLP_pu8GetCurrentCharacter(pstrParserInstanceType);
-                        if(LwXMLP_bIsLessThanCharacter(pu8CurrentCharacter) == STD_FALSE)
-                        {
-                            objenumParserStatusType = csParsingFinished;
-                        }
-                        else
-                        {
-                            objenumParserStatusType = csContinueAddingXMLData;
-                        }
-                    }
-                    else
-                    {
-                        objenumParserStatusType = csContinueAddingXMLData;
-                    }
-                    bStopLookingForData     = STD_TRUE;
-                }
-            }
-            else
-            {
-                /*Terminate XML reception due to error */
-                objenumParserStatusType = csParserError;
-                bStopLookingForData     = STD_TRUE;
-            }
+#if(ENABLE_DTD_CACHE == STD_ON)
+/**********************************************************************************************************************/
+/*!\fn         INT32U LwXMLP_u32SerializeDTDCache(INT8U *pu8Buffer, INT32U u32BufferSize)
+
+@brief         This API is responsible to copy the valid entries of the DTD cache to a buffer, so the application can
+               store it (e.g. on the disk) and load it by LwXMLP_srLoadDTDCache at the next start up
+
+@param[out]    pu8Buffer                 : the buffer to be loaded with the entries, STD_NULL to get the needed size
+@param[in]     u32BufferSize             : the size of pu8Buffer
+
+@return        The number of the bytes written to the buffer or needed by it if pu8Buffer is STD_NULL or,
+@return        0: if the buffer is too small
+
+@note          The buffer is only valid for the same build configuration of the library, and the API shall not be
+               invoked while any instance parses an internal DTD subset
+***********************************************************************************************************************/
+INT32U LwXMLP_u32SerializeDTDCache(INT8U *pu8Buffer, INT32U u32BufferSize)
+{
+    INT32U                      u32DTDCacheHeader[DTD_CACHE_HEADER_WORDS];
+    INT32U                      u32SerializedLength, u32ValidEntries = 0U;
+    INT8U                       u8EntryIndex;
+    strDTDCacheEntryType const *pstrDTDCacheEntryType;
+
+    LwXMLP_mEnterDTDCriticalSection();
+    for(u8EntryIndex = 0U; u8EntryIndex < MAX_DTD_CACHE_ENTRIES; u8EntryIndex++)
+    {
+        if(objstrDTDCacheType.objstrDTDCacheEntryType[u8EntryIndex].objenumDTDCacheEntryStateType == csDTDCacheEntryValid)
+        {
+            u32ValidEntries++;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+    }
+    u32DTDCacheHeader[0] = DTD_CACHE_MAGIC_NUMBER;
+    u32DTDCacheHeader[1] = (INT32U)sizeof(strDTDTablesType);
+    u32DTDCacheHeader[2] = u32ValidEntries;
+    u32SerializedLength  = 0U;
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, &u32SerializedLength, u32DTDCacheHeader, sizeof(u32DTDCacheHeader));
+    for(u8EntryIndex = 0U; u8EntryIndex < MAX_DTD_CACHE_ENTRIES; u8EntryIndex++)
+    {
+        pstrDTDCacheEntryType = &objstrDTDCacheType.objstrDTDCacheEntryType[u8EntryIndex];
+        if(pstrDTDCacheEntryType->objenumDTDCacheEntryStateType == csDTDCacheEntryValid)
+        {
+            LwXMLP_vSerializeDTDCacheEntry(pstrDTDCacheEntryType, pu8Buffer, u32BufferSize, &u32SerializedLength);
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+    }
+    LwXMLP_mExitDTDCriticalSection();
+    if((pu8Buffer != STD_NULL) && (u32SerializedLength > u32BufferSize))
+    {
+        u32SerializedLength = 0U;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+
+    return (u32SerializedLength);
+}
+/**********************************************************************************************************************/
+/*!\fn         StdReturnType LwXMLP_srLoadDTDCache(INT8U const *pu8Buffer, INT32U u32BufferLength)
+
+@brief         This API is responsible to replace the entries of the DTD cache by the entries of a buffer which is
+               filled before by LwXMLP_u32SerializeDTDCache
+
+@param[in]     pu8Buffer                 : the buffer which holds the entries
+@param[in]     u32BufferLength           : the length of the data in pu8Buffer
+
+@return        E_OK: if the entries are loaded or,
+@return        E_NOT_OK: if the buffer isn't valid or there are no free DTD tables for its entries, the DTD cache is
+               emptied in this case
+
+@note          The API shall be invoked at the start up before any instance parses
+***********************************************************************************************************************/
+StdReturnType LwXMLP_srLoadDTDCache(INT8U const *pu8Buffer, INT32U u32BufferLength)
+{
+    INT32U                u32DTDCacheHeader[DTD_CACHE_HEADER_WORDS];
+    INT32U                u32ReadLength = 0U;
+    INT8U                 u8EntryIndex;
+    StdReturnType         srLoadStatus = E_NOT_OK;
+
+    LwXMLP_mEnterDTDCriticalSection();
+    for(u8EntryIndex = 0U; u8EntryIndex < MAX_DTD_CACHE_ENTRIES; u8EntryIndex++)
+    {
+        LwXMLP_vFreeDTDCacheEntry(&objstrDTDCacheType.objstrDTDCacheEntryType[u8EntryIndex]);
+    }
+    objstrDTDCacheType.u8NextEntryIndex = 0U;
+    if((pu8Buffer != STD_NULL) && \
+       (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, &u32ReadLength, u32DTDCacheHeader, sizeof(u32DTDCacheHeader)) == STD_TRUE) && \
+       (u32DTDCacheHeader[0] == DTD_CACHE_MAGIC_NUMBER) && \
+       (u32DTDCacheHeader[1] == (INT32U)sizeof(strDTDTablesType)) && \
+       (u32DTDCacheHeader[2] <= MAX_DTD_CACHE_ENTRIES))
+    {
+        srLoadStatus = E_OK;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    for(u8EntryIndex = 0U; (srLoadStatus == E_OK) && (u8EntryIndex < u32DTDCacheHeader[2]); u8EntryIndex++)
+    {
+        if(LwXMLP_bDeserializeDTDCacheEntry(&objstrDTDCacheType.objstrDTDCacheEntryType[u8EntryIndex], \
+                                            pu8Buffer, u32BufferLength, &u32ReadLength) == STD_FALSE)
+        {
+            srLoadStatus = E_NOT_OK;
         }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+    }
+    if((srLoadStatus == E_OK) && (u32ReadLength == u32BufferLength))
+    {
+        objstrDTDCacheType.u8NextEntryIndex = (INT8U)(u32DTDCacheHeader[2] % MAX_DTD_CACHE_ENTRIES);
     }
-    if(objenumParserStatusType == csUnkownParserStatus)
+    else
     {
-        /*we need to check <> */
-        /*we need to check < */
-        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Parsing the content of <>");
-        LwXMLP_vCheckTagForDirective(pstrParserInstanceType);
-        if(pstrParserInstanceType->objenumErrorType == csNoError)
+        for(u8EntryIndex = 0U; u8EntryIndex < MAX_DTD_CACHE_ENTRIES; u8EntryIndex++)
         {
-            if(pstrParserInstanceType->bTagContainDirective == STD_TRUE)
-            {
-                /* grab what ever is in-between '<' and '>' and put it in s8XMLBuffer*/
-                LwXMLP_vLoadDirectiveToBuffer(pstrParserInstanceType);
-                if(pstrParserInstanceType->objenumErrorType == csNoError)
-                {
-                    if(pstrParserInstanceType->bEndOfDirectiveFound == STD_TRUE)
-                    {
-                        /* the TAG start or end are currently loaded to the working buffer */
-                        switch(pstrParserInstanceType->objenumDirectiveTypeType)
-                        {
-                            case csProcessingInstructionMarkup:
-                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
-#if(ENABLE_PI_WELL_FORM_CHECK == STD_ON)
-                                 LwXMLP_vParsePI(pstrParserInstanceType);
-                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
-                                 {
-                                     pstrParserInstanceType->objenumXMLEventTypes = csProcessInstructionEvent;
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                                     if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
-                                     {
-#endif
-                                         srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
-                                         if(srStatus == E_OK)
-                                         {
-                                             if((LwXMLP_bMoreCharacterAtEndOfXML(pstrParserInstanceType) == STD_FALSE) &&
-                                                (pstrParserInstanceType->bReachXMLEnd == STD_TRUE))
-                                             {
-                                                 objenumParserStatusType = csParsingFinished;
-                                             }
-                                             else
-                                             {
-                                                 objenumParserStatusType = csContinueParsingXMLData;
-                                             }
-                                         }
-                                         else
-                                         {
-                                             /*Terminate XML reception due to error at the user side*/
-                                             objenumParserStatusType                  = csParserError;
-                                             pstrParserInstanceType->objenumErrorType = csCallBackErrorOnPIDirective;
-                                         }
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                                     }
-                                     else
-                                     {
-                                         objenumParserStatusType = csContinueParsingXMLData;
-                                     }
-#endif
-                                 }
-                                 else
-                                 {
-                                     objenumParserStatusType = csParserError;
-                                 }
-#else
-                                 objenumParserStatusType = csContinueParsingXMLData;
-#endif
-                                 break;
-                            case csCommentMarkup:
-                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
-#if(ENABLE_COMMENT_WELL_FORM_CHECK == STD_ON)
-                                 LwXMLP_vCheckWellFormedComment(pstrParserInstanceType);
-#endif
-                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
-                                 {
-                                      pstrParserInstanceType->objenumXMLEventTypes = csCommentEvent;
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                                      if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
-                                      {
-#endif
-                                          srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
-                                          if(srStatus == E_OK)
-                                          {
-                                              if(pstrParserInstanceType->bReachXMLEnd == STD_TRUE)
-                                              {
-                                                  if(LwXMLP_bMoreCharacterAtEndOfXML(pstrParserInstanceType) == STD_FALSE)
-                                                  {
-                                                      objenumParserStatusType = csParsingFinished;
-                                                  }
-                                                  else
-                                                  {
-                                                      objenumParserStatusType = csContinueParsingXMLData;
-                                                  }
-                                              }
-                                              else
-                                              {
-                                                  objenumParserStatusType = csContinueParsingXMLData;
-                                              }
-                                          }
-                                          else
-                                          {
-                                              /*Terminate XML reception due to error at the user side*/
-                                              objenumParserStatusType                  = csParserError;
-                                              pstrParserInstanceType->objenumErrorType = csCallBackErrorOnComment;
-                                          }
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                                      }
-                                      else
-                                      {
-                                          objenumParserStatusType = csContinueParsingXMLData;
-                                      }
-#endif
-                                 }
-                                 else
-                                 {
-                                      objenumParserStatusType = csParserError;
-                                 }
-                                 break;
-                            case csDeclarationMarkup:
-                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
-#if(ENABLE_DECL_WELL_FORM_CHECK == STD_ON)
-                                 LwXMLP_vCheckWellFormedDecl(pstrParserInstanceType);
-                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
-                                 {
-                                     objenumParserStatusType = csContinueParsingXMLData;
-                                 }
-                                 else
-                                 {
-                                     objenumParserStatusType = csParserError;
-                                 }
-#else
-                                 objenumParserStatusType = csContinueParsingXMLData;
-#endif
-                                 break;
-#if(ENABLE_DTD_RECEIPTION == STD_ON)
-                            case csDTDElementMarkup:
-#if(ENABLE_DECL_WELL_FORM_CHECK == STD_ON)
-                                 LwXMLP_vValidateElement(pstrParserInstanceType);
-                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
-                                 {
-                                     objenumParserStatusType = csContinueParsingXMLData;
-                                 }
-                                 else
-                                 {
-                                     objenumParserStatusType = csParserError;
-                                 }
-#else
-                                 objenumParserStatusType = csContinueParsingXMLData;
+            LwXMLP_vFreeDTDCacheEntry(&objstrDTDCacheType.objstrDTDCacheEntryType[u8EntryIndex]);
+        }
+        srLoadStatus = E_NOT_OK;
+    }
+    LwXMLP_mExitDTDCriticalSection();
+
+    return srLoadStatus;
+}
 #endif
-                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
-                                 break;
-                            case csDTDEntitytMarkup:
-                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
-#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
-                                 if(pstrParserInstanceType->bFoundExternalEntity == STD_FALSE)
-                                 {
-                                     LwXMLP_vCheckWellFormedEntity(pstrParserInstanceType);
-                                 }
-                                 else
-                                 {
-                                     /*
-                                      * They must not process entity declarations or attribute-list declarations
-                                      * encountered after a reference to a parameter entity that is not read,
-                                      */
-                                 }
-                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
-                                 {
-                                     objenumParserStatusType = csContinueParsingXMLData;
-                                 }
-                                 else
-                                 {
-                                     objenumParserStatusType = csParserError;
-                                 }
-#else
-                                 objenumParserStatusType = csContinueParsingXMLData;
+#if(ENABLE_PARSER_STATISTICS == STD_ON)
+/**********************************************************************************************************************/
+/*!\fn         INT32U LwXMLP_u32GetTagScannedBytes(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         This API is responsible to return the number of bytes checked by the TAG closer scanner since the
+               parser is initialized
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        The number of checked bytes or,
+@return        0: if the pstrParserInstanceType is received incorrectly STD_NULL
+
+@note          The ratio between this value and LwXMLP_u32GetTagLoadedBytes gives the rescanning amplification of
+               the fragmented input, it is 1 when every byte is checked once
+***********************************************************************************************************************/
+INT32U LwXMLP_u32GetTagScannedBytes(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    INT32U u32ScannedBytes;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        u32ScannedBytes = pstrParserInstanceType->u32TagScannedBytes;
+    }
+    else
+    {
+        u32ScannedBytes = 0U;
+    }
+
+    return (u32ScannedBytes);
+}
+/**********************************************************************************************************************/
+/*!\fn         INT32U LwXMLP_u32GetTagLoadedBytes(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         This API is responsible to return the total length of the TAGs loaded since the parser is initialized
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        The number of loaded TAG bytes or,
+@return        0: if the pstrParserInstanceType is received incorrectly STD_NULL
+
+@note
+***********************************************************************************************************************/
+INT32U LwXMLP_u32GetTagLoadedBytes(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    INT32U u32LoadedBytes;
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+        u32LoadedBytes = pstrParserInstanceType->u32TagLoadedBytes;
+    }
+    else
+    {
+        u32LoadedBytes = 0U;
+    }
+
+    return (u32LoadedBytes);
+}
 #endif
-                                 break;
-                            case csDTDNotationtMarkup:
-#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
-                                 LwXMLP_vValidateNotation(pstrParserInstanceType);
-                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
-                                 {
-#if 0
-                                     pstrParserInstanceType->objenumXMLEventTypes = csNotationEvent;
-                                     srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
-                                     if(srStatus == E_OK)
-                                     {
-                                         objenumParserStatusType = csContinueParsingXMLData;
-                                     }
-                                     else
-                                     {
-                                         /*Terminate XML reception due to error at the user side*/
-                                         objenumParserStatusType                  = csParserError;
-                                         pstrParserInstanceType->objenumErrorType = csCallBackErrorOnData;
-                                     }
+
+/*
+********************************************************************************************************************
+************************************************************************************************************************
+*                                               L O C A L   F U N C T I O N S
+************************************************************************************************************************
+********************************************************************************************************************
+*/
+/**********************************************************************************************************************/
+/*!\fn         StdReturnType LwXMLP_srReleaseStaticInstance(LwXMLP_strXMLParseInstanceType  const *pstrParserInstanceType)
+
+@brief         This API is responsible to release the statically allocated instance
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        E_NOT_OK: if the release process is failed
+               E_OK    : if the release process is succeeded
+
+@note
+***********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*!\fn         LwXMLP_strXMLParseInstanceType  *LwXMLP_pstrGetStaticInstance(void)
+
+@brief         This API is responsible to get a free instance and if it is found, it will be marked as reversed not
+               to be used by other caller and it will be failed if there is no available static instances
+
+@return        STD_NULL:                       if there is no free instances
+               LwXMLP_strXMLParseInstanceType: pointer to the allocated instance if there is a free instance
+
+@note          the upper layer caller shall fail and not to continue the parsing process if this API returned STD_NULL
+***********************************************************************************************************************/
+
+#if(ALLOCATION_TYPE == INTERNAL_STATIC_ALLOCATION)
+static StdReturnType LwXMLP_srReleaseStaticInstance(LwXMLP_strXMLParseInstanceType  const *pstrParserInstanceType)
+{
+    INT8U         u8FreeInstanceIndex;
+    StdReturnType srReleaseStatus = E_NOT_OK; /* Assume that the release process is failed */
+
+
+    for(u8FreeInstanceIndex = 0; u8FreeInstanceIndex < TOTAL_STATIC_XML_INSTANCES; u8FreeInstanceIndex++)
+    {
+        if(&objstrStaticInstancesArray[u8FreeInstanceIndex].objstrXMLParseInstanceType == pstrParserInstanceType)
+        {
+            objstrStaticInstancesArray[u8FreeInstanceIndex].bReserevedInstance = STD_FALSE;
+            srReleaseStatus                                                    = E_OK;
+            pstrParserInstanceType                                             = STD_NULL;
+            break;
+        }
+    }
+
+    return srReleaseStatus;
+}
+static LwXMLP_strXMLParseInstanceType  *LwXMLP_pstrGetStaticInstance(void)
+{
+    INT8U                           u8FreeInstanceIndex;
+    LwXMLP_strXMLParseInstanceType *pstrXMLParseInstanceType = STD_NULL;
+
+    for(u8FreeInstanceIndex = 0; u8FreeInstanceIndex < TOTAL_STATIC_XML_INSTANCES; u8FreeInstanceIndex++)
+    {
+        if(objstrStaticInstancesArray[u8FreeInstanceIndex].bReserevedInstance == STD_FALSE)
+        {
+            pstrXMLParseInstanceType = &objstrStaticInstancesArray[u8FreeInstanceIndex].objstrXMLParseInstanceType;
+            objstrStaticInstancesArray[u8FreeInstanceIndex].bReserevedInstance = STD_TRUE;
+            break;
+        }
+    }
+
+    return pstrXMLParseInstanceType;
+}
 #endif
-                                     objenumParserStatusType = csContinueParsingXMLData;
-                                 }
-                                 else
-                                 {
-                                     objenumParserStatusType = csParserError;
-                                 }
-#else
-                                 objenumParserStatusType = csContinueParsingXMLData;
+/**********************************************************************************************************************/
+/*!\fn         StdReturnType LwXMLP_srInitParserObject(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType,\
+                                                       LwXLMP_psrFuncCallBackType      objpsrFuncCallBackType)
+
+@brief         This API is responsible to initialize the parser instance with the proper initial value for its members
+
+@param[in,out]     pstrParserInstanceType    : pointer to the XML instance to get the current info and to be loaded
+                                               with the initial value
+
+@param[in]         objpsrFuncCallBackType    : pointer to the call back function assigned by upper layer
+
+
+@return        E_NOT_OK: if the initialization process is failed, and it will fail if the upper layer passed STD_NULL
+                         pointer in the parser instance
+               E_OK    : if the initialization process is succeeded
+
+@note          the upper layer caller shall fail and not to continue the parsing process if this API returned STD_NULL
+***********************************************************************************************************************/
+static StdReturnType LwXMLP_srInitParserObject(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType,\
+                                                      LwXLMP_psrFuncCallBackType      objpsrFuncCallBackType)
+{
+    StdReturnType srInitParserStatusObject;
+#if(ENABLE_NAME_INTERNING == STD_ON)
+    INT32U        u32Slot;
 #endif
-                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
-                                 break;
-                            case csDTDAttlistMarkup:
-#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
-                                 if(pstrParserInstanceType->bFoundExternalEntity == STD_FALSE)
-                                 {
-                                     LwXMLP_vValidateAttributeList(pstrParserInstanceType);
-                                 }
-                                 else
-                                 {
-                                     /*
-                                      * They must not process entity declarations or attribute-list declarations
-                                      * encountered after a reference to a parameter entity that is not read,
-                                      */
-                                 }
-                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
-                                 {
-                                     objenumParserStatusType = csContinueParsingXMLData;
-                                 }
-                                 else
-                                 {
-                                     objenumParserStatusType = csParserError;
-                                 }
+
+    if(pstrParserInstanceType != STD_NULL)
+    {
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_ON)
+        srInitParserStatusObject                         = LwXMLP_srMapCircularBuffer(pstrParserInstanceType);
 #else
-                                 objenumParserStatusType = csContinueParsingXMLData;
+        srInitParserStatusObject                         = E_OK;
+        pstrParserInstanceType->pu8CircularBufferStart   = pstrParserInstanceType->u8XMLCircularBuffer;
 #endif
-                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
-                                 break;
-                            case csInternalDTDMarkup:
-                            case csExternalDTDMarkup:
-                            case csDTDMarkup:
-                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
-#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
-                                 LwXMLP_vValidateDTD(pstrParserInstanceType);
-                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
-                                 {
-                                     objenumParserStatusType = csContinueParsingXMLData;
-                                 }
-                                 else
-                                 {
-                                     objenumParserStatusType = csParserError;
-                                 }
-#else
-                                 objenumParserStatusType = csContinueParsingXMLData;
+        pstrParserInstanceType->u32FreeLocations         = MAX_CIRCULAR_BUFFER_SIZE;
+        pstrParserInstanceType->pu8LastParserLocation    = pstrParserInstanceType->pu8CircularBufferStart;
+        pstrParserInstanceType->pu8CircularBufferHead    = pstrParserInstanceType->pu8CircularBufferStart;
+        pstrParserInstanceType->pu8CircularBufferEnd     = &pstrParserInstanceType->pu8CircularBufferStart[MAX_CIRCULAR_BUFFER_SIZE];
+        pstrParserInstanceType->objpsrFuncCallBackType   = objpsrFuncCallBackType;
+        pstrParserInstanceType->u32CoulmnNumber          = 1U;
+        pstrParserInstanceType->u32LineNumber            = 1U;
+        pstrParserInstanceType->objenumXMLCheckStateType = csBOMChecking;
+        pstrParserInstanceType->objenumEncodingTypeType  = csEncoding_NONE;
+        pstrParserInstanceType->u8XMLPathBuffer[0]       = 0U;
+        pstrParserInstanceType->u32PathLength            = 0U;
+        pstrParserInstanceType->u32ElementDepth          = 0U;
+        pstrParserInstanceType->objenumXMLEventTypes     = csUnkownEvent;
+#if(ENABLE_NAME_INTERNING == STD_ON)
+        pstrParserInstanceType->u32InternedNameCount     = 0U;
+        for(u32Slot = 0U; u32Slot < NAME_ID_HASH_TABLE_SIZE; u32Slot++)
+        {
+            pstrParserInstanceType->s16NameIdHashTable[u32Slot] = -1;
+        }
 #endif
-                                 break;
-#else
-                            case csDTDMarkup:
-                                 /*
-                                  * Nothing to do
-                                  */
-                                 break;
+        pstrParserInstanceType->bEndOfDataIsFound        = STD_FALSE;
+        pstrParserInstanceType->bBOMIsChecked            = STD_FALSE;
+        pstrParserInstanceType->u32ReservedLength        = 0U;
+#if(ENABLE_ENCODING == STD_ON)
+        pstrParserInstanceType->u32StagedInputLength     = 0U;
 #endif
-                            case csCDATAMarkup:
-#if(ENABLE_CDATA_WELL_FORM_CHECK == STD_ON)
-                                 LwXMLP_vCheckWellFormedCDATA(pstrParserInstanceType);
-                                 if(pstrParserInstanceType->objenumErrorType == csNoError)
-                                 {
-                                     pstrParserInstanceType->objenumXMLEventTypes = csCDataEvent;
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                                     if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
-                                     {
+        pstrParserInstanceType->bEndOfDirectiveFound     = STD_FALSE;
+        pstrParserInstanceType->bTagContainDirective     = STD_FALSE;
+        pstrParserInstanceType->objenumErrorType         = csNoError;
+        pstrParserInstanceType->s16AttributeCounts       = 0;
+        pstrParserInstanceType->u32CurrentTagLength      = 0U;
+        pstrParserInstanceType->pu8TagBuffer             = pstrParserInstanceType->u8XMLworkingBuffer;
+        pstrParserInstanceType->u32DirectiveLength       = 0U;
+        LwXMLP_vResetDirectiveScanner(pstrParserInstanceType);
+        LwXMLP_vResetTagScanner(pstrParserInstanceType);
+#if(ENABLE_PARSER_STATISTICS == STD_ON)
+        pstrParserInstanceType->u32TagScannedBytes       = 0U;
+        pstrParserInstanceType->u32TagLoadedBytes        = 0U;
 #endif
-                                         if(pstrParserInstanceType->u32PathLength != 0U)
-                                         {
-#if(ENABLE_EOL_NORMALIZATION == STD_ON)
-                                             LwXMLP_vNormalizeEndOfLine(pstrParserInstanceType->pu8ParsedDataBuffer);
+        pstrParserInstanceType->u32ParsedLength          = 0U;
+        pstrParserInstanceType->bReachXMLEnd             = STD_FALSE;
+#if(ENABLE_DTD_RECEIPTION == STD_ON)
+        pstrParserInstanceType->bParsingDTDInProgress      = STD_FALSE;
 #endif
-                                             srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
-                                             if(srStatus == E_OK)
-                                             {
-                                                 objenumParserStatusType = csContinueParsingXMLData;
-                                             }
-                                             else
-                                             {
-                                                 /*Terminate XML reception due to error at the user side*/
-                                                 objenumParserStatusType                  = csParserError;
-                                                 pstrParserInstanceType->objenumErrorType = csCallBackErrorOnData;
-                                             }
-                                         }
-                                         else
-                                         {
-                                             objenumParserStatusType                  = csParserError;
-                                             pstrParserInstanceType->objenumErrorType = csInvalidRootToken;
-                                         }
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                                     }
-                                     else
-                                     {
-                                         objenumParserStatusType = csContinueParsingXMLData;
-                                     }
+#if(ENABLE_DTD_TABLES == STD_ON)
+        LwXMLP_mEnterDTDCriticalSection();
+        if(objstrEmptyDTDTablesType.u16ReferenceCount == 0U)
+        {/* the empty tables hold a reference to themselves, so they are never owned by an instance */
+            LwXMLP_vResetDTDTables(&objstrEmptyDTDTablesType);
+            objstrEmptyDTDTablesType.u16ReferenceCount = 1U;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+        objstrEmptyDTDTablesType.u16ReferenceCount++;
+        LwXMLP_mExitDTDCriticalSection();
+        pstrParserInstanceType->pstrDTDTablesType = &objstrEmptyDTDTablesType;
 #endif
-                                 }
-                                 else
-                                 {
-                                     objenumParserStatusType = csParserError;
-                                 }
-#else
-                                 objenumParserStatusType = csContinueParsingXMLData;
+        pstrParserInstanceType->bStandAloneDocument        = STD_FALSE;
+        pstrParserInstanceType->bFoundExternalEntity       = STD_FALSE;
+#if(ENABLE_DTD_CACHE == STD_ON)
+        pstrParserInstanceType->objenumDTDCacheStateType   = csDTDCacheIdle;
 #endif
-                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32DirectiveLength); /* consume Directive */
-                                 break;
-                            default:
-                                 objenumParserStatusType = csContinueAddingXMLData;
-                                 break;
-                        }
-                    }
-                    else /* we couldn't find the end of the directive*/
-                    {
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                        /* at this point if we were parsing mixed content and we didn't find a markup, we shall consume what we have */
-                        if(pstrParserInstanceType->bSecondLevelBufferEnabled == STD_TRUE)
-                        {
-                            LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32SecondLevelReadyAmount);
-                            objenumParserStatusType                  = csParserError;
-                            pstrParserInstanceType->objenumErrorType = csMissingEndOfEntity;
-                        }
-                        else
-                        {
-                            objenumParserStatusType = csContinueAddingXMLData;
-                            LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "There is no data for parsing");
-                        }
+        pstrParserInstanceType->bParserSilentModeIsEnabled = STD_FALSE;
+        pstrParserInstanceType->u8InputSourceDepth         = 0U;
+        pstrParserInstanceType->u32LastReferenceLine       = 0U;
+        pstrParserInstanceType->u32LastReferenceColumn     = 0U;
+        pstrParserInstanceType->u32ExpandedBytes           = 0U;
+        pstrParserInstanceType->u32ExpandedReferences      = 0U;
+        pstrParserInstanceType->u32ReceivedBytes           = 0U;
+        pstrParserInstanceType->u32MaxExpandedBytes        = MAX_ENTITY_EXPANSION_BYTES;
+        pstrParserInstanceType->u32MaxExpansionRatio       = MAX_ENTITY_EXPANSION_RATIO;
+        pstrParserInstanceType->u8MaxExpansionDepth        = MAX_ENTITY_RESOLVING_DEPTH;
+#endif
+    }
+    else
+    {
+        srInitParserStatusObject = E_NOT_OK;
+    }
+
+    return srInitParserStatusObject;
+
+}
+/**********************************************************************************************************************/
+/*!\fn         void LwXMLP_vCopy(INT8U *pu8Destination, INT8U const *pu8Source, INT32U u32Length)
+
+@brief         This API is helper function to do copy from source to destination with specific length
+
+@param[in]     pu8Destination            : the pointer to destination location
+
+@param[in]     pu8Source                 : the pointer to source location
+
+@param[in]     u32Length                 : the length of the required data to be copied in bytes
+
+@return
+
+@note
+***********************************************************************************************************************/
+static void LwXMLP_vCopy(INT8U *pu8Destination, INT8U const *pu8Source, INT32U u32Length)
+{
+    memcpy(pu8Destination, pu8Source, u32Length);
+}
+/**********************************************************************************************************************/
+/*!\fn         INT32U LwXMLP_u32GetReadyData(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+@brief         This API return the available length of XML document for parsing
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@return        the number of bytes of the available length of XML document for parsing
+
+@note
+***********************************************************************************************************************/
+static INT32U LwXMLP_u32GetReadyData(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    INT32U u32ReadyAmount;
+
+    /* while an entity value is parsed, the free locations are counted against its length */
+    u32ReadyAmount = MAX_CIRCULAR_BUFFER_SIZE - pstrParserInstanceType->u32FreeLocations;
+    return u32ReadyAmount;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT8U const *LwXMLP_pu8GetReadyCharacter(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                         INT32U                                u32Offset)
+
+@brief         This API return the location of the ready character which is far from the last parser location by
+               u32Offset, taking the wrapping of the circular buffer into account
+
+@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+
+@param[in]     u32Offset                 : the offset of the character, it shall be less than the ready data
+
+@return        pointer to the character
+
+@note
+***********************************************************************************************************************/
+static INT8U const *LwXMLP_pu8GetReadyCharacter(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                INT32U                                u32Offset)
+{
+    INT8U const *pu8Character;
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_ON)
+
+    /* the ready data never exceeds the circular buffer size, so it is reached through the second view */
+    pu8Character = &pstrParserInstanceType->pu8LastParserLocation[u32Offset];
 #else
-                        objenumParserStatusType = csContinueAddingXMLData;
-                        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "There is no data for parsing");
+    INT32U       u32FirstSegmentLength;
+
+    u32FirstSegmentLength = (INT32U)(pstrParserInstanceType->pu8CircularBufferEnd - \
+                                     pstrParserInstanceType->pu8LastParserLocation);
+    if(u32Offset < u32FirstSegmentLength)
+    {
+        pu8Character = &pstrParserInstanceType->pu8LastParserLocation[u32Offset];
+    }
+    else
+    {
+        pu8Character = &pstrParserInstanceType->pu8CircularBufferStart[u32Offset - u32FirstSegmentLength];
+    }
 #endif
-                    }
-                }
-                else
-                {
-                    objenumParserStatusType = csParserError;
-                }
+
+    return pu8Character;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT8U LwXMLP_u8CheckBOM(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType,\
+                                      const INT8U                          *pu8XMLPortion, \
+                                            INT32U                          u32XMLPortionSize)
+
+@brief         This API check the available BOM in the XML document
+
+@param[in,out]     pstrParserInstanceType    : pointer to the XML instance to get the current info and to be loaded
+                                               with the found BOM
+@param[in]         pu8XMLPortion             : pointer to the XML portion to be parsed to find the BOM
+@param[in]         u32XMLPortionSize         : The size of the XML portion
+
+@return           The found BOM length
+
+@note
+***********************************************************************************************************************/
+static INT8U LwXMLP_u8CheckBOM(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType,\
+                                      const INT8U                          *pu8XMLPortion, \
+                                            INT32U                          u32XMLPortionSize)
+{
+                 INT8U  u8BOMIndex, u8BOMByteIndex;
+    static const INT8U  cu8UCS4_BEBOM[]             = {0x00U, 0x00U, 0x00U, 0x3CU};
+    static const INT8U  cu8UCS4_2143BOM[]           = {0x00U, 0x00U, 0x3CU, 0x00U};
+    static const INT8U  cu8UCS4_3412BOM[]           = {0x00U, 0x3CU, 0x00U, 0x00};
+    static const INT8U  cu8EBCDICBOM[]              = {0x4CU, 0x6FU, 0xA7U, 0x94};
+    static const INT8U  cu8UCS4_LEBOM[]             = {0x3CU, 0x00U, 0x00U, 0x00};
+    static const INT8U  cu8UTF16BOMLittleEndian_1[] = {0x3CU, 0x00U, 0x3FU, 0x00U};
+    static const INT8U  cu8UTF16BOMBigEndian_1[]    = {0x00U, 0x3CU, 0x00U, 0x3FU};
+    static const INT8U  cu8UTF8BOM_2[]              = {0xEFU, 0xBBU, 0xBFU};
+    static const INT8U  cu8UTF16BOMLittleEndian_2[] = {0xFFU, 0xFEU};
+    static const INT8U  cu8UTF16BOMBigEndian_2[]    = {0xFEU, 0xFFU};
+                 INT8U  u8availableBOMLength = 0;
+    static const strBOMDescriptorType objstrBOMDescriptorType[] =
+    {
+        {.pu8EncodingBOM = cu8UCS4_BEBOM,\
+         .u8EncodingBOMLength = 4U,\
+         .objenumEncodingTypeType = csEncoding_UCS4LE},
+        {.pu8EncodingBOM = cu8UCS4_LEBOM,\
+         .u8EncodingBOMLength = 4U,\
+         .objenumEncodingTypeType = csEncoding_UCS4BE},
+        {.pu8EncodingBOM = cu8UCS4_2143BOM,\
+         .u8EncodingBOMLength = 4U,\
+         .objenumEncodingTypeType = csEncoding_UCS4_2143},
+        {.pu8EncodingBOM = cu8UCS4_3412BOM,\
+         .u8EncodingBOMLength = 4U,\
+         .objenumEncodingTypeType = csEncoding_UCS4_3412},
+        {.pu8EncodingBOM = cu8EBCDICBOM,\
+         .u8EncodingBOMLength = 4U,\
+         .objenumEncodingTypeType = csEncoding_EBCDIC},
+        {.pu8EncodingBOM = cu8UTF16BOMLittleEndian_1,\
+         .u8EncodingBOMLength = 4U,\
+         .objenumEncodingTypeType =csEncoding_UTF16LE},
+         {.pu8EncodingBOM = cu8UTF16BOMBigEndian_1,\
+          .u8EncodingBOMLength = 4U,\
+          .objenumEncodingTypeType = csEncoding_UTF16BE},
+        {.pu8EncodingBOM = cu8UTF8BOM_2,\
+         .u8EncodingBOMLength = 3U,\
+         .objenumEncodingTypeType = csEncoding_UTF8},
+        {.pu8EncodingBOM = cu8UTF16BOMLittleEndian_2,\
+         .u8EncodingBOMLength = 2U,\
+         .objenumEncodingTypeType =csEncoding_UTF16LE},
+        {.pu8EncodingBOM = cu8UTF16BOMBigEndian_2,\
+         .u8EncodingBOMLength = 2U,\
+         .objenumEncodingTypeType = csEncoding_UTF16BE},
+    };
+    for(u8BOMIndex = 0U; u8BOMIndex < (sizeof(objstrBOMDescriptorType) / sizeof(strBOMDescriptorType)); ++u8BOMIndex )
+    {
+        for(u8BOMByteIndex = 0U; u8BOMByteIndex < objstrBOMDescriptorType[u8BOMIndex].u8EncodingBOMLength; u8BOMByteIndex++)
+        {
+            if((INT8U)objstrBOMDescriptorType[u8BOMIndex].pu8EncodingBOM[u8BOMByteIndex] != \
+               (INT8U)pu8XMLPortion[u8BOMByteIndex])
+            {
+                break;
             }
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-            else if((pstrParserInstanceType->bParsingDTDInProgress == STD_TRUE) && \
-                    (pstrParserInstanceType->bSecondLevelBufferEnabled == STD_FALSE))
+        }
+        if((u8BOMByteIndex == objstrBOMDescriptorType[u8BOMIndex].u8EncodingBOMLength) &&
+           ((objstrBOMDescriptorType[u8BOMIndex].u8EncodingBOMLength <= u32XMLPortionSize)))
+        {
+            pstrParserInstanceType->objenumEncodingTypeType  = \
+                    objstrBOMDescriptorType[u8BOMIndex].objenumEncodingTypeType;
+            /* will not consume the length of the BOM to be parsed by the parser */
+            if(pu8XMLPortion[0] == 0x3CU)
             {
-                pstrParserInstanceType->objenumErrorType = csNoError;
-                pstrParserInstanceType->objenumErrorType = csDTDMissingPortionError;
-                LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "DTD is missing portion");
+                u8availableBOMLength = 0;
             }
-#endif
             else
             {
-                /* grab what ever is in-between '<' and '>' and put it in s8XMLBuffer*/
-                LwXMLP_vLoadTagToBuffer(pstrParserInstanceType);
-                if(pstrParserInstanceType->objenumErrorType == csNoError)
-                {
-                    if(pstrParserInstanceType->bTagCloserIsFound == STD_TRUE)
-                    {
-                        /* the TAG start or end are currently loaded to the working buffer */
-                        switch(pstrParserInstanceType->objenumTagTypeType)
-                        {
-                            case csStartTagType:
-                                 if(pstrParserInstanceType->bReachXMLEnd == STD_FALSE)
-                                 {
-                                     LwXMLP_vUpdatePathWithStartTag(pstrParserInstanceType);
-                                     /* consume the read TAG */
-                                     LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32CurrentTagLength);
-                                     if(pstrParserInstanceType->objenumErrorType == csNoError)
-                                     {
-#if(ENABLE_EOL_NORMALIZATION == STD_ON)
-                                         LwXMLP_vNormalizeEndOfLine(pstrParserInstanceType->u8XMLworkingBuffer);
+                u8availableBOMLength = objstrBOMDescriptorType[u8BOMIndex].u8EncodingBOMLength;
+            }
+            switch(objstrBOMDescriptorType[u8BOMIndex].objenumEncodingTypeType)
+            {
+                case csEncoding_EBCDIC:
+                     /* EBCDIC */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: EBCDIC");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_UCS4_2143:
+                     /* UCS4_2143 */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UCS4_2143");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_UCS4_3412:
+                     /* UCS4_3412 */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UCS4_3412");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_UTF8:
+                     /* UTF-8 */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UTF8");
+                     break;
+                case csEncoding_UTF16LE:
+                     /* UTF-16LE */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UTF16LE");
+                     break;
+                case csEncoding_UTF16BE:
+                     /* UTF-16BE */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UTF16BE");
+                     break;
+                case csEncoding_UCS4LE:
+                     /* UCS4LE */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UCS4LE");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_UCS4BE:
+                     /* UCS4BE */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UCS4BE");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_UCS2:
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UCS2");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_8859_1:      /*!< ISO-8859-1 ISO Latin 1 */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_1");
+                     break;
+                case csEncoding_8859_2:      /*!< ISO-8859-2 ISO Latin 2 */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_2");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_8859_3:      /*!< ISO-8859-3 */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_3");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_8859_4:      /*!< ISO-8859-4 */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_4");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_8859_5:      /*!< ISO-8859-5 */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_5");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_8859_6:      /*!< ISO-8859-6 */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_6");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_8859_7:      /*!< ISO-8859-7 */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_7");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_8859_8:      /*!< ISO-8859-8 */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_8");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_8859_9:      /*!< ISO-8859-9 */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_9");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_2022_JP:     /*!< ISO-2022-JP */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 2022_JP");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_SHIFT_JIS:   /*!< Shift_JIS */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: SHIFT_JIS");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_EUC_JP:      /*!< EUC-JP */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: EUC_JP");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_ASCII:       /*!< pure ASCII */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: ASCII");
+                     break;
+                case csEncoding_ERROR:
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: ERROR");
+                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+                     break;
+                case csEncoding_NONE:
+                     /* Nothing */
+                default:
+                     /* NO BOM, will use the UTF-8 s a default encoding scheme */
+                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "No BOM is Found use: UTF8");
+                     break;
+            }
+           break;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+    }
+
+#if(SUPPORT_ASCII_ONLY == STD_ON)
+    if((pstrParserInstanceType->objenumEncodingTypeType != csEncoding_ASCII) &&\
+       (pstrParserInstanceType->objenumEncodingTypeType != csEncoding_NONE))
+    {
+        pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
 #endif
-                                         pstrParserInstanceType->objenumXMLEventTypes = csStartElementEvent;
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                                         if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
-                                         {
+
+    return u8availableBOMLength;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT8U LwXMLP_u8ValidNameCharacter(INT8U const *pu8Character)
+
+@brief         This API is responsible to Validate the character if it is NameChar according to W3C definition which
+               should be in range  NameStartChar | "-" | "." | [0-9] | #xB7 | [#x0300-#x036F] | [#x203F-#x2040]
+               The LwXMLP assume that all the parsed string are encoded in UTF-8, so this API will get the code point
+               from the UTF-8 sequence to be compared with the W3C range.
+
+@param[in]     pu8Character : Pointer to the location of the character
+
+@return        Length of the valid UTF-8 sequence
+
+
+@note
+***********************************************************************************************************************/
+static INT8U LwXMLP_u8ValidNameCharacter(INT8U const *pu8Character)
+{
+#if(SUPPORT_ASCII_ONLY == STD_OFF)
+    INT32U  u32CodePoint;
 #endif
-                                             srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
-                                             if(srStatus == E_OK)
-                                             {
-                                                 objenumParserStatusType = csContinueParsingXMLData;
-                                             }
-                                             else
-                                             {
-                                                 /*Terminate XML reception due to error at the user side*/
-                                                 objenumParserStatusType                  = csParserError;
-                                                 pstrParserInstanceType->objenumErrorType = csCallBackErrorOnStartElement;
-                                             }
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                                         }
-                                         else
-                                         {
-                                             objenumParserStatusType = csContinueParsingXMLData;
-                                         }
+    INT8U   u8CharacterLength;
+
+    if((cu8CharacterClassTable[*pu8Character] & CHARACTER_CLASS_NAME) != 0U)
+    {
+        u8CharacterLength = 1U;
+    }
+    else
+    {
+#if(SUPPORT_ASCII_ONLY == STD_OFF)
+        u8CharacterLength = LwXMLP_u8DecodeUTF8(pu8Character, &u32CodePoint);
+        if((u8CharacterLength != 0U) && \
+           ((LwXMLP_u8GetNameClass(u32CodePoint) & CHARACTER_CLASS_NAME) == 0U))
+        {
+            u8CharacterLength = 0U;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+#else
+        u8CharacterLength = 0U;
 #endif
-                                     }
-                                     else
-                                     {
-                                         /*Terminate XML reception due to error at the user side*/
-                                         objenumParserStatusType = csParserError;
-                                     }
-                                 }
-                                 else
-                                 {
-                                     pstrParserInstanceType->objenumErrorType = csExtraContentAtTheEnd;
-                                     objenumParserStatusType                  = csParserError;
-                                 }
-                                 break;
-                            case csEndTagType:
-                                 pstrParserInstanceType->objenumXMLEventTypes = csEndElementEvent;
-#if(ENABLE_EOL_NORMALIZATION == STD_ON)
-                                 LwXMLP_vNormalizeEndOfLine(pstrParserInstanceType->u8XMLworkingBuffer);
+    }
+
+    return u8CharacterLength;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT8U LwXMLP_u8ValidNameStartCharacter(INT8U const *pu8Character)
+
+@brief         Validate the character if it is NameStartChar according to W3C definition which should be in range
+                ":" | [A-Z] | "_" | [a-z] | [#xC0-#xD6] | [#xD8-#xF6] | [#xF8-#x2FF] | [#x370-#x37D] |
+                [#x37F-#x1FFF] | [#x200C-#x200D] | [#x2070-#x218F] | [#x2C00-#x2FEF] | [#x3001-#xD7FF] |
+                [#xF900-#xFDCF] | [#xFDF0-#xFFFD] | [#x10000-#xEFFFF]
+               the LwXMLP assume that all the parsed string are encoded in UTF-8, so this API will get the code point
+               from the UTF-8 sequence to be compared with the W3C range.
+
+@param[in]       pu8Character : Pointer to the location of the character
+
+@return         Length of the valid UTF-8 sequence
+
+@note
+***********************************************************************************************************************/
+static INT8U LwXMLP_u8ValidNameStartCharacter(INT8U const *pu8Character)
+{
+#if(SUPPORT_ASCII_ONLY == STD_OFF)
+    INT32U  u32CodePoint;
 #endif
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                                 if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
-                                 {
+    INT8U   u8CharacterLength;
+
+    if((cu8CharacterClassTable[*pu8Character] & CHARACTER_CLASS_NAME_START) != 0U)
+    {
+        u8CharacterLength = 1U;
+    }
+    else
+    {
+#if(SUPPORT_ASCII_ONLY == STD_OFF)
+        u8CharacterLength = LwXMLP_u8DecodeUTF8(pu8Character, &u32CodePoint);
+        if((u8CharacterLength != 0U) && \
+           ((LwXMLP_u8GetNameClass(u32CodePoint) & CHARACTER_CLASS_NAME_START) == 0U))
+        {
+            u8CharacterLength = 0U;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+#else
+        u8CharacterLength = 0U;
 #endif
-                                     srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
-                                     if(srStatus == E_OK)
-                                     {
-                                         LwXMLP_vRemoveTagfromPath(pstrParserInstanceType);
-                                         /* consume the read TAG */
-                                         LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32CurrentTagLength);
-                                         if(pstrParserInstanceType->objenumErrorType == csNoError)
-                                         {
-                                             if(LwXMLP_bXMLPathIsEmpty(pstrParserInstanceType) == STD_TRUE)
-                                             {
-                                                 pstrParserInstanceType->bReachXMLEnd = STD_TRUE;
-                                                 /* check for extra content at the end of the document */
-                                                 if(LwXMLP_bMoreCharacterAtEndOfXML(pstrParserInstanceType) == STD_TRUE)
-                                                 {/* The only allowed content at the end of the XML document is PI and comment */
-                                                     LwXMLP_vCheckTagForDirective(pstrParserInstanceType);
-                                                     if((pstrParserInstanceType->objenumErrorType == csNoError)&&
-                                                       (pstrParserInstanceType->bTagContainDirective == STD_TRUE)&&
-                                                       ((pstrParserInstanceType->objenumDirectiveTypeType == csProcessingInstructionMarkup) ||\
-                                                        (pstrParserInstanceType->objenumDirectiveTypeType == csCommentMarkup)))
-                                                     {
-                                                         objenumParserStatusType = csContinueParsingXMLData;
-                                                     }
-                                                     else
-                                                     {
-                                                         objenumParserStatusType                  = csParserError;
-                                                         pstrParserInstanceType->objenumErrorType = csExtraContentAtTheEnd;
-                                                     }
-                                                 }
-                                                 else
-                                                 {
-                                                     objenumParserStatusType = csParsingFinished;
-                                                 }
-                                             }
-                                             else
-                                             {
-                                                 objenumParserStatusType = csContinueParsingXMLData;
-                                             }
-                                         }
-                                         else
-                                         {
-                                             objenumParserStatusType = csParserError;
-                                         }
-                                     }
-                                     else
-                                     {
-                                         /*Terminate XML reception due to error at the user side*/
-                                         objenumParserStatusType = csParserError;
-                                         pstrParserInstanceType->objenumErrorType = csCallBackErrorOnStartElement;
-                                     }
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                                 }
-                                 else
-                                 {
-                                     LwXMLP_vRemoveTagfromPath(pstrParserInstanceType);
-                                     /* consume the read TAG */
-                                     LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32CurrentTagLength);
-                                     objenumParserStatusType = csContinueParsingXMLData;
-                                 }
+    }
+
+    return u8CharacterLength;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT8U LwXMLP_u8ValidCharacter(INT8U const *pu8Character)
+
+@brief         Validate the character if it is Char according to W3C definition which should be in range
+               #x9 | #xA | #xD | [#x20-#xD7FF] | [#xE000-#xFFFD] | [#x10000-#x10FFFF]
+               the LwXMLP assume that all the parsed string are encoded in UTF-8, so this API will get the code point
+               from the UTF-8 sequence to be compared with the W3C range.
+
+@param[in]       pu8Character : Pointer to the location of the character
+
+@return         Length of the valid UTF-8 sequence
+
+@note
+***********************************************************************************************************************/
+static INT8U LwXMLP_u8ValidCharacter(INT8U const *pu8Character)
+{
+#if(SUPPORT_ASCII_ONLY == STD_OFF)
+    INT32U  u32CodePoint;
 #endif
-                                 break;
-                            case csEmptyTagType:
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                                 if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
-                                 {
+    INT8U   u8CharacterLength;
+
+    if((cu8CharacterClassTable[*pu8Character] & CHARACTER_CLASS_CHAR) != 0U)
+    {
+        u8CharacterLength = 1U;
+    }
+    else
+    {
+#if(SUPPORT_ASCII_ONLY == STD_OFF)
+        u8CharacterLength = LwXMLP_u8DecodeUTF8(pu8Character, &u32CodePoint);
+        if((u8CharacterLength != 0U) && \
+           (((u32CodePoint < 0x0080U) || (u32CodePoint > 0xD7FFU)) && \
+            ((u32CodePoint < 0xE000U) || (u32CodePoint > 0xFFFDU)) && \
+            ((u32CodePoint < 0x10000U) || (u32CodePoint > 0x10FFFFU))))
+        {
+            u8CharacterLength = 0U;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+#else
+        u8CharacterLength = 0U;
+#endif
+    }
+
+    return u8CharacterLength;
+}
+#if(SUPPORT_ASCII_ONLY == STD_OFF)
+/**********************************************************************************************************************/
+/*!\fn         INT8U LwXMLP_u8DecodeUTF8(INT8U const *pu8Character, INT32U *pu32CodePoint)
+
+@brief         Get the code point of the UTF-8 sequence started by pu8Character, the length of the sequence is taken
+               from cu8CharacterClassTable
+
+@param[in]     pu8Character  : Pointer to the location of the character
+@param[out]    pu32CodePoint : The code point of the sequence
+
+@return        Length of the UTF-8 sequence or 0 if pu8Character isn't a lead byte of multi-byte sequence
+
+@note
+***********************************************************************************************************************/
+static INT8U LwXMLP_u8DecodeUTF8(INT8U const *pu8Character, INT32U *pu32CodePoint)
+{
+    INT8U u8CharacterLength;
+
+    u8CharacterLength = (INT8U)(cu8CharacterClassTable[*pu8Character] >> CHARACTER_CLASS_LENGTH_SHIFT);
+    if(u8CharacterLength == 2U) /* 110X XXXX  two *pu8Characterlength */
+    {
+        *pu32CodePoint = (((INT32U)pu8Character[0] - 192U) * 64U) + \
+                         ((INT32U)pu8Character[1U] - 128U);
+    }
+    else if(u8CharacterLength == 3U) /* 1110 XXXX  three *pu8Characterlength */
+    {
+        *pu32CodePoint = (((INT32U)pu8Character[0] - 224U) * 4096U) + \
+                         (((INT32U)pu8Character[1U] - 128U) * 64U) + \
+                         ((INT32U)pu8Character[2] - 128U);
+    }
+    else if(u8CharacterLength == 4U) /* 1111 0XXX  four *pu8Characterlength */
+    {
+        *pu32CodePoint = (((INT32U)pu8Character[0] - 240U) * 262144U) + \
+                         (((INT32U)pu8Character[1U] - 128U) * 4096U) + \
+                         (((INT32U)pu8Character[2] - 128U) * 64U) + \
+                         ((INT32U)pu8Character[3] - 128U);
+    }
+    else
+    {
+        *pu32CodePoint = 0U;
+    }
+
+    return u8CharacterLength;
+}
+/**********************************************************************************************************************/
+/*!\fn         INT8U LwXMLP_u8GetNameClass(INT32U u32CodePoint)
+
+@brief         Get the NameStartChar/NameChar class of non ASCII code point from the two level tables, the first level
+               cu8NameBlockTable classifies the BMP by blocks of 256 code points and the second level bitmaps are only
+               used for the blocks which aren't uniform
+
+@param[in]     u32CodePoint : The code point to be classified
+
+@return        CHARACTER_CLASS_NAME_START and/or CHARACTER_CLASS_NAME or 0 if the code point isn't NameChar
+
+@note
+***********************************************************************************************************************/
+static INT8U LwXMLP_u8GetNameClass(INT32U u32CodePoint)
+{
+    INT8U u8NameClass;
+    INT8U u8Block;
+
+    if(u32CodePoint <= 0xFFFFU)
+    {
+        u8Block = cu8NameBlockTable[u32CodePoint >> 8U];
+        if((u8Block & NAME_BLOCK_MIXED) != 0U)
+        {
+            u8Block     = (INT8U)(u8Block & (INT8U)(~NAME_BLOCK_MIXED));
+            u8NameClass = 0U;
+            if(((cu8NameStartBitmapTable[u8Block][(u32CodePoint & 0xFFU) >> 3U] >> (u32CodePoint & 0x07U)) & 0x01U) != 0U)
+            {
+                u8NameClass |= CHARACTER_CLASS_NAME_START;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+            if(((cu8NameBitmapTable[u8Block][(u32CodePoint & 0xFFU) >> 3U] >> (u32CodePoint & 0x07U)) & 0x01U) != 0U)
+            {
+                u8NameClass |= CHARACTER_CLASS_NAME;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+        }
+        else
+        {
+            u8NameClass = u8Block;
+        }
+    }
+    else if(u32CodePoint <= 0xEFFFFU)
+    {
+        u8NameClass = CHARACTER_CLASS_NAME_START | CHARACTER_CLASS_NAME;
+    }
+    else
+    {
+        u8NameClass = 0U;
+    }
+
+    return u8NameClass;
+}
 #endif
-                                     LwXMLP_vUpdatePathWithStartTag(pstrParserInstanceType);
-                                     pstrParserInstanceType->objenumXMLEventTypes = csStartElementEvent;
-                                     srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
-                                     if(srStatus == E_OK)
-                                     {
-                                         pstrParserInstanceType->objenumXMLEventTypes = csEndElementEvent;
-                                         srStatus = pstrParserInstanceType->objpsrFuncCallBackType(pstrParserInstanceType);
-                                         if(srStatus == E_OK)
-                                         {
-                                             LwXMLP_vRemoveTagfromPath(pstrParserInstanceType);
-                                             if(pstrParserInstanceType->objenumErrorType == csNoError)
-                                             {
-                                                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32CurrentTagLength);
-                                                 if(LwXMLP_bXMLPathIsEmpty(pstrParserInstanceType) == STD_TRUE)
-                                                 {
-                                                     pstrParserInstanceType->bReachXMLEnd = STD_TRUE;
-                                                     objenumParserStatusType              = csParsingFinished;
-                                                     /* check for extra content at the end of the document */
-                                                     if(LwXMLP_bMoreCharacterAtEndOfXML(pstrParserInstanceType) == STD_TRUE)
-                                                     {/* The only allowed content at the end of the XML document is PI and comment */
-                                                         LwXMLP_vCheckTagForDirective(pstrParserInstanceType);
-                                                         if((pstrParserInstanceType->objenumErrorType == csNoError)&&
-                                                           (pstrParserInstanceType->bTagContainDirective == STD_TRUE)&&
-                                                           ((pstrParserInstanceType->objenumDirectiveTypeType == csProcessingInstructionMarkup) ||\
-                                                            (pstrParserInstanceType->objenumDirectiveTypeType == csCommentMarkup)))
-                                                         {
-                                                             objenumParserStatusType = csContinueParsingXMLData;
-                                                         }
-                                                         else
-                                                         {
-                                                             objenumParserStatusType                  = csParserError;
-                                                             pstrParserInstanceType->objenumErrorType = csExtraContentAtTheEnd;
-                                                         }
-                                                     }
-                                                     else
-                                                     {
-                                                         objenumParserStatusType = csParsingFinished;
-                                                     }
-                                                 }
-                                                 else
-                                                 {
-                                                     objenumParserStatusType = csContinueParsingXMLData;
-                                                 }
-                                             }
-                                             else
-                                             {
-                                                 objenumParserStatusType = csParserError;
-                                             }
-                                         }
-                                         else
-                                         {
-                                             /*Terminate XML reception due to error at the user side*/
-                                             objenumParserStatusType = csParserError;
-                                             pstrParserInstanceType->objenumErrorType = csCallBackErrorOnStartElement;
-                                         }
-                                     }
-                                     else
-                                     {
-                                         /*Terminate XML reception due to error at the user side*/
-                                         objenumParserStatusType = csParserError;
-                                         pstrParserInstanceType->objenumErrorType = csCallBackErrorOnStartElement;
-                                     }
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_bIsLessThanCharacter                                        <LwXMLP_CORE>
+
+SYNTAX:         BOOLEAN LwXMLP_bIsLessThanCharacter(INT8S *pu8Character)
+
+DESCRIPTION :   Validate the character if it is acceptable character to be inside an XML file or not
+
+PARAMETER1  :   s8Character : The received character
+
+RETURN VALUE:   STD_TRUE : if valid XML character is received
+                STD_FALSE: if invalid XML character is received
+
+Note
+END DESCRIPTION *******************************************************************************************************/
+static BOOLEAN LwXMLP_bIsLessThanCharacter(INT8U const *pu8Character)
+{
+    BOOLEAN IsLessThanCharacter = STD_FALSE;
+
+    if((INT8U)(*pu8Character) == LESS_THAN_ASCII_CHARACTER)
+    {
+        IsLessThanCharacter = STD_TRUE;
+    }
+
+    return IsLessThanCharacter;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_bIsWhiteSpace                                        <LwXMLP_CORE>
+
+SYNTAX:         BOOLEAN LwXMLP_bIsWhiteSpace(INT8S *pu8Character)
+
+DESCRIPTION :   check if the received character shall be ignored or not
+
+PARAMETER1  :   s8Character : The received character
+
+RETURN VALUE:   STD_TRUE : if the character shall be ignored
+                STD_FALSE: if the character shall not be ignored
+
+Note        :   XML considers four characters to be whitespace: the carriage return (\r or ch(13)), the linefeed
+                (\n or ch(10U)), the tab(\t), and the spacebar (' '). In XML documents, there are two types of
+                whitespace:
+                - Significant whitespace is part of the document content and should be preserved.
+                - Insignificant whitespace is used when editing XML documents for readability. These whitespaces are
+                  typically not intended for inclusion in the delivery of the document.
+
+END DESCRIPTION *******************************************************************************************************/
+static BOOLEAN LwXMLP_bIsWhiteSpace(INT8U const *pu8Character)
+{
+    BOOLEAN bIsWhiteSpace = STD_FALSE;
+
+    if((cu8CharacterClassTable[*pu8Character] & CHARACTER_CLASS_WHITE_SPACE) != 0U)
+    {
+        bIsWhiteSpace = STD_TRUE;
+    }
+
+    return bIsWhiteSpace;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_pu8GetCurrentCharacter                                        <LwXMLP_CORE>
+
+SYNTAX:         INT8S LwXMLP_pu8GetCurrentCharacter(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   get current character pointed by the XML instance
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+
+RETURN VALUE:   the current character
+
+
+Note        :
+
+END DESCRIPTION *******************************************************************************************************/
+static INT8U * LwXMLP_pu8GetCurrentCharacter(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    return (pstrParserInstanceType->pu8LastParserLocation);
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vPointToNextCharacter                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vPointToNextCharacter(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   move to the next character pointed by the XML instance
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+
+RETURN VALUE:   the current character
+
+
+Note        :
+
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vConsumeCharacter(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+{
+    if((INT8U)(*pstrParserInstanceType->pu8LastParserLocation) == LINE_FEED_ASCII_CHARACTER)
+    {
+        pstrParserInstanceType->u32LineNumber++;
+        pstrParserInstanceType->u32CoulmnNumber = 0;
+    }
+    else
+    {
+        pstrParserInstanceType->u32CoulmnNumber++;
+    }
+    LwXMLP_mVerbose(VERBOSE_LEVEL_DEBUGGING, \
+                    "Consuming character %c",
+                    *pstrParserInstanceType->pu8LastParserLocation);
+#if(ENABLE_BUFFER_SCRUBBING == STD_ON)
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                                 }
-                                 else
-                                 {
-                                     objenumParserStatusType = csContinueParsingXMLData;
-                                     LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32CurrentTagLength);
-                                 }
+    if(pstrParserInstanceType->u8InputSourceDepth == 0U) /* the entity values are kept for the next references */
 #endif
-                                 break;
-                            case csUnkownTagType:
-                            default:
-                                /*Terminate XML reception due to error */
-                                objenumParserStatusType = csParserError;
-                                pstrParserInstanceType->objenumErrorType = csUnexpectedElementType;
-                                break;
-                        }
-                    }
-                    else
-                    {
-                        /* at this point if we were parsing mixed content and we didn't find a markup, we shall consume what we have */
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-                        if(pstrParserInstanceType->bSecondLevelBufferEnabled == STD_TRUE)
-                        {
-                            LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32SecondLevelReadyAmount);
-                            objenumParserStatusType = csContinueParsingXMLData;
-                        }
-                        else
+    {
+        *pstrParserInstanceType->pu8LastParserLocation = NULL_ASCII_CHARACTER;
+    }
 #endif
-                        if(pstrParserInstanceType->bReachXMLEnd == STD_TRUE)
-                        {
-                            objenumParserStatusType = csParsingFinished;
-                        }
-                        else
-                        {
-                            objenumParserStatusType = csContinueAddingXMLData;
-                        }
-                        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "There is no data for parsing");
-                    }
-                }
-                else
-                {
-                    /*Terminate XML reception due to error, The error type will be set by LwXMLP_srLoadTagToBuffer */
-                    objenumParserStatusType = csParserError;
-                }
-            }
+    pstrParserInstanceType->pu8LastParserLocation++;
+    pstrParserInstanceType->u32ParsedLength++;
+    pstrParserInstanceType->u32FreeLocations++;
+    if(pstrParserInstanceType->pu8CircularBufferEnd == pstrParserInstanceType->pu8LastParserLocation)
+    {
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+        if(pstrParserInstanceType->u8InputSourceDepth > 0U) /* the end of the entity value */
+        {
+            /* the source is resumed by the engine once the current event is reported */
         }
         else
+#endif
         {
-            /*Terminate XML reception due to error, the error type will be set by LwXMLP_srCheckTagForDirective */
-            objenumParserStatusType = csParserError;
+            pstrParserInstanceType->pu8LastParserLocation = pstrParserInstanceType->pu8CircularBufferStart;
         }
     }
-
-    return objenumParserStatusType;
-}
-/**********************************************************************************************************************/
-/*!\fn         INT8S const *LwXMLP_ps8GetErrorString(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
-
-@brief         It is responsible to return the error string description of the received parser instance
-
-@param[in]     pstrParserInstanceType    : the pointer to the XML instance
-
-@return        Pointer to constant of the error string
-
-@note
-***********************************************************************************************************************/
-INT8S const *LwXMLP_ps8GetErrorString(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
-{
-    const INT8S *ps8XMLErrorString;
-
-#if(SUPPORT_ERROR_STRING == STD_ON)
-    if(pstrParserInstanceType != STD_NULL)
+    else
     {
-        switch(pstrParserInstanceType->objenumErrorType)
-        {
-            case csInvalidPassingParameter:
-                 ps8XMLErrorString = "the parser received invalid passing parameter";
-                 break;
-            case csInternalError:
-                 ps8XMLErrorString = "Error detected in the internal buffer during parsing";
-                 break;
-            case csFeatureNotSupported:
-                 ps8XMLErrorString = "Feature isn't supported by the parser, it my be disabled by the user";
-                 break;
-            case csAttributeInEndTag:
-                 ps8XMLErrorString = "Attribute in End TAG isn't allowed";
-                 break;
-            case csMissingSeparator:
-                 ps8XMLErrorString = "missing separator in choice";
-                 break;
-            case csInvalidDirectReference:
-                 ps8XMLErrorString = "Direct reference to an entity with &lt;";
-                 break;
-            case csGeneralEntityInDTD:
-                 ps8XMLErrorString = "Found General entity in DTD";
-                 break;
-            case csPartialCharacterReference:
-                 ps8XMLErrorString = "Found Partial Character Reference";
-                 break;
-            case csIncompleteEntityContent:
-                 ps8XMLErrorString = "Incomplete entity content";
-                 break;
-            case csInvalidOperator:
-                 ps8XMLErrorString = "Invalid Operator";
-                 break;
-            case csMissingPITarget:
-                 ps8XMLErrorString = "Missing PI Target ";
-                 break;
-            case csEntityRefereToItself:
-                 ps8XMLErrorString = "It isn't allowed to let the entity to refer to itself";
-                 break;
-            case csMissingEndOfEntity:
-                 ps8XMLErrorString = "Missing End of Entity";
-                 break;
-            case csDTDInvalidDefaultDeclaration:
-                 ps8XMLErrorString = "DTD Invalid Attribute Default Declaration";
-                 break;
-            case csDTDInvalidAttributeType:
-                 ps8XMLErrorString = "DTD Invalid Attribute Type";
-                 break;
-            case csDTDMissingSystemIDError:
-                 ps8XMLErrorString = "DTD is missing System ID";
-                 break;
-            case csInvalidParameterEntity:
-                 ps8XMLErrorString = "DTD Invalid parameter entity";
-                 break;
-            case csDTDMissingPortionError:
-                 ps8XMLErrorString = "DTD is missing portion";
-                 break;
-            case csInvalidAttributeValue:
-                 ps8XMLErrorString = "Invalid Attribute Value";
-                 break;
-            case csInvalidRootToken:
-                 ps8XMLErrorString = "Invalid Token at the root document";
-                 break;
-            case csIllegalWhiteSpace:
-                 ps8XMLErrorString = "Illegal WhiteSpace";
-                 break;
-            case csMissingWhiteSpaceCharacter:
-                 ps8XMLErrorString = "Missing WhiteSpace";
-                 break;
-            case csDTDCapitalPortionError:
-                 ps8XMLErrorString = "DTD small letter portion is used";
-                 break;
-            case csMissingAttributeValue:
-                 ps8XMLErrorString = "Attribute value is missing";
-                 break;
-            case csWrongDirectiveEnd:
-                 ps8XMLErrorString = "Can't find the end of the directive";
-                 break;
-            case csDoubleHyphenInComment:
-                 ps8XMLErrorString = "Double Hyphen inside the comment";
-                 break;
-            case csMissingEqual:
-                 ps8XMLErrorString = "The = is missing between the attribute name and the attribute value";
-                 break;
-            case csMissingQuote:
-                 ps8XMLErrorString = "missing quote";
-                 break;
-            case csQuotesMissmatch:
-                 ps8XMLErrorString = "Quotes miss match";
-                 break;
-            case csInvalidStartNameCharacter:
-                 ps8XMLErrorString = "Invalid Start Name Character";
-                 break;
-            case csInvalidNameCharacter:
-                 ps8XMLErrorString = "Invalid Name Character";
-                 break;
-            case csInvalidPIName:
-                ps8XMLErrorString = "Invalid PI Name";
-                 break;
-            case csInvalidXMLCharacter:
-                 ps8XMLErrorString = "Invalid XML Character";
-                 break;
-            case csCallBackErrorOnPIDirective:
-                 ps8XMLErrorString = "User Callback Error on the Process Instruction";
-                 break;
-            case csCallBackErrorOnStartElement:
-                 ps8XMLErrorString = "User Callback Error on the start TAG";
-                 break;
-            case csCallBackErrorOnData:
-                 ps8XMLErrorString = "User Callback Error on the text node";
-                 break;
-            case csCallBackErrorOnEndElement:
-                ps8XMLErrorString = "User Callback Error on the End element";
-                 break;
-            case csCallBackErrorOnComment:
-                 ps8XMLErrorString = "User Callback Error on the comment";
-                 break;
-            case csUnexpectedElementType:
-                 ps8XMLErrorString = "Unexpected element Type";
-                 break;
-            case csFailedToGetElementInfo:
-                 ps8XMLErrorString = "Failed to Extract element info";
-                 break;
-            case csFailedToAddElementToPath:
-                 ps8XMLErrorString = "Failed to add new element to the Path buffer";
-                 break;
-            case csFailedToExtractAttributes:
-                 ps8XMLErrorString = "Failed to Extract the attributes";
-                 break;
-            case csWrongNesting:
-                ps8XMLErrorString = "Wrong nesting";
-                 break;
-            case csLargeElementLength:
-                 ps8XMLErrorString = "Long element length";
-                 break;
-            case csWrongAttributeFormat:
-                 ps8XMLErrorString = "Missing attribute value";
-                 break;
-            case csWrongDeclarationLocation:
-                 ps8XMLErrorString = "Wrong Declaration Location";
-                 break;
-            case csUnsupportedEncodingScheme:
-                ps8XMLErrorString = "unsupported encoding scheme";
-                 break;
-            case csUnExpectedDirectiveType:
-                 ps8XMLErrorString = "Received unexpected directive type";
-                 break;
-            case csNoError:
-                 ps8XMLErrorString = "No Error";
-                 break;
-            case csEncodingError:
-                 ps8XMLErrorString = "problem occurred during encoding XML portion";
-                 break;
-            case csMissingSemicolon:
-                 ps8XMLErrorString = "missing semi-colon from entity reference";
-                 break;
-            case csExtraContentAtTheEnd:
-                 ps8XMLErrorString = "Extra content at the end of the document";
-                 break;
-            case csRepeatedAttributeName:
-                 ps8XMLErrorString = "Repeated attribute Name";
-                 break;
-            case csInvalidSDeclOrder:
-                 ps8XMLErrorString = "Invalid SDecl Order";
-                 break;
-            case csLargeResolvingTrialsProperty:
-                 ps8XMLErrorString = "More entities need to be resolved, increase MAX_ENTITY_RESOLVING_TRIALS";
-                 break;
-            case csLargeChildrenOperatorsProperty:
-                 ps8XMLErrorString = "Can't process all received attributes, increase MAX_OPERATORS_COUNT";
-                 break;
-            case csLargeNumberOfAttributes:
-                 ps8XMLErrorString = "Can't process all received attributes, increase MAX_NUMBER_OF_ATTRIBUTES";
-                 break;
-            case csLargeElementProperty:
-                 ps8XMLErrorString = "Can't load the element into working buffer, increase MAX_CIRCULAR_BUFFER_SIZE & MAX_WORKING_BUFFER_SIZE";
-                 break;
-            case csLargeDatalength:
-                 ps8XMLErrorString = "Can't load the data into working buffer, increase MAX_CIRCULAR_BUFFER_SIZE & MAX_WORKING_BUFFER_SIZE";
-                 break;
-            case csLargeDTDPortionlength:
-                 ps8XMLErrorString = "Can't load the DTD portion into working buffer, increase MAX_CIRCULAR_BUFFER_SIZE & MAX_WORKING_BUFFER_SIZE";
-                 break;
-            case csLargeDirectiveProperty:
-                 ps8XMLErrorString = "Can't load the Directive into working buffer, increase MAX_CIRCULAR_BUFFER_SIZE & MAX_WORKING_BUFFER_SIZE";
-                 break;
-            case csLargeAttributeNameProperty:
-                 ps8XMLErrorString = "Can't load attribute name, increase MAX_ATTRIBUTES_NAME_LENGTH";
-                 break;
-            case csLargeElementNameProperty:
-                 ps8XMLErrorString = "Can't load element name, increase MAX_ELEMENT_NAME_LENGTH";
-                 break;
-            case csLargeEntityCountProperty:
-                 ps8XMLErrorString = "Can't load entity, increase MAX_ENTITIES";
-                 break;
-            case csLargeEntityNameProperty:
-                 ps8XMLErrorString = "Can't load entity name, increase MAX_ENTITY_NAME_LENGTH";
-                 break;
-            case csLargeEntityValueProperty:
-                 ps8XMLErrorString = "Can't load entity name, increase MAX_ENTITY_VALUE_LENGTH";
-                 break;
-            case csLargeNumberOfAttributeList:
-                 ps8XMLErrorString = "Can't load Attribute list declarations, increase MAX_ATTRIBUTES_LIST";
-                 break;
-            case csDataWithoutStartTag:
-                 ps8XMLErrorString = "Found data without being included in a start TAG";
-                 break;
-            case csInvalidReference:
-                 ps8XMLErrorString = "Invalid Reference";
-                 break;
-            case csInvalidVersionOrder:
-                 ps8XMLErrorString = "Invalid Version Attribute Order";
-                 break;
-            case csParsedEntityError:
-                 ps8XMLErrorString = "Parsed entity isn't well-formed";
-                 break;
-            case csPEReferencesinInInternalSubset:
-                 ps8XMLErrorString = "PEReferences forbidden in internal subset";
-                 break;
-            case csEncodingDiscrepancy:
-                 ps8XMLErrorString = "The parser detected Discrepancy between BOM and encoding type in deceleration";
-                 break;
-            case csMaximumXMLError:
-            default:
-                 ps8XMLErrorString = "Unknown Error";
-                 break;
+        /* nothing to do here */
+    }
+}
+static void LwXMLP_vCheckDeclerationEncoding(LwXMLP_strXMLParseInstanceType       *pstrParserInstanceType, \
+                                             INT8U                          const *pu8MLPortionBuffer,\
+                                             INT32U                                 u32PortionLengthLength)
+{
+    if(strncmp((INT8S const *)pu8MLPortionBuffer, "<?xml", strlen("<?xml")) == 0)
+    {
+        memcpy(pstrParserInstanceType->u8XMLworkingBuffer, pu8MLPortionBuffer, u32PortionLengthLength);
+        pstrParserInstanceType->u32DirectiveLength = u32PortionLengthLength;
+        LwXMLP_vCheckWellFormedDecl(pstrParserInstanceType);
+    }
+    else
+    {
+        /*
+         * Nothign to do
+         */
+    }
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vUpdateLineAndColumn                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vUpdateLineAndColumn(INT32U       *pu32LineNumber, \
+                                                 INT32U       *pu32CoulmnNumber, \
+                                                 INT8U  const *pu8Segment, \
+                                                 INT32U        u32SegmentLength)
+
+DESCRIPTION :   Update the line and column numbers by a consumed linear segment, the line feeds are counted 4 bytes
+                per step and only the word which contains the last line feed is checked byte wise to find the new
+                column
+
+PARAMETER1  :   pu32LineNumber         : pointer to the line number to be updated
+PARAMETER2  :   pu32CoulmnNumber       : pointer to the column number to be updated
+PARAMETER3  :   pu8Segment             : pointer to the consumed segment
+PARAMETER4  :   u32SegmentLength       : the length of the consumed segment
+
+RETURN VALUE:   None
+
+Note        :
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vUpdateLineAndColumn(INT32U       *pu32LineNumber, \
+                                        INT32U       *pu32CoulmnNumber, \
+                                        INT8U  const *pu8Segment, \
+                                        INT32U        u32SegmentLength)
+{
+    INT32U  u32Offset = 0U;
+    INT32U  u32Word, u32LineFeedMask;
+    INT32U  u32LineFeeds = 0U;
+    INT32U  u32LastLineFeedOffset = 0U;
+    BOOLEAN bLineFeedFound = STD_FALSE;
+
+    while((u32Offset + 4U) <= u32SegmentLength)
+    {
+        (void)memcpy(&u32Word, &pu8Segment[u32Offset], 4U);
+        u32LineFeedMask = LwXMLP_mMatchWordBytes(u32Word, LINE_FEED_ASCII_CHARACTER);
+        if(u32LineFeedMask != 0U)
+        {
+            u32LineFeeds          += LwXMLP_mCountMatchedBytes(u32LineFeedMask);
+            u32LastLineFeedOffset  = u32Offset;
+            bLineFeedFound         = STD_TRUE;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+        u32Offset += 4U;
+    }
+    if(bLineFeedFound == STD_TRUE)
+    {
+        /* locate the last line feed inside its word */
+        u32LastLineFeedOffset += 3U;
+        while(pu8Segment[u32LastLineFeedOffset] != LINE_FEED_ASCII_CHARACTER)
+        {
+            u32LastLineFeedOffset--;
         }
     }
     else
     {
-        ps8XMLErrorString = "The parser received invalid passing parameter";
+        /*
+         * Nothing to do
+         */
     }
-#else
-    if(pstrParserInstanceType != STD_NULL)
+    while(u32Offset < u32SegmentLength)
     {
-        ps8XMLErrorString = "Error String isn't supported";
+        if(pu8Segment[u32Offset] == LINE_FEED_ASCII_CHARACTER)
+        {
+            u32LineFeeds++;
+            u32LastLineFeedOffset = u32Offset;
+            bLineFeedFound        = STD_TRUE;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+        u32Offset++;
+    }
+    if(bLineFeedFound == STD_TRUE)
+    {
+        *pu32LineNumber   += u32LineFeeds;
+        *pu32CoulmnNumber  = u32SegmentLength - u32LastLineFeedOffset - 1U;
     }
     else
     {
-        ps8XMLErrorString = "The parser received invalid passing parameter";
+        *pu32CoulmnNumber += u32SegmentLength;
     }
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vConsumeCharacterBulk                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vConsumeCharacterBulk(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                  INT32U                          u32AdvancedLength)
+
+DESCRIPTION :   Consume u32AdvancedLength characters at once, the consumed characters are processed as at most two
+                linear segments, one till the end of the circular buffer and one from its start, or as one segment
+                when the circular buffer is mapped twice
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   u32AdvancedLength      : the number of the characters to be consumed
+
+RETURN VALUE:   None
+
+Note        :   It has the same effect of calling LwXMLP_vConsumeCharacter u32AdvancedLength times
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vConsumeCharacterBulk(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, INT32U u32AdvancedLength)
+{
+    INT32U u32RemainingLength = u32AdvancedLength;
+    INT32U u32SegmentLength;
+
+    while(u32RemainingLength > 0U)
+    {
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_ON)
+        u32SegmentLength = u32RemainingLength;
+#else
+        u32SegmentLength = (INT32U)(pstrParserInstanceType->pu8CircularBufferEnd - \
+                                    pstrParserInstanceType->pu8LastParserLocation);
+        if(u32SegmentLength > u32RemainingLength)
+        {
+            u32SegmentLength = u32RemainingLength;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
 #endif
-    return (ps8XMLErrorString);
+        LwXMLP_vUpdateLineAndColumn(&pstrParserInstanceType->u32LineNumber, \
+                                    &pstrParserInstanceType->u32CoulmnNumber, \
+                                    pstrParserInstanceType->pu8LastParserLocation, \
+                                    u32SegmentLength);
+#if(ENABLE_BUFFER_SCRUBBING == STD_ON)
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+        if(pstrParserInstanceType->u8InputSourceDepth == 0U) /* the entity values are kept for the next references */
+#endif
+        {
+            (void)memset(pstrParserInstanceType->pu8LastParserLocation, NULL_ASCII_CHARACTER, u32SegmentLength);
+        }
+#endif
+        pstrParserInstanceType->pu8LastParserLocation  = &pstrParserInstanceType->pu8LastParserLocation[u32SegmentLength];
+        pstrParserInstanceType->u32ParsedLength       += u32SegmentLength;
+        pstrParserInstanceType->u32FreeLocations      += u32SegmentLength;
+        if(pstrParserInstanceType->pu8CircularBufferEnd <= pstrParserInstanceType->pu8LastParserLocation)
+        {
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+            if(pstrParserInstanceType->u8InputSourceDepth > 0U) /* the end of the entity value */
+            {
+                /* the source is resumed by the engine once the current event is reported */
+            }
+            else
+#endif
+            {/* it is beyond the end only if the characters are consumed through the second view */
+                pstrParserInstanceType->pu8LastParserLocation -= MAX_CIRCULAR_BUFFER_SIZE;
+            }
+        }
+        else
+        {
+            /* nothing to do here */
+        }
+        u32RemainingLength -= u32SegmentLength;
+    }
 }
-/**********************************************************************************************************************/
-/*!\fn         INT32U LwXMLP_u32GetLineOfError(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vWriteCircularBuffer                                        <LwXMLP_CORE>
 
-@brief         It is responsible to return the line number where the error is occurred for the received parser
-               instance
+SYNTAX:         void LwXMLP_vWriteCircularBuffer(LwXMLP_strXMLParseInstanceType       *pstrParserInstanceType, \
+                                                 INT8U                          const *pu8Data, \
+                                                 INT32U                                u32DataLength)
 
-@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+DESCRIPTION :   Write u32DataLength bytes at the head of the circular buffer by at most two copies, one till the end of
+                the circular buffer and one from its start, or by one copy when the circular buffer is mapped twice
 
-@return        The line number where the error is occurred or,
-@return        0: if the pstrParserInstanceType is received incorrectly STD_NULL
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   pu8Data                : pointer to the bytes to be written
+PARAMETER3  :   u32DataLength          : the number of the bytes, it shall not exceed the free locations
 
-@note
-***********************************************************************************************************************/
-INT32U LwXMLP_u32GetLineOfError(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+RETURN VALUE:   None
+
+Note        :   The free locations aren't updated, and the head is wrapped lazily as the character by character copy
+                did, so it may be left at the end of the circular buffer
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vWriteCircularBuffer(LwXMLP_strXMLParseInstanceType       *pstrParserInstanceType, \
+                                        INT8U                          const *pu8Data, \
+                                        INT32U                                u32DataLength)
 {
-    INT32U u32LineNumber;
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_OFF)
+    INT32U u32SegmentLength;
+#endif
 
-    if(pstrParserInstanceType != STD_NULL)
+    if(u32DataLength > 0U)
     {
-        u32LineNumber = pstrParserInstanceType->u32LineNumber;
+        if(pstrParserInstanceType->pu8CircularBufferHead == pstrParserInstanceType->pu8CircularBufferEnd)
+        {
+            pstrParserInstanceType->pu8CircularBufferHead = pstrParserInstanceType->pu8CircularBufferStart;
+        }
+        else
+        {
+            /* nothing to do here */
+        }
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_ON)
+        (void)memcpy(pstrParserInstanceType->pu8CircularBufferHead, pu8Data, u32DataLength);
+        pstrParserInstanceType->pu8CircularBufferHead = &pstrParserInstanceType->pu8CircularBufferHead[u32DataLength];
+        if(pstrParserInstanceType->pu8CircularBufferHead > pstrParserInstanceType->pu8CircularBufferEnd)
+        {/* the bytes are written through the second view, continue from the first one */
+            pstrParserInstanceType->pu8CircularBufferHead -= MAX_CIRCULAR_BUFFER_SIZE;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+#else
+        u32SegmentLength = (INT32U)(pstrParserInstanceType->pu8CircularBufferEnd - \
+                                    pstrParserInstanceType->pu8CircularBufferHead);
+        if(u32SegmentLength > u32DataLength)
+        {
+            u32SegmentLength = u32DataLength;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+        (void)memcpy(pstrParserInstanceType->pu8CircularBufferHead, pu8Data, u32SegmentLength);
+        pstrParserInstanceType->pu8CircularBufferHead = &pstrParserInstanceType->pu8CircularBufferHead[u32SegmentLength];
+        if(u32SegmentLength < u32DataLength)
+        {
+            (void)memcpy(pstrParserInstanceType->pu8CircularBufferStart, &pu8Data[u32SegmentLength], u32DataLength - u32SegmentLength);
+            pstrParserInstanceType->pu8CircularBufferHead = &pstrParserInstanceType->pu8CircularBufferStart[u32DataLength - u32SegmentLength];
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+#endif
     }
     else
     {
-        u32LineNumber = 0U;
+        /*
+         * Nothing to do
+         */
     }
-
-    return (u32LineNumber);
 }
-/**********************************************************************************************************************/
-/*!\fn         INT32U LwXMLP_u32GetCoulmnOfError(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_ON)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_srMapCircularBuffer                                        <LwXMLP_CORE>
 
-@brief         This API is responsible to return the column number where the error is occurred for the received parser
-               instance
+SYNTAX:         StdReturnType LwXMLP_srMapCircularBuffer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 
-@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+DESCRIPTION :   Create the circular buffer of the instance as an anonymous memory file which is mapped twice back to
+                back, so the byte at pu8CircularBufferStart[i + MAX_CIRCULAR_BUFFER_SIZE] is the byte at
+                pu8CircularBufferStart[i], and any run of at most MAX_CIRCULAR_BUFFER_SIZE bytes which starts inside
+                the circular buffer is contiguous in the virtual memory
 
-@return        The line number where the error is occurred or,
-@return        0: if the pstrParserInstanceType is received incorrectly STD_NULL
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
 
-@note
-***********************************************************************************************************************/
-INT32U LwXMLP_u32GetCoulmnOfError(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+RETURN VALUE:   E_OK    : if the circular buffer is mapped
+                E_NOT_OK: if MAX_CIRCULAR_BUFFER_SIZE isn't a multiple of the page size or the mapping is failed
+
+Note        :   pu8CircularBufferStart is set to STD_NULL if the mapping is failed
+END DESCRIPTION *******************************************************************************************************/
+static StdReturnType LwXMLP_srMapCircularBuffer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 {
-    INT32U u32CoulmnNumber;
+    StdReturnType  srMapStatus = E_NOT_OK;
+    INT32S         s32MemoryFile;
+    INT8U         *pu8Mapping;
 
-    if(pstrParserInstanceType != STD_NULL)
+    pstrParserInstanceType->pu8CircularBufferStart = STD_NULL;
+    if((MAX_CIRCULAR_BUFFER_SIZE % (INT32U)sysconf(_SC_PAGESIZE)) != 0U)
     {
-        u32CoulmnNumber = pstrParserInstanceType->u32CoulmnNumber;
+        LwXMLP_mVerbose(VERBOSE_LEVEL_SERIOUS|VERBOSE_MESSAGE_ON, \
+                        "MAX_CIRCULAR_BUFFER_SIZE shall be a multiple of the page size to be mapped twice");
     }
     else
     {
-        u32CoulmnNumber = 0U;
+        s32MemoryFile = memfd_create("LwXMLP", MFD_CLOEXEC);
+        if(s32MemoryFile < 0)
+        {
+            LwXMLP_mVerbose(VERBOSE_LEVEL_SERIOUS|VERBOSE_MESSAGE_ON, "Can't create the memory file of the circular buffer");
+        }
+        else
+        {
+            /* reserve the address range of the two views at once, so nothing else can be mapped between them */
+            pu8Mapping = (INT8U *)mmap(STD_NULL, 2U * MAX_CIRCULAR_BUFFER_SIZE, PROT_NONE, \
+                                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if(pu8Mapping == (INT8U *)MAP_FAILED)
+            {
+                LwXMLP_mVerbose(VERBOSE_LEVEL_SERIOUS|VERBOSE_MESSAGE_ON, "Can't reserve the views of the circular buffer");
+            }
+            else if((ftruncate(s32MemoryFile, (off_t)MAX_CIRCULAR_BUFFER_SIZE) != 0) || \
+                    (mmap(pu8Mapping, MAX_CIRCULAR_BUFFER_SIZE, PROT_READ | PROT_WRITE, \
+                          MAP_SHARED | MAP_FIXED, s32MemoryFile, 0) == MAP_FAILED) || \
+                    (mmap(&pu8Mapping[MAX_CIRCULAR_BUFFER_SIZE], MAX_CIRCULAR_BUFFER_SIZE, PROT_READ | PROT_WRITE, \
+                          MAP_SHARED | MAP_FIXED, s32MemoryFile, 0) == MAP_FAILED))
+            {
+                (void)munmap(pu8Mapping, 2U * MAX_CIRCULAR_BUFFER_SIZE);
+                LwXMLP_mVerbose(VERBOSE_LEVEL_SERIOUS|VERBOSE_MESSAGE_ON, "Can't map the views of the circular buffer");
+            }
+            else
+            {
+                pstrParserInstanceType->pu8CircularBufferStart = pu8Mapping;
+                srMapStatus                                    = E_OK;
+            }
+            (void)close(s32MemoryFile); /* the views keep the memory file */
+        }
     }
 
-    return (u32CoulmnNumber);
+    return srMapStatus;
 }
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vUnmapCircularBuffer                                        <LwXMLP_CORE>
 
-/*
-********************************************************************************************************************
-************************************************************************************************************************
-*                                               L O C A L   F U N C T I O N S
-************************************************************************************************************************
-********************************************************************************************************************
-*/
-/**********************************************************************************************************************/
-/*!\fn         StdReturnType LwXMLP_srReleaseStaticInstance(LwXMLP_strXMLParseInstanceType  const *pstrParserInstanceType)
-
-@brief         This API is responsible to release the statically allocated instance
-
-@param[in]     pstrParserInstanceType    : the pointer to the XML instance
+SYNTAX:         void LwXMLP_vUnmapCircularBuffer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 
-@return        E_NOT_OK: if the release process is failed
-               E_OK    : if the release process is succeeded
+DESCRIPTION :   Release the two views of the circular buffer which are mapped by LwXMLP_srMapCircularBuffer
 
-@note
-***********************************************************************************************************************/
-/**********************************************************************************************************************/
-/*!\fn         LwXMLP_strXMLParseInstanceType  *LwXMLP_pstrGetStaticInstance(void)
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
 
-@brief         This API is responsible to get a free instance and if it is found, it will be marked as reversed not
-               to be used by other caller and it will be failed if there is no available static instances
+RETURN VALUE:   None
 
-@return        STD_NULL:                       if there is no free instances
-               LwXMLP_strXMLParseInstanceType: pointer to the allocated instance if there is a free instance
+Note        :   pu8CircularBufferStart is set to STD_NULL, so closing the instance again doesn't release anything
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vUnmapCircularBuffer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+{
+    if(pstrParserInstanceType->pu8CircularBufferStart != STD_NULL)
+    {
+        (void)munmap(pstrParserInstanceType->pu8CircularBufferStart, 2U * MAX_CIRCULAR_BUFFER_SIZE);
+        pstrParserInstanceType->pu8CircularBufferStart = STD_NULL;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+}
+#endif
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_srCheckPortionEncoding                                        <LwXMLP_CORE>
 
-@note          the upper layer caller shall fail and not to continue the parsing process if this API returned STD_NULL
-***********************************************************************************************************************/
+SYNTAX:         StdReturnType LwXMLP_srCheckPortionEncoding(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                            const INT8U                          *pu8XMLPortionBuffer, \
+                                                                  INT32U                          u32PortionSize, \
+                                                                  INT8U                          *pu8BOMLength)
 
-#if(ALLOCATION_TYPE == INTERNAL_STATIC_ALLOCATION)
-static StdReturnType LwXMLP_srReleaseStaticInstance(LwXMLP_strXMLParseInstanceType  const *pstrParserInstanceType)
-{
-    INT8U         u8FreeInstanceIndex;
-    StdReturnType srReleaseStatus = E_NOT_OK; /* Assume that the release process is failed */
+DESCRIPTION :   Detect the encoding of the document from the BOM or the XML declaration of its first portion, the
+                length of the portion without the BOM is loaded to u32NewLength, or 0 if the declaration isn't
+                complete
 
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   pu8XMLPortionBuffer    : pointer to the first portion of the document
+PARAMETER3  :   u32PortionSize         : the length of the portion
+PARAMETER4  :   pu8BOMLength           : it is loaded with the length of the BOM to be skipped
 
-    for(u8FreeInstanceIndex = 0; u8FreeInstanceIndex < TOTAL_STATIC_XML_INSTANCES; u8FreeInstanceIndex++)
-    {
-        if(&objstrStaticInstancesArray[u8FreeInstanceIndex].objstrXMLParseInstanceType == pstrParserInstanceType)
-        {
-            objstrStaticInstancesArray[u8FreeInstanceIndex].bReserevedInstance = STD_FALSE;
-            srReleaseStatus                                                    = E_OK;
-            pstrParserInstanceType                                             = STD_NULL;
-            break;
-        }
-    }
+RETURN VALUE:   E_OK if the encoding is accepted, E_NOT_OK if the XML declaration isn't well-formed
 
-    return srReleaseStatus;
-}
-static LwXMLP_strXMLParseInstanceType  *LwXMLP_pstrGetStaticInstance(void)
+Note        :   It is invoked once per document
+END DESCRIPTION *******************************************************************************************************/
+static StdReturnType LwXMLP_srCheckPortionEncoding(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                   const INT8U                          *pu8XMLPortionBuffer, \
+                                                         INT32U                          u32PortionSize, \
+                                                         INT8U                          *pu8BOMLength)
 {
-    INT8U                           u8FreeInstanceIndex;
-    LwXMLP_strXMLParseInstanceType *pstrXMLParseInstanceType = STD_NULL;
-
-    for(u8FreeInstanceIndex = 0; u8FreeInstanceIndex < TOTAL_STATIC_XML_INSTANCES; u8FreeInstanceIndex++)
+    INT32U        u32ByteIndex;
+    StdReturnType srStatus = E_OK;
+
+    pstrParserInstanceType->bBOMIsChecked = STD_TRUE;
+    *pu8BOMLength                         = LwXMLP_u8CheckBOM(pstrParserInstanceType, \
+                                                              pu8XMLPortionBuffer, \
+                                                              u32PortionSize);
+    pstrParserInstanceType->u32NewLength  = u32PortionSize - *pu8BOMLength;
+    /*
+     * If no BOM is available, we will allow adding to XML deceleration
+     * only to be parsed to detect the encoding scheme
+     */
+    if((*pu8BOMLength == 0U) && (pu8XMLPortionBuffer[1] == QUESTION_MARK_ASCII_CHARACTER))
+    {
+    /*
+     * Look for end of deceleration inside the buffer
+     */
+       for(u32ByteIndex = 0U; u32ByteIndex < u32PortionSize; ++u32ByteIndex)
+       {
+           if(pu8XMLPortionBuffer[u32ByteIndex] == GREATER_THAN_ASCII_CHARACTER)
+           {
+               LwXMLP_vCheckDeclerationEncoding(pstrParserInstanceType, pu8XMLPortionBuffer, u32ByteIndex + 1U);
+               if(pstrParserInstanceType->objenumErrorType == csNoError)
+               {
+                   /*
+                    * Nothing to do
+                    */
+               }
+               else
+               {
+                   srStatus = E_NOT_OK;
+               }
+               break;
+           }
+           else
+           {
+               /*
+                * Nothing to do
+                */
+           }
+       }
+       if(pstrParserInstanceType->objenumEncodingTypeType == csEncoding_NONE)
+       {
+           /*
+            * Wait till receive complete deceleration
+            */
+           pstrParserInstanceType->u32NewLength = 0U;
+       }
+       else
+       {
+           /*
+            * Nothing to do
+            */
+       }
+    }
+    else
     {
-        if(objstrStaticInstancesArray[u8FreeInstanceIndex].bReserevedInstance == STD_FALSE)
-        {
-            pstrXMLParseInstanceType = &objstrStaticInstancesArray[u8FreeInstanceIndex].objstrXMLParseInstanceType;
-            objstrStaticInstancesArray[u8FreeInstanceIndex].bReserevedInstance = STD_TRUE;
-            break;
-        }
+        /*
+         * Nothing to do
+         */
     }
 
-    return pstrXMLParseInstanceType;
+    return srStatus;
 }
-#endif
-/**********************************************************************************************************************/
-/*!\fn         StdReturnType LwXMLP_srInitParserObject(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType,\
-                                                       LwXLMP_psrFuncCallBackType      objpsrFuncCallBackType)
-
-@brief         This API is responsible to initialize the parser instance with the proper initial value for its members
+#if(ENABLE_ENCODING == STD_ON)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_srTranscodeStagedInput                                        <LwXMLP_CORE>
 
-@param[in,out]     pstrParserInstanceType    : pointer to the XML instance to get the current info and to be loaded
-                                               with the initial value
+SYNTAX:         StdReturnType LwXMLP_srTranscodeStagedInput(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 
-@param[in]         objpsrFuncCallBackType    : pointer to the call back function assigned by upper layer
+DESCRIPTION :   Transcode the committed bytes at the start of the encoding buffer to UTF-8 in the circular buffer, the
+                complete characters are transcoded in blocks of TRANSCODING_BLOCK_LENGTH output bytes while the
+                circular buffer has free locations, and the bytes which aren't transcoded (the incomplete character
+                and the characters which don't fit yet) are moved to the start of the encoding buffer for the next
+                commit
 
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
 
-@return        E_NOT_OK: if the initialization process is failed, and it will fail if the upper layer passed STD_NULL
-                         pointer in the parser instance
-               E_OK    : if the initialization process is succeeded
+RETURN VALUE:   E_OK if the bytes are valid, E_NOT_OK if the transcoding is failed
 
-@note          the upper layer caller shall fail and not to continue the parsing process if this API returned STD_NULL
-***********************************************************************************************************************/
-static StdReturnType LwXMLP_srInitParserObject(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType,\
-                                                      LwXLMP_psrFuncCallBackType      objpsrFuncCallBackType)
+Note        :   The encoding buffer holds the raw input here, so the output is staged in a small local block
+END DESCRIPTION *******************************************************************************************************/
+static StdReturnType LwXMLP_srTranscodeStagedInput(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 {
-    StdReturnType srInitParserStatusObject;
+    INT8U         u8TranscodedBlock[TRANSCODING_BLOCK_LENGTH];
+    INT32U        u32TranscodedLength = 0U;
+    INT32U        u32InputLength, u32OutputLength, u32CompleteLength;
+    BOOLEAN       bBlockIsTranscoded = STD_TRUE;
+    StdReturnType srStatus = E_OK;
 
-    if(pstrParserInstanceType != STD_NULL)
+    /* the bytes of an incomplete character are carried to the next commit without being passed to the decoder */
+    u32CompleteLength = LwXMLP_u32GetCompleteStagedLength(pstrParserInstanceType);
+    while((srStatus == E_OK) && (bBlockIsTranscoded == STD_TRUE) && (u32TranscodedLength < u32CompleteLength))
     {
-        srInitParserStatusObject                         = E_OK;
-        pstrParserInstanceType->u32FreeLocations         = MAX_CIRCULAR_BUFFER_SIZE;
-        pstrParserInstanceType->pu8LastParserLocation    = pstrParserInstanceType->u8XMLCircularBuffer;
-        pstrParserInstanceType->pu8CircularBufferHead    = pstrParserInstanceType->u8XMLCircularBuffer;
-        pstrParserInstanceType->pu8CircularBufferEnd     = &pstrParserInstanceType->u8XMLCircularBuffer[MAX_CIRCULAR_BUFFER_SIZE];
-        pstrParserInstanceType->objpsrFuncCallBackType   = objpsrFuncCallBackType;
-        pstrParserInstanceType->u32CoulmnNumber          = 1U;
-        pstrParserInstanceType->u32LineNumber            = 1U;
-        pstrParserInstanceType->objenumXMLCheckStateType = csBOMChecking;
-        pstrParserInstanceType->objenumEncodingTypeType  = csEncoding_NONE;
-        pstrParserInstanceType->u8XMLPathBuffer[0]       = 0U;
-        pstrParserInstanceType->u32PathLength            = 0U;
-        pstrParserInstanceType->bEndOfDataIsFound        = STD_FALSE;
-        pstrParserInstanceType->bBOMIsChecked            = STD_FALSE;
-        pstrParserInstanceType->bEndOfDirectiveFound     = STD_FALSE;
-        pstrParserInstanceType->bTagContainDirective     = STD_FALSE;
-        pstrParserInstanceType->objenumErrorType         = csNoError;
-        pstrParserInstanceType->s16AttributeCounts       = 0;
-        pstrParserInstanceType->u32CurrentTagLength      = 0U;
-        pstrParserInstanceType->u32DirectiveLength       = 0U;
-        pstrParserInstanceType->u32ParsedLength          = 0U;
-        pstrParserInstanceType->bReachXMLEnd             = STD_FALSE;
-        pstrParserInstanceType->u8AvaliableEntities      = 0U;
-#if(ENABLE_DTD_RECEIPTION == STD_ON)
-        pstrParserInstanceType->bParsingDTDInProgress      = STD_FALSE;
-#endif
-        pstrParserInstanceType->u8AvaliableAttibuteListCount = 0U;
-        pstrParserInstanceType->bStandAloneDocument        = STD_FALSE;
-        pstrParserInstanceType->bFoundExternalEntity       = STD_FALSE;
+        u32InputLength  = u32CompleteLength - u32TranscodedLength;
+        u32OutputLength = pstrParserInstanceType->u32FreeLocations;
+        if(u32OutputLength > TRANSCODING_BLOCK_LENGTH)
+        {
+            u32OutputLength = TRANSCODING_BLOCK_LENGTH;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+        srStatus = LwXMLP_srEncodeXMLportion(pstrParserInstanceType->objenumEncodingTypeType, \
+                                             &pstrParserInstanceType->u8XMLEncodingBuffer[u32TranscodedLength], \
+                                             &u32InputLength, \
+                                             u8TranscodedBlock, \
+                                             &u32OutputLength);
+        if((srStatus == E_OK) && (u32InputLength > 0U))
+        {
+            LwXMLP_vWriteCircularBuffer(pstrParserInstanceType, u8TranscodedBlock, u32OutputLength);
+            pstrParserInstanceType->u32FreeLocations -= u32OutputLength;
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
-        pstrParserInstanceType->bParserSilentModeIsEnabled = STD_FALSE;
-        pstrParserInstanceType->bSecondLevelBufferEnabled  = STD_FALSE;
-        pstrParserInstanceType->u8SecondLevelPathBuffer[0] = 0U;
-        pstrParserInstanceType->u32SecondLevelPathLength   = 0U;
-        pstrParserInstanceType->u32LastReferenceLine       = 0U;
+            pstrParserInstanceType->u32ReceivedBytes += u32OutputLength;
 #endif
+            u32TranscodedLength += u32InputLength;
+        }
+        else
+        {
+            bBlockIsTranscoded = STD_FALSE;
+        }
+    }
+    if(srStatus == E_OK)
+    {
+        pstrParserInstanceType->u32StagedInputLength -= u32TranscodedLength;
+        (void)memmove(pstrParserInstanceType->u8XMLEncodingBuffer, \
+                      &pstrParserInstanceType->u8XMLEncodingBuffer[u32TranscodedLength], \
+                      pstrParserInstanceType->u32StagedInputLength);
     }
     else
     {
-        srInitParserStatusObject = E_NOT_OK;
+        pstrParserInstanceType->objenumErrorType = csEncodingError;
     }
 
-    return srInitParserStatusObject;
-
+    return srStatus;
 }
-/**********************************************************************************************************************/
-/*!\fn         void LwXMLP_vCopy(INT8U *pu8Destination, INT8U const *pu8Source, INT32U u32Length)
-
-@brief         This API is helper function to do copy from source to destination with specific length
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_u32GetCompleteStagedLength                                        <LwXMLP_CORE>
 
-@param[in]     pu8Destination            : the pointer to destination location
+SYNTAX:         INT32U LwXMLP_u32GetCompleteStagedLength(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
 
-@param[in]     pu8Source                 : the pointer to source location
+DESCRIPTION :   Get the length of the staged bytes which end at a character boundary, the odd byte of a UTF-16 code
+                unit and the high surrogate which waits for its low surrogate are excluded
 
-@param[in]     u32Length                 : the length of the required data to be copied in bytes
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
 
-@return
+RETURN VALUE:   the number of the staged bytes which can be transcoded now
 
-@note
-***********************************************************************************************************************/
-static void LwXMLP_vCopy(INT8U *pu8Destination, INT8U const *pu8Source, INT32U u32Length)
+Note        :   the other staged encodings are single byte encodings, so all their bytes are complete
+END DESCRIPTION *******************************************************************************************************/
+static INT32U LwXMLP_u32GetCompleteStagedLength(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
 {
-    memcpy(pu8Destination, pu8Source, u32Length);
-}
-/**********************************************************************************************************************/
-/*!\fn         INT32U LwXMLP_u32GetReadyData(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
-
-@brief         This API return the available length of XML document for parsing
-
-@param[in]     pstrParserInstanceType    : the pointer to the XML instance
-
-@return        the number of bytes of the available length of XML document for parsing
+    INT32U       u32CompleteLength = pstrParserInstanceType->u32StagedInputLength;
+    INT32U       u32LastCodeUnit;
+    INT8U const *pu8StagedInput    = pstrParserInstanceType->u8XMLEncodingBuffer;
 
-@note
-***********************************************************************************************************************/
-static INT32U LwXMLP_u32GetReadyData(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
-{
-    INT32U u32ReadyAmount;
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-    if(pstrParserInstanceType->bSecondLevelBufferEnabled == STD_TRUE)
+    if((pstrParserInstanceType->objenumEncodingTypeType == csEncoding_UTF16LE) || \
+       (pstrParserInstanceType->objenumEncodingTypeType == csEncoding_UTF16BE))
     {
-        u32ReadyAmount = pstrParserInstanceType->u32SecondLevelReadyAmount;
+        u32CompleteLength -= u32CompleteLength % 2U;
+        if(u32CompleteLength >= 2U)
+        {
+            if(pstrParserInstanceType->objenumEncodingTypeType == csEncoding_UTF16LE)
+            {
+                u32LastCodeUnit = (INT32U)pu8StagedInput[u32CompleteLength - 2U] | \
+                                  ((INT32U)pu8StagedInput[u32CompleteLength - 1U] << 8U);
+            }
+            else
+            {
+                u32LastCodeUnit = ((INT32U)pu8StagedInput[u32CompleteLength - 2U] << 8U) | \
+                                  (INT32U)pu8StagedInput[u32CompleteLength - 1U];
+            }
+            if((u32LastCodeUnit & 0xFC00U) == 0xD800U)
+            {/* the high surrogate is transcoded with its low surrogate */
+                u32CompleteLength -= 2U;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
     }
     else
     {
-        u32ReadyAmount = MAX_CIRCULAR_BUFFER_SIZE - pstrParserInstanceType->u32FreeLocations;
+        /*
+         * Nothing to do
+         */
     }
-#else
-    u32ReadyAmount = MAX_CIRCULAR_BUFFER_SIZE - pstrParserInstanceType->u32FreeLocations;
-#endif
-    return u32ReadyAmount;
-}
-/**********************************************************************************************************************/
-/*!\fn         INT8U LwXMLP_u8CheckBOM(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType,\
-                                      const INT8U                          *pu8XMLPortion, \
-                                            INT32U                          u32XMLPortionSize)
-
-@brief         This API check the available BOM in the XML document
-
-@param[in,out]     pstrParserInstanceType    : pointer to the XML instance to get the current info and to be loaded
-                                               with the found BOM
-@param[in]         pu8XMLPortion             : pointer to the XML portion to be parsed to find the BOM
-@param[in]         u32XMLPortionSize         : The size of the XML portion
-
-@return           The found BOM length
 
-@note
-***********************************************************************************************************************/
-static INT8U LwXMLP_u8CheckBOM(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType,\
-                                      const INT8U                          *pu8XMLPortion, \
-                                            INT32U                          u32XMLPortionSize)
+    return u32CompleteLength;
+}
+#endif
+#if(ENABLE_DTD_RECEIPTION == STD_ON)
+static void LwXMLP_vCheckDTDPortion(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 {
-                 INT8U  u8BOMIndex, u8BOMByteIndex;
-    static const INT8U  cu8UCS4_BEBOM[]             = {0x00U, 0x00U, 0x00U, 0x3CU};
-    static const INT8U  cu8UCS4_2143BOM[]           = {0x00U, 0x00U, 0x3CU, 0x00U};
-    static const INT8U  cu8UCS4_3412BOM[]           = {0x00U, 0x3CU, 0x00U, 0x00};
-    static const INT8U  cu8EBCDICBOM[]              = {0x4CU, 0x6FU, 0xA7U, 0x94};
-    static const INT8U  cu8UCS4_LEBOM[]             = {0x3CU, 0x00U, 0x00U, 0x00};
-    static const INT8U  cu8UTF16BOMLittleEndian_1[] = {0x3CU, 0x00U, 0x3FU, 0x00U};
-    static const INT8U  cu8UTF16BOMBigEndian_1[]    = {0x00U, 0x3CU, 0x00U, 0x3FU};
-    static const INT8U  cu8UTF8BOM_2[]              = {0xEFU, 0xBBU, 0xBFU};
-    static const INT8U  cu8UTF16BOMLittleEndian_2[] = {0xFFU, 0xFEU};
-    static const INT8U  cu8UTF16BOMBigEndian_2[]    = {0xFEU, 0xFFU};
-                 INT8U  u8availableBOMLength = 0;
-    static const strBOMDescriptorType objstrBOMDescriptorType[] =
-    {
-        {.pu8EncodingBOM = cu8UCS4_BEBOM,\
-         .u8EncodingBOMLength = 4U,\
-         .objenumEncodingTypeType = csEncoding_UCS4LE},
-        {.pu8EncodingBOM = cu8UCS4_LEBOM,\
-         .u8EncodingBOMLength = 4U,\
-         .objenumEncodingTypeType = csEncoding_UCS4BE},
-        {.pu8EncodingBOM = cu8UCS4_2143BOM,\
-         .u8EncodingBOMLength = 4U,\
-         .objenumEncodingTypeType = csEncoding_UCS4_2143},
-        {.pu8EncodingBOM = cu8UCS4_3412BOM,\
-         .u8EncodingBOMLength = 4U,\
-         .objenumEncodingTypeType = csEncoding_UCS4_3412},
-        {.pu8EncodingBOM = cu8EBCDICBOM,\
-         .u8EncodingBOMLength = 4U,\
-         .objenumEncodingTypeType = csEncoding_EBCDIC},
-        {.pu8EncodingBOM = cu8UTF16BOMLittleEndian_1,\
-         .u8EncodingBOMLength = 4U,\
-         .objenumEncodingTypeType =csEncoding_UTF16LE},
-         {.pu8EncodingBOM = cu8UTF16BOMBigEndian_1,\
-          .u8EncodingBOMLength = 4U,\
-          .objenumEncodingTypeType = csEncoding_UTF16BE},
-        {.pu8EncodingBOM = cu8UTF8BOM_2,\
-         .u8EncodingBOMLength = 3U,\
-         .objenumEncodingTypeType = csEncoding_UTF8},
-        {.pu8EncodingBOM = cu8UTF16BOMLittleEndian_2,\
-         .u8EncodingBOMLength = 2U,\
-         .objenumEncodingTypeType =csEncoding_UTF16LE},
-        {.pu8EncodingBOM = cu8UTF16BOMBigEndian_2,\
-         .u8EncodingBOMLength = 2U,\
-         .objenumEncodingTypeType = csEncoding_UTF16BE},
-    };
-    for(u8BOMIndex = 0U; u8BOMIndex < (sizeof(objstrBOMDescriptorType) / sizeof(strBOMDescriptorType)); ++u8BOMIndex )
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+    INT16S        s16EntityIndex = -1;
+    INT8U        *pu8ParameterEntity, *pu8ParameterEntityEnd;
+    INT32U        u32EntitySlot;
+    INT8U  const *pu8EntityValue = STD_NULL;
+    BOOLEAN       bParameterEntities = STD_FALSE;
+    BOOLEAN       bFoundGeneralEntities = STD_FALSE;
+#endif
+    INT8U        *pu8WorkingBuffer;
+    INT8U  const *pu8CurrentXMLCharacter;
+    INT32U         u32BufferIndex, u32CheckingDataAmount, u32BracketIndex = 0U;
+    INT32U         u32DataLength = 0U;
+    BOOLEAN        bFoundNonWhiteSpaceCharacter = STD_FALSE;
+    BOOLEAN        bDTDEndIsFound = STD_FALSE, bNewMarkupIsFound = STD_FALSE;
+
+    pu8WorkingBuffer                          = pstrParserInstanceType->u8XMLworkingBuffer;
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+    pu8ParameterEntity                        = pu8WorkingBuffer; /* Initail assumption */
+#endif
+    pu8CurrentXMLCharacter                    = pstrParserInstanceType->pu8LastParserLocation;
+    u32CheckingDataAmount                     = LwXMLP_u32GetReadyData(pstrParserInstanceType);
+    pstrParserInstanceType->bEndOfDataIsFound = STD_FALSE;
+    for(u32BufferIndex = 0U; \
+       (u32BufferIndex < u32CheckingDataAmount) && \
+       (pstrParserInstanceType->objenumErrorType == csNoError)&&\
+       (bNewMarkupIsFound == STD_FALSE)&&\
+       (u32BufferIndex < MAX_WORKING_BUFFER_SIZE); \
+       ++u32BufferIndex)
     {
-        for(u8BOMByteIndex = 0U; u8BOMByteIndex < objstrBOMDescriptorType[u8BOMIndex].u8EncodingBOMLength; u8BOMByteIndex++)
+        if(*pu8CurrentXMLCharacter == LESS_THAN_ASCII_CHARACTER)
+        {
+            bNewMarkupIsFound = STD_TRUE;
+        }
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+        else if(((INT8U)*pu8CurrentXMLCharacter) == PERCENT_ASCII_CHARACTER)
+        {
+            bParameterEntities           = STD_TRUE;
+            bFoundNonWhiteSpaceCharacter = STD_TRUE;
+            pu8ParameterEntity           = pu8WorkingBuffer;
+        }
+        else if(((INT8U)*pu8CurrentXMLCharacter) == AMPERSAND_ASCII_CHARACTER)
+        {
+            bFoundGeneralEntities = STD_TRUE;
+        }
+        else if((((INT8U)*pu8CurrentXMLCharacter) == SEMICOLON_ASCII_CHARACTER) && (bParameterEntities == STD_TRUE))
+        {
+            bNewMarkupIsFound = STD_TRUE;
+            *pu8WorkingBuffer = *pu8CurrentXMLCharacter;
+            pu8WorkingBuffer++;
+            u32DataLength++;
+        }
+        else if((((INT8U)*pu8CurrentXMLCharacter) == SEMICOLON_ASCII_CHARACTER) && (bFoundGeneralEntities == STD_TRUE))
         {
-            if((INT8U)objstrBOMDescriptorType[u8BOMIndex].pu8EncodingBOM[u8BOMByteIndex] != \
-               (INT8U)pu8XMLPortion[u8BOMByteIndex])
+            pstrParserInstanceType->objenumErrorType = csGeneralEntityInDTD;
+        }
+#endif
+        else if(((INT8U)*pu8CurrentXMLCharacter) == CLOSING_BRACKET_CHARACTER)
+        {
+            if(bDTDEndIsFound == STD_FALSE)
             {
-                break;
+                bDTDEndIsFound  = STD_TRUE;
+                u32BracketIndex = u32BufferIndex;
+            }
+            else
+            {
+                pstrParserInstanceType->objenumErrorType = csDTDMissingPortionError;
+                LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "DTD is missing portion");
             }
         }
-        if((u8BOMByteIndex == objstrBOMDescriptorType[u8BOMIndex].u8EncodingBOMLength) &&
-           ((objstrBOMDescriptorType[u8BOMIndex].u8EncodingBOMLength <= u32XMLPortionSize)))
+        else if(*pu8CurrentXMLCharacter == GREATER_THAN_ASCII_CHARACTER)
         {
-            pstrParserInstanceType->objenumEncodingTypeType  = \
-                    objstrBOMDescriptorType[u8BOMIndex].objenumEncodingTypeType;
-            /* will not consume the length of the BOM to be parsed by the parser */
-            if(pu8XMLPortion[0] == 0x3CU)
+            if(((u32BracketIndex + 1U) == u32BufferIndex) &&  (bDTDEndIsFound == STD_TRUE))
             {
-                u8availableBOMLength = 0;
+                u32DataLength++;
             }
             else
             {
-                u8availableBOMLength = objstrBOMDescriptorType[u8BOMIndex].u8EncodingBOMLength;
+                pstrParserInstanceType->objenumErrorType = csDTDMissingPortionError;
+                LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "DTD is missing portion");
             }
-            switch(objstrBOMDescriptorType[u8BOMIndex].objenumEncodingTypeType)
+            break;
+        }
+        else if(LwXMLP_bIsWhiteSpace(pu8CurrentXMLCharacter) == STD_FALSE)
+        {
+            bFoundNonWhiteSpaceCharacter = STD_TRUE;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+        if(bNewMarkupIsFound == STD_FALSE)
+        {
+            *pu8WorkingBuffer = *pu8CurrentXMLCharacter;
+            pu8WorkingBuffer++;
+            u32DataLength++;
+            pu8CurrentXMLCharacter++;
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_OFF)
+            if(pstrParserInstanceType->pu8CircularBufferEnd == pu8CurrentXMLCharacter)
             {
-                case csEncoding_EBCDIC:
-                     /* EBCDIC */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: EBCDIC");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_UCS4_2143:
-                     /* UCS4_2143 */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UCS4_2143");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_UCS4_3412:
-                     /* UCS4_3412 */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UCS4_3412");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_UTF8:
-                     /* UTF-8 */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UTF8");
-                     break;
-                case csEncoding_UTF16LE:
-                     /* UTF-16LE */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UTF16LE");
-                     break;
-                case csEncoding_UTF16BE:
-                     /* UTF-16BE */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UTF16BE");
-                     break;
-                case csEncoding_UCS4LE:
-                     /* UCS4LE */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UCS4LE");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_UCS4BE:
-                     /* UCS4BE */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UCS4BE");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_UCS2:
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: UCS2");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_8859_1:      /*!< ISO-8859-1 ISO Latin 1 */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_1");
-                     break;
-                case csEncoding_8859_2:      /*!< ISO-8859-2 ISO Latin 2 */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_2");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_8859_3:      /*!< ISO-8859-3 */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_3");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_8859_4:      /*!< ISO-8859-4 */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_4");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_8859_5:      /*!< ISO-8859-5 */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_5");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_8859_6:      /*!< ISO-8859-6 */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_6");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_8859_7:      /*!< ISO-8859-7 */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_7");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_8859_8:      /*!< ISO-8859-8 */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_8");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_8859_9:      /*!< ISO-8859-9 */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 8859_9");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_2022_JP:     /*!< ISO-2022-JP */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: 2022_JP");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_SHIFT_JIS:   /*!< Shift_JIS */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: SHIFT_JIS");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_EUC_JP:      /*!< EUC-JP */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: EUC_JP");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_ASCII:       /*!< pure ASCII */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: ASCII");
-                     break;
-                case csEncoding_ERROR:
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found BOM Type: ERROR");
-                     pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
-                     break;
-                case csEncoding_NONE:
-                     /* Nothing */
-                default:
-                     /* NO BOM, will use the UTF-8 s a default encoding scheme */
-                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "No BOM is Found use: UTF8");
-                     break;
+                pu8CurrentXMLCharacter = pstrParserInstanceType->pu8CircularBufferStart;
+            }
+            else
+            {
+                /* nothing to do here */
+            }
+#endif
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+    }
+    if((bDTDEndIsFound == STD_TRUE) && (pstrParserInstanceType->objenumErrorType == csNoError))
+    {
+        pstrParserInstanceType->bParsingDTDInProgress = STD_FALSE;
+        LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32DataLength);
+#if(ENABLE_DTD_CACHE == STD_ON)
+        if(pstrParserInstanceType->objenumDTDCacheStateType == csDTDCacheRecording)
+        {
+            LwXMLP_vStoreDTDCacheEntry(pstrParserInstanceType);
+            pstrParserInstanceType->objenumDTDCacheStateType = csDTDCacheIdle;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+#endif
+    }
+    else if((bNewMarkupIsFound == STD_TRUE) && (pstrParserInstanceType->objenumErrorType == csNoError))
+    {
+        if(bFoundNonWhiteSpaceCharacter == STD_TRUE)
+        {
+            *pu8WorkingBuffer = NULL_ASCII_CHARACTER;
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+            /* Now check the Parameter Entities if any */
+            if(bParameterEntities == STD_TRUE)
+            {
+                LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32DataLength);
+                pstrParserInstanceType->objenumErrorType = LwXMLP_enumValidatePEReference(\
+                                                pstrParserInstanceType->u8XMLworkingBuffer, \
+                                                &pstrParserInstanceType->u32Length);
+                if(pstrParserInstanceType->objenumErrorType == csNoError)
+                {
+                    pu8ParameterEntityEnd = (INT8U *)strchr((INT8S const *)&pu8ParameterEntity[1U], SEMICOLON_ASCII_CHARACTER);
+                    if(pu8ParameterEntityEnd != STD_NULL)
+                    {
+                        s16EntityIndex = LwXMLP_s16FindEntity(pstrParserInstanceType, \
+                                                              &pu8ParameterEntity[1U], \
+                                                              (INT32U)(pu8ParameterEntityEnd - &pu8ParameterEntity[1U]), \
+                                                              csParamterEntity, \
+                                                              &u32EntitySlot);
+                        if(s16EntityIndex >= 0)
+                        {
+                            pu8EntityValue = pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[s16EntityIndex].pu8EntityValue;
+                        }
+                        else
+                        {
+                            /*
+                             * Nothing to do
+                             */
+                        }
+                    }
+                    else
+                    {
+                        /*
+                         * Nothing to do
+                         */
+                    }
+                    if(pu8EntityValue == STD_NULL)
+                    {
+                        pstrParserInstanceType->objenumErrorType = csInvalidParameterEntity;
+                    }
+                    else if(pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[s16EntityIndex].objenumEntityStoreTypeType == csExternalStorage)
+                    {
+                        pstrParserInstanceType->bFoundExternalEntity = STD_TRUE;
+                    }
+                    else
+                    {
+                        LwXMLP_vPushInputSource(pstrParserInstanceType, s16EntityIndex, STD_FALSE, STD_FALSE);
+                    }
+                }
+                else
+                {
+                    /*
+                     * Nothing to do
+                     */
+                }
+            }
+            else
+            {
+                /* Nothing to do here */
+            }
+#else
+            LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32DataLength);
+#endif
+        }
+        else /* it is insignificant white space */
+        {
+            LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32DataLength);
+            pstrParserInstanceType->bEndOfDataIsFound = STD_FALSE;
+        }
+    }
+    else if((u32BufferIndex == MAX_CIRCULAR_BUFFER_SIZE) || (u32BufferIndex == MAX_WORKING_BUFFER_SIZE)) /* if we looked for character and isn't found and reach the buffer end */
+    {
+        pstrParserInstanceType->objenumErrorType = csLargeDTDPortionlength;
+        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Can't load the XML Tag into the buffer");
+    }
+    else
+    {
+        /* unexpected */
+    }
+}
+#endif
+#if(ENABLE_DTD_CACHE == STD_ON)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_bScanDTDCacheKey                                        <LwXMLP_CORE>
+
+SYNTAX:         BOOLEAN LwXMLP_bScanDTDCacheKey(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   Scan the received bytes of the internal DTD subset till its closing bracket to compute its key, then
+                look it up in the DTD cache, if it is found its compiled tables are attached to the instance and the
+                subset is consumed without being parsed, otherwise an entry is reserved to record the tables once the
+                subset is parsed
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+
+RETURN VALUE:   STD_TRUE if the scanning is done, STD_FALSE if more data is needed to find the end of the subset
+
+Note        :   The subsets which contain comments, processing instructions or parameter entity references aren't
+                cached, as the parsing of them may fire events, and so the subsets which are longer than
+                MAX_DTD_CACHE_SUBSET_LENGTH or can't fit in the circular buffer
+END DESCRIPTION *******************************************************************************************************/
+static BOOLEAN LwXMLP_bScanDTDCacheKey(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+{
+    strDTDCacheEntryType       *pstrDTDCacheEntryType = STD_NULL;
+    INT8U                const *pu8Character;
+    INT32U                      u32ReadyAmount, u32SubsetLength, u32Offset;
+    INT8U                       u8EntryIndex;
+    BOOLEAN                     bSubsetEndIsFound = STD_FALSE, bScanningIsDone = STD_FALSE;
+
+    u32ReadyAmount = LwXMLP_u32GetReadyData(pstrParserInstanceType);
+    while((pstrParserInstanceType->u32DTDCacheScanOffset < u32ReadyAmount) && (bScanningIsDone == STD_FALSE))
+    {
+        pu8Character = LwXMLP_pu8GetReadyCharacter(pstrParserInstanceType, pstrParserInstanceType->u32DTDCacheScanOffset);
+        if(pstrParserInstanceType->bDTDCacheInsideMarkup == STD_FALSE)
+        {
+            if(*pu8Character == CLOSING_BRACKET_CHARACTER)
+            {
+                bSubsetEndIsFound = STD_TRUE;
+                bScanningIsDone   = STD_TRUE;
+            }
+            else if(*pu8Character == LESS_THAN_ASCII_CHARACTER)
+            {
+                pstrParserInstanceType->bDTDCacheInsideMarkup   = STD_TRUE;
+                pstrParserInstanceType->u32DTDCacheMarkupOffset = pstrParserInstanceType->u32DTDCacheScanOffset;
+            }
+            else if(*pu8Character == PERCENT_ASCII_CHARACTER)
+            {
+                bScanningIsDone = STD_TRUE;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+        }
+        else if(pstrParserInstanceType->u8DTDCacheQuote != 0U)
+        {
+            if(*pu8Character == pstrParserInstanceType->u8DTDCacheQuote)
+            {
+                pstrParserInstanceType->u8DTDCacheQuote = 0U;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+        }
+        else if(((*pu8Character == QUESTION_MARK_ASCII_CHARACTER) && \
+                 (pstrParserInstanceType->u32DTDCacheScanOffset == (pstrParserInstanceType->u32DTDCacheMarkupOffset + 1U))) || \
+                ((*pu8Character == HYPHEN_ASCII_CHARACTER) && \
+                 (pstrParserInstanceType->u32DTDCacheScanOffset == (pstrParserInstanceType->u32DTDCacheMarkupOffset + 2U))))
+        {/* processing instruction or comment */
+            bScanningIsDone = STD_TRUE;
+        }
+        else if((*pu8Character == DOUBLE_QUOT_ASCII_CHARACTER) || (*pu8Character == SINGLE_QUOT_ASCII_CHARACTER))
+        {
+            pstrParserInstanceType->u8DTDCacheQuote = *pu8Character;
+        }
+        else if(*pu8Character == GREATER_THAN_ASCII_CHARACTER)
+        {
+            pstrParserInstanceType->bDTDCacheInsideMarkup = STD_FALSE;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+        if(bScanningIsDone == STD_FALSE)
+        {
+            pstrParserInstanceType->u32DTDCacheSubsetHash = LwXMLP_u32HashBytes(pstrParserInstanceType->u32DTDCacheSubsetHash, \
+                                                                                pu8Character, 1U);
+            pstrParserInstanceType->u32DTDCacheScanOffset++;
+            if(pstrParserInstanceType->u32DTDCacheScanOffset > MAX_DTD_CACHE_SUBSET_LENGTH)
+            {
+                bScanningIsDone = STD_TRUE;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
             }
-           break;
         }
         else
         {
@@ -2518,12 +5591,75 @@ static INT8U LwXMLP_u8CheckBOM(      LwXMLP_strXMLParseInstanceType *pstrParserI
              */
         }
     }
-
-#if(SUPPORT_ASCII_ONLY == STD_ON)
-    if((pstrParserInstanceType->objenumEncodingTypeType != csEncoding_ASCII) &&\
-       (pstrParserInstanceType->objenumEncodingTypeType != csEncoding_NONE))
+    if(bSubsetEndIsFound == STD_TRUE)
     {
-        pstrParserInstanceType->objenumErrorType = csUnsupportedEncodingScheme;
+        u32SubsetLength = pstrParserInstanceType->u32DTDCacheScanOffset;
+        LwXMLP_mEnterDTDCriticalSection();
+        for(u8EntryIndex = 0U; (u8EntryIndex < MAX_DTD_CACHE_ENTRIES) && (pstrDTDCacheEntryType == STD_NULL); u8EntryIndex++)
+        {
+            pstrDTDCacheEntryType = &objstrDTDCacheType.objstrDTDCacheEntryType[u8EntryIndex];
+            if((pstrDTDCacheEntryType->objenumDTDCacheEntryStateType == csDTDCacheEntryValid) && \
+               (pstrDTDCacheEntryType->u32SubsetHash == pstrParserInstanceType->u32DTDCacheSubsetHash) && \
+               (pstrDTDCacheEntryType->u32SubsetLength == u32SubsetLength))
+            {
+                for(u32Offset = 0U; \
+                   (u32Offset < u32SubsetLength) && \
+                   (*LwXMLP_pu8GetReadyCharacter(pstrParserInstanceType, u32Offset) == pstrDTDCacheEntryType->u8Subset[u32Offset]); \
+                   u32Offset++)
+                {
+                    /*
+                     * Compare the subset
+                     */
+                }
+                if(u32Offset != u32SubsetLength)
+                {
+                    pstrDTDCacheEntryType = STD_NULL;
+                }
+                else
+                {
+                    /*
+                     * Nothing to do
+                     */
+                }
+            }
+            else
+            {
+                pstrDTDCacheEntryType = STD_NULL;
+            }
+        }
+        if(pstrDTDCacheEntryType != STD_NULL)
+        {
+            LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "The DTD subset is found in the DTD cache");
+            LwXMLP_vAttachDTDCacheEntry(pstrParserInstanceType, pstrDTDCacheEntryType);
+            LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32SubsetLength);
+            pstrParserInstanceType->objenumDTDCacheStateType = csDTDCacheIdle;
+        }
+        else
+        {
+            u8EntryIndex                         = objstrDTDCacheType.u8NextEntryIndex;
+            objstrDTDCacheType.u8NextEntryIndex  = (INT8U)((u8EntryIndex + 1U) % MAX_DTD_CACHE_ENTRIES);
+            pstrDTDCacheEntryType                = &objstrDTDCacheType.objstrDTDCacheEntryType[u8EntryIndex];
+            LwXMLP_vFreeDTDCacheEntry(pstrDTDCacheEntryType);
+            pstrDTDCacheEntryType->objenumDTDCacheEntryStateType = csDTDCacheEntryFilling;
+            pstrDTDCacheEntryType->u32SubsetHash                 = pstrParserInstanceType->u32DTDCacheSubsetHash;
+            pstrDTDCacheEntryType->u32SubsetLength               = u32SubsetLength;
+            for(u32Offset = 0U; u32Offset < u32SubsetLength; u32Offset++)
+            {
+                pstrDTDCacheEntryType->u8Subset[u32Offset] = *LwXMLP_pu8GetReadyCharacter(pstrParserInstanceType, u32Offset);
+            }
+            pstrParserInstanceType->u8DTDCacheEntryIndex     = u8EntryIndex;
+            pstrParserInstanceType->objenumDTDCacheStateType = csDTDCacheRecording;
+        }
+        LwXMLP_mExitDTDCriticalSection();
+    }
+    else if(bScanningIsDone == STD_TRUE)
+    {
+        pstrParserInstanceType->objenumDTDCacheStateType = csDTDCacheIdle;
+    }
+    else if(LwXMLP_u32GetFreeSpace(pstrParserInstanceType) == 0U)
+    {/* the end of the subset can't be received */
+        pstrParserInstanceType->objenumDTDCacheStateType = csDTDCacheIdle;
+        bScanningIsDone = STD_TRUE;
     }
     else
     {
@@ -2531,557 +5667,888 @@ static INT8U LwXMLP_u8CheckBOM(      LwXMLP_strXMLParseInstanceType *pstrParserI
          * Nothing to do
          */
     }
-#endif
 
-    return u8availableBOMLength;
+    return bScanningIsDone;
 }
-/**********************************************************************************************************************/
-/*!\fn         INT8U LwXMLP_u8ValidNameCharacter(INT8U const *pu8Character)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vAttachDTDCacheEntry                                        <LwXMLP_CORE>
 
-@brief         This API is responsible to Validate the character if it is NameChar according to W3C definition which
-               should be in range  NameStartChar | "-" | "." | [0-9] | #xB7 | [#x0300-#x036F] | [#x203F-#x2040]
-               The LwXMLP assume that all the parsed string are encoded in UTF-8, so this API will get the code point
-               from the UTF-8 sequence to be compared with the W3C range.
+SYNTAX:         void LwXMLP_vAttachDTDCacheEntry(LwXMLP_strXMLParseInstanceType       *pstrParserInstanceType, \
+                                                 strDTDCacheEntryType           const *pstrDTDCacheEntryType)
 
-@param[in]     pu8Character : Pointer to the location of the character
+DESCRIPTION :   Make the instance refer to the DTD tables of an entry of the DTD cache instead of its own tables
 
-@return        Length of the valid UTF-8 sequence
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   pstrDTDCacheEntryType  : pointer to the valid entry of the DTD cache
 
+RETURN VALUE:   None
 
-@note
-***********************************************************************************************************************/
-static INT8U LwXMLP_u8ValidNameCharacter(INT8U const *pu8Character)
+Note        :   The tables are shared, so the instance copies them if it adds a declaration later
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vAttachDTDCacheEntry(LwXMLP_strXMLParseInstanceType       *pstrParserInstanceType, \
+                                        strDTDCacheEntryType           const *pstrDTDCacheEntryType)
 {
-#if(SUPPORT_ASCII_ONLY == STD_OFF)
-    INT32U  u32CodePoint = 0U;
-#endif
-    INT8U   u8CharacterLength;
+    LwXMLP_vReleaseDTDTables(pstrParserInstanceType->pstrDTDTablesType);
+    pstrParserInstanceType->pstrDTDTablesType = pstrDTDCacheEntryType->pstrDTDTablesType;
+    pstrParserInstanceType->pstrDTDTablesType->u16ReferenceCount++;
+    pstrParserInstanceType->bFoundExternalEntity = pstrDTDCacheEntryType->bFoundExternalEntity;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vStoreDTDCacheEntry                                        <LwXMLP_CORE>
 
-    if((isalpha((INT8U)(*pu8Character)) != 0) || \
-       ((INT8U)(*pu8Character) == COLON_ASCII_CHARACTER) || \
-       ((INT8U)(*pu8Character) == UNDERSCORE_ASCII_CHARACTER)||\
-       ((((INT8U)(*pu8Character)) - ZERO_ASCII_CHARACTER) < 10U) ||\
-       ((INT8U)(*pu8Character) == DOT_ASCII_CHARACTER) ||\
-       ((INT8U)(*pu8Character) == HYPHEN_ASCII_CHARACTER))
-    {
-        u8CharacterLength = 1U;
-    }
-#if(SUPPORT_ASCII_ONLY == STD_OFF)
-    else if((*pu8Character & 0xE0U) == 0xC0U) /* 110X XXXX  two *pu8Characterlength */
+SYNTAX:         void LwXMLP_vStoreDTDCacheEntry(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+
+DESCRIPTION :   Make the DTD cache entry which is reserved for the internal DTD subset of the instance refer to the DTD
+                tables of the instance and make the entry valid
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance which has just parsed its internal DTD subset
+
+RETURN VALUE:   None
+
+Note        :   Nothing is stored if the entry is taken by another instance in the meantime
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vStoreDTDCacheEntry(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+{
+    strDTDCacheEntryType *pstrDTDCacheEntryType;
+
+    LwXMLP_mEnterDTDCriticalSection();
+    pstrDTDCacheEntryType = &objstrDTDCacheType.objstrDTDCacheEntryType[pstrParserInstanceType->u8DTDCacheEntryIndex];
+    if((pstrDTDCacheEntryType->objenumDTDCacheEntryStateType == csDTDCacheEntryFilling) && \
+       (pstrDTDCacheEntryType->u32SubsetHash == pstrParserInstanceType->u32DTDCacheSubsetHash))
     {
-        u8CharacterLength = 2U;
-        u32CodePoint = (((INT32U)pu8Character[0] - 192U) * 64U) + \
-                        ((INT32U)pu8Character[1U] - 128U);
+        pstrDTDCacheEntryType->pstrDTDTablesType = pstrParserInstanceType->pstrDTDTablesType;
+        pstrDTDCacheEntryType->pstrDTDTablesType->u16ReferenceCount++;
+        pstrDTDCacheEntryType->bFoundExternalEntity          = pstrParserInstanceType->bFoundExternalEntity;
+        pstrDTDCacheEntryType->objenumDTDCacheEntryStateType = csDTDCacheEntryValid;
     }
-    else if((*pu8Character & 0xF0U) == 0xE0U) /* 1110 XXXX  three *pu8Characterlength */
+    else
     {
-        u8CharacterLength = 3U;
-        u32CodePoint = (((INT32U)pu8Character[0] - 224U) * 4096U) + \
-                       (((INT32U)pu8Character[1U] - 128U) * 64U) + \
-                       ((INT32U)pu8Character[2] - 128U);
+        /*
+         * Nothing to do
+         */
     }
-    else if((*pu8Character & 0xF8U) == 0xF0U) /* 1111 0XXX  four *pu8Characterlength */
+    LwXMLP_mExitDTDCriticalSection();
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vFreeDTDCacheEntry                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vFreeDTDCacheEntry(strDTDCacheEntryType *pstrDTDCacheEntryType)
+
+DESCRIPTION :   Release the DTD tables of a valid entry of the DTD cache and mark the entry as free
+
+PARAMETER1  :   pstrDTDCacheEntryType : pointer to the entry of the DTD cache
+
+RETURN VALUE:   None
+
+Note        :   The instances which refer to the tables keep them till they are closed
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vFreeDTDCacheEntry(strDTDCacheEntryType *pstrDTDCacheEntryType)
+{
+    if(pstrDTDCacheEntryType->objenumDTDCacheEntryStateType == csDTDCacheEntryValid)
     {
-        u8CharacterLength = 4U;
-        u32CodePoint  = (((INT32U)pu8Character[0] - 240U) * 262144U) + \
-                        (((INT32U)pu8Character[1U] - 128U) * 4096U) + \
-                        (((INT32U)pu8Character[2] - 128U) * 64U) + \
-                        ((INT32U)pu8Character[3] - 128U);
+        LwXMLP_vReleaseDTDTables(pstrDTDCacheEntryType->pstrDTDTablesType);
+        pstrDTDCacheEntryType->pstrDTDTablesType = STD_NULL;
     }
-#endif
     else
     {
-        u8CharacterLength = 0U;
-    }
-#if(SUPPORT_ASCII_ONLY == STD_OFF)
-    if(u8CharacterLength > 1U)
-    {
-        if((u32CodePoint == 0x00B7U)||\
-           ((u32CodePoint >= 0x00C0U) && (u32CodePoint <= 0x00D6U))||\
-           ((u32CodePoint >= 0x00D8U) && (u32CodePoint <= 0x00F6U))||\
-           ((u32CodePoint >= 0x00F8U) && (u32CodePoint <= 0x37DU))||\
-           ((u32CodePoint >= 0x037FU) && (u32CodePoint <= 0x1FFFU))||\
-           ((u32CodePoint >= 0x200CU) && (u32CodePoint <= 0x200DU))||\
-           ((u32CodePoint >= 0x203FU) && (u32CodePoint <= 0x2040U))||\
-           ((u32CodePoint >= 0x2070U) && (u32CodePoint <= 0x218FU))||\
-           ((u32CodePoint >= 0x2C00U) && (u32CodePoint <= 0x2FEFU))||\
-           ((u32CodePoint >= 0x3001U) && (u32CodePoint <= 0xD7FFU))||\
-           ((u32CodePoint >= 0xF900U) && (u32CodePoint <= 0xFDCFU))||\
-           ((u32CodePoint >= 0xFDF0U) && (u32CodePoint <= 0xFFFDU))||\
-           ((u32CodePoint >= 0x10000U) && (u32CodePoint <= 0xEFFFFU)))
-        {
-            /*
-             * Nothing to do
-             */
-        }
-        else
-        {
-            u8CharacterLength = 0U;
-        }
+        /*
+         * Nothing to do
+         */
     }
-#endif
-
-    return u8CharacterLength;
+    pstrDTDCacheEntryType->objenumDTDCacheEntryStateType = csDTDCacheEntryFree;
 }
-/**********************************************************************************************************************/
-/*!\fn         INT8U LwXMLP_u8ValidNameStartCharacter(INT8U const *pu8Character)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vSerializeBytes                                        <LwXMLP_CORE>
 
-@brief         Validate the character if it is NameStartChar according to W3C definition which should be in range
-                ":" | [A-Z] | "_" | [a-z] | [#xC0-#xD6] | [#xD8-#xF6] | [#xF8-#x2FF] | [#x370-#x37D] |
-                [#x37F-#x1FFF] | [#x200C-#x200D] | [#x2070-#x218F] | [#x2C00-#x2FEF] | [#x3001-#xD7FF] |
-                [#xF900-#xFDCF] | [#xFDF0-#xFFFD] | [#x10000-#xEFFFF]
-               the LwXMLP assume that all the parsed string are encoded in UTF-8, so this API will get the code point
-               from the UTF-8 sequence to be compared with the W3C range.
+SYNTAX:         void LwXMLP_vSerializeBytes(INT8U       *pu8Buffer, \
+                                            INT32U       u32BufferSize, \
+                                            INT32U      *pu32SerializedLength, \
+                                            void  const *pvBytes, \
+                                            INT32U       u32BytesLength)
 
-@param[in]       pu8Character : Pointer to the location of the character
+DESCRIPTION :   Append bytes to the serialized DTD cache if they fit in the buffer, the serialized length is advanced
+                in all cases so it gives the needed size of the buffer at the end
 
-@return         Length of the valid UTF-8 sequence
+PARAMETER1  :   pu8Buffer            : the buffer of the serialized DTD cache or STD_NULL
+PARAMETER2  :   u32BufferSize        : the size of pu8Buffer
+PARAMETER3  :   pu32SerializedLength : the length of the serialized data, it is advanced by u32BytesLength
+PARAMETER4  :   pvBytes              : the bytes to be appended
+PARAMETER5  :   u32BytesLength       : the number of the bytes to be appended
 
-@note
-***********************************************************************************************************************/
-static INT8U LwXMLP_u8ValidNameStartCharacter(INT8U const *pu8Character)
-{
-#if(SUPPORT_ASCII_ONLY == STD_OFF)
-    INT32U  u32CodePoint = 0U;
-#endif
-    INT8U   u8CharacterLength;
+RETURN VALUE:   None
 
-    if((isalpha((INT8U)(*pu8Character)) != 0) || \
-       ((INT8U)(*pu8Character) == COLON_ASCII_CHARACTER) || \
-       ((INT8U)(*pu8Character) == UNDERSCORE_ASCII_CHARACTER))
-    {
-        u8CharacterLength = 1U;
-    }
-#if(SUPPORT_ASCII_ONLY == STD_OFF)
-    else if((*pu8Character & 0xE0U) == 0xC0U) /* 110X XXXX  two *pu8Characterlength */
+Note        :
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vSerializeBytes(INT8U       *pu8Buffer, \
+                                   INT32U       u32BufferSize, \
+                                   INT32U      *pu32SerializedLength, \
+                                   void  const *pvBytes, \
+                                   INT32U       u32BytesLength)
+{
+    if((pu8Buffer != STD_NULL) && (*pu32SerializedLength <= u32BufferSize) && \
+       (u32BytesLength <= (u32BufferSize - *pu32SerializedLength)))
     {
-        u8CharacterLength = 2U;
-        u32CodePoint = (((INT32U)pu8Character[0] - 192U) * 64U) + \
-                       ((INT32U)pu8Character[1U] - 128U);
+        (void)memcpy(&pu8Buffer[*pu32SerializedLength], pvBytes, u32BytesLength);
     }
-    else if((*pu8Character & 0xF0U) == 0xE0U) /* 1110 XXXX  three *pu8Characterlength */
+    else
     {
-        u8CharacterLength = 3U;
-        u32CodePoint = (((INT32U)pu8Character[0] - 224U) * 4096U) + \
-                       (((INT32U)pu8Character[1U] - 128U) * 64U) + \
-                       ((INT32U)pu8Character[2] - 128U);
+        /*
+         * Nothing to do
+         */
     }
-    else if((*pu8Character & 0xF8U) == 0xF0U) /* 1111 0XXX  four *pu8Characterlength */
+    *pu32SerializedLength += u32BytesLength;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_bDeserializeBytes                                        <LwXMLP_CORE>
+
+SYNTAX:         BOOLEAN LwXMLP_bDeserializeBytes(INT8U const *pu8Buffer, \
+                                                 INT32U       u32BufferLength, \
+                                                 INT32U      *pu32ReadLength, \
+                                                 void        *pvBytes, \
+                                                 INT32U       u32BytesLength)
+
+DESCRIPTION :   Read the next bytes of a serialized DTD cache
+
+PARAMETER1  :   pu8Buffer       : the buffer of the serialized DTD cache
+PARAMETER2  :   u32BufferLength : the length of the data in pu8Buffer
+PARAMETER3  :   pu32ReadLength  : the number of the read bytes of pu8Buffer, it is advanced by u32BytesLength
+PARAMETER4  :   pvBytes         : the destination of the read bytes
+PARAMETER5  :   u32BytesLength  : the number of the bytes to be read
+
+RETURN VALUE:   STD_TRUE if the bytes are read, STD_FALSE if the buffer ends before them
+
+Note        :
+END DESCRIPTION *******************************************************************************************************/
+static BOOLEAN LwXMLP_bDeserializeBytes(INT8U const *pu8Buffer, \
+                                        INT32U       u32BufferLength, \
+                                        INT32U      *pu32ReadLength, \
+                                        void        *pvBytes, \
+                                        INT32U       u32BytesLength)
+{
+    BOOLEAN bBytesAreRead = STD_FALSE;
+
+    if(u32BytesLength <= (u32BufferLength - *pu32ReadLength))
     {
-        u8CharacterLength = 4U;
-        u32CodePoint  = (((INT32U)pu8Character[0] - 240U) * 262144U) + \
-                        (((INT32U)pu8Character[1U] - 128U) * 4096U) + \
-                        (((INT32U)pu8Character[2] - 128U) * 64U) + \
-                        ((INT32U)pu8Character[3] - 128U);
+        (void)memcpy(pvBytes, &pu8Buffer[*pu32ReadLength], u32BytesLength);
+        *pu32ReadLength += u32BytesLength;
+        bBytesAreRead    = STD_TRUE;
     }
-#endif
     else
     {
-        u8CharacterLength = 0U;
+        /*
+         * Nothing to do
+         */
     }
-#if(SUPPORT_ASCII_ONLY == STD_OFF)
-    if(u8CharacterLength > 1U)
-    {
-        if(((u32CodePoint >= 0x00C0U) && (u32CodePoint <= 0x00D6U))||\
-           ((u32CodePoint >= 0x00D8U) && (u32CodePoint <= 0x00F6U))||\
-           ((u32CodePoint >= 0x00F8U) && (u32CodePoint <= 0x2FFU))||\
-           ((u32CodePoint >= 0x0370U) && (u32CodePoint <= 0x37DU))||\
-           ((u32CodePoint >= 0x037FU) && (u32CodePoint <= 0x1FFFU))||\
-           ((u32CodePoint >= 0x200CU) && (u32CodePoint <= 0x200DU))||\
-           ((u32CodePoint >= 0x2070U) && (u32CodePoint <= 0x218FU))||\
-           ((u32CodePoint >= 0x2C00U) && (u32CodePoint <= 0x2FEFU))||\
-           ((u32CodePoint >= 0x3001U) && (u32CodePoint <= 0xD7FFU))||\
-           ((u32CodePoint >= 0xF900U) && (u32CodePoint <= 0xFDCFU))||\
-           ((u32CodePoint >= 0xFDF0U) && (u32CodePoint <= 0xFFFDU))||\
-           ((u32CodePoint >= 0x10000U) && (u32CodePoint <= 0xEFFFFU)))
-        {
-            /*
-             * Nothing to do
-             */
+
+    return bBytesAreRead;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vSerializeDTDCacheEntry                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vSerializeDTDCacheEntry(strDTDCacheEntryType const *pstrDTDCacheEntryType, \
+                                                    INT8U                      *pu8Buffer, \
+                                                    INT32U                      u32BufferSize, \
+                                                    INT32U                     *pu32SerializedLength)
+
+DESCRIPTION :   Append a valid entry of the DTD cache to the serialized DTD cache, only the used parts of the tables
+                are written and the entity strings are written as offsets in the entity arena
+
+PARAMETER1  :   pstrDTDCacheEntryType : pointer to the valid entry
+PARAMETER2  :   pu8Buffer             : the buffer of the serialized DTD cache or STD_NULL
+PARAMETER3  :   u32BufferSize         : the size of pu8Buffer
+PARAMETER4  :   pu32SerializedLength  : the length of the serialized data, it is advanced by the length of the entry
+
+RETURN VALUE:   None
+
+Note        :
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vSerializeDTDCacheEntry(strDTDCacheEntryType const *pstrDTDCacheEntryType, \
+                                           INT8U                      *pu8Buffer, \
+                                           INT32U                      u32BufferSize, \
+                                           INT32U                     *pu32SerializedLength)
+{
+    strDTDTablesType    const *pstrDTDTablesType = pstrDTDCacheEntryType->pstrDTDTablesType;
+    strEntityType       const *pstrEntityType;
+    strCachedEntityType        objstrCachedEntityType;
+    INT16U                     u16EntityIndex;
+
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, &pstrDTDCacheEntryType->u32SubsetHash, \
+                           sizeof(pstrDTDCacheEntryType->u32SubsetHash));
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, &pstrDTDCacheEntryType->u32SubsetLength, \
+                           sizeof(pstrDTDCacheEntryType->u32SubsetLength));
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, pstrDTDCacheEntryType->u8Subset, \
+                           pstrDTDCacheEntryType->u32SubsetLength);
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, &pstrDTDCacheEntryType->bFoundExternalEntity, \
+                           sizeof(pstrDTDCacheEntryType->bFoundExternalEntity));
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, &pstrDTDTablesType->u32EntityArenaLength, \
+                           sizeof(pstrDTDTablesType->u32EntityArenaLength));
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, pstrDTDTablesType->u8EntityArena, \
+                           pstrDTDTablesType->u32EntityArenaLength);
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, &pstrDTDTablesType->u16AvaliableEntities, \
+                           sizeof(pstrDTDTablesType->u16AvaliableEntities));
+    for(u16EntityIndex = 0U; u16EntityIndex < pstrDTDTablesType->u16AvaliableEntities; u16EntityIndex++)
+    {
+        pstrEntityType = &pstrDTDTablesType->objstrEntityType[u16EntityIndex];
+        objstrCachedEntityType.u32EntityNameOffset        = (INT32U)(pstrEntityType->pu8EntityName - pstrDTDTablesType->u8EntityArena);
+        objstrCachedEntityType.u32EntityValueOffset       = (INT32U)(pstrEntityType->pu8EntityValue - pstrDTDTablesType->u8EntityArena);
+        objstrCachedEntityType.u32EntityNameLength        = pstrEntityType->u32EntityNameLength;
+        objstrCachedEntityType.u32EntityValueLength       = pstrEntityType->u32EntityValueLength;
+        objstrCachedEntityType.u32EntityNameHash          = pstrEntityType->u32EntityNameHash;
+        objstrCachedEntityType.objenumReferenceTypeType   = pstrEntityType->objenumReferenceTypeType;
+        objstrCachedEntityType.objenumEntityStoreTypeType = pstrEntityType->objenumEntityStoreTypeType;
+        objstrCachedEntityType.bParsedEntity              = pstrEntityType->bParsedEntity;
+        LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, &objstrCachedEntityType, \
+                               sizeof(objstrCachedEntityType));
+    }
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, pstrDTDTablesType->s16EntityHashTable, \
+                           sizeof(pstrDTDTablesType->s16EntityHashTable));
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, &pstrDTDTablesType->u8AvaliableAttibuteListCount, \
+                           sizeof(pstrDTDTablesType->u8AvaliableAttibuteListCount));
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, pstrDTDTablesType->objstrAttributeListType, \
+                           pstrDTDTablesType->u8AvaliableAttibuteListCount * (INT32U)sizeof(strAttributeListType));
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, &pstrDTDTablesType->u8AttributeListElementCount, \
+                           sizeof(pstrDTDTablesType->u8AttributeListElementCount));
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, pstrDTDTablesType->objstrAttributeListElementType, \
+                           pstrDTDTablesType->u8AttributeListElementCount * (INT32U)sizeof(strAttributeListElementType));
+    LwXMLP_vSerializeBytes(pu8Buffer, u32BufferSize, pu32SerializedLength, pstrDTDTablesType->s16AttributeListHashTable, \
+                           sizeof(pstrDTDTablesType->s16AttributeListHashTable));
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_bDeserializeDTDCacheEntry                                        <LwXMLP_CORE>
+
+SYNTAX:         BOOLEAN LwXMLP_bDeserializeDTDCacheEntry(strDTDCacheEntryType       *pstrDTDCacheEntryType, \
+                                                         INT8U                const *pu8Buffer, \
+                                                         INT32U                      u32BufferLength, \
+                                                         INT32U                     *pu32ReadLength)
+
+DESCRIPTION :   Read the next entry of a serialized DTD cache into new DTD tables, the counts, the offsets and the
+                indexes of the entry are checked to be within the tables, so the entry can't make the parser access
+                outside them
+
+PARAMETER1  :   pstrDTDCacheEntryType : pointer to the free entry of the DTD cache to be loaded
+PARAMETER2  :   pu8Buffer             : the buffer of the serialized DTD cache
+PARAMETER3  :   u32BufferLength       : the length of the data in pu8Buffer
+PARAMETER4  :   pu32ReadLength        : the number of the read bytes of pu8Buffer, it is advanced by the entry length
+
+RETURN VALUE:   STD_TRUE if the entry is loaded and valid, STD_FALSE otherwise
+
+Note        :
+END DESCRIPTION *******************************************************************************************************/
+static BOOLEAN LwXMLP_bDeserializeDTDCacheEntry(strDTDCacheEntryType       *pstrDTDCacheEntryType, \
+                                                INT8U                const *pu8Buffer, \
+                                                INT32U                      u32BufferLength, \
+                                                INT32U                     *pu32ReadLength)
+{
+    strDTDTablesType    *pstrDTDTablesType;
+    strEntityType       *pstrEntityType;
+    strCachedEntityType  objstrCachedEntityType;
+    INT32U               u32Index;
+    BOOLEAN              bEntryIsLoaded;
+
+    pstrDTDTablesType = LwXMLP_pstrAllocateDTDTables();
+    bEntryIsLoaded = (BOOLEAN)((pstrDTDTablesType != STD_NULL) && \
+        (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, &pstrDTDCacheEntryType->u32SubsetHash, \
+                                  sizeof(pstrDTDCacheEntryType->u32SubsetHash)) == STD_TRUE) && \
+        (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, &pstrDTDCacheEntryType->u32SubsetLength, \
+                                  sizeof(pstrDTDCacheEntryType->u32SubsetLength)) == STD_TRUE) && \
+        (pstrDTDCacheEntryType->u32SubsetLength <= MAX_DTD_CACHE_SUBSET_LENGTH) && \
+        (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, pstrDTDCacheEntryType->u8Subset, \
+                                  pstrDTDCacheEntryType->u32SubsetLength) == STD_TRUE) && \
+        (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, &pstrDTDCacheEntryType->bFoundExternalEntity, \
+                                  sizeof(pstrDTDCacheEntryType->bFoundExternalEntity)) == STD_TRUE) && \
+        (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, &pstrDTDTablesType->u32EntityArenaLength, \
+                                  sizeof(pstrDTDTablesType->u32EntityArenaLength)) == STD_TRUE) && \
+        (pstrDTDTablesType->u32EntityArenaLength <= MAX_ENTITY_ARENA_SIZE) && \
+        (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, pstrDTDTablesType->u8EntityArena, \
+                                  pstrDTDTablesType->u32EntityArenaLength) == STD_TRUE) && \
+        (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, &pstrDTDTablesType->u16AvaliableEntities, \
+                                  sizeof(pstrDTDTablesType->u16AvaliableEntities)) == STD_TRUE) && \
+        (pstrDTDTablesType->u16AvaliableEntities <= MAX_ENTITIES));
+    for(u32Index = 0U; (bEntryIsLoaded == STD_TRUE) && (u32Index < pstrDTDTablesType->u16AvaliableEntities); u32Index++)
+    {
+        if((LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, &objstrCachedEntityType, \
+                                     sizeof(objstrCachedEntityType)) == STD_TRUE) && \
+           (objstrCachedEntityType.u32EntityNameOffset < pstrDTDTablesType->u32EntityArenaLength) && \
+           (objstrCachedEntityType.u32EntityNameLength < \
+            (pstrDTDTablesType->u32EntityArenaLength - objstrCachedEntityType.u32EntityNameOffset)) && \
+           (pstrDTDTablesType->u8EntityArena[objstrCachedEntityType.u32EntityNameOffset + \
+                                             objstrCachedEntityType.u32EntityNameLength] == NULL_ASCII_CHARACTER) && \
+           (objstrCachedEntityType.u32EntityValueOffset < pstrDTDTablesType->u32EntityArenaLength) && \
+           (objstrCachedEntityType.u32EntityValueLength < \
+            (pstrDTDTablesType->u32EntityArenaLength - objstrCachedEntityType.u32EntityValueOffset)) && \
+           (pstrDTDTablesType->u8EntityArena[objstrCachedEntityType.u32EntityValueOffset + \
+                                             objstrCachedEntityType.u32EntityValueLength] == NULL_ASCII_CHARACTER))
+        {
+            pstrEntityType = &pstrDTDTablesType->objstrEntityType[u32Index];
+            pstrEntityType->pu8EntityName              = &pstrDTDTablesType->u8EntityArena[objstrCachedEntityType.u32EntityNameOffset];
+            pstrEntityType->pu8EntityValue             = &pstrDTDTablesType->u8EntityArena[objstrCachedEntityType.u32EntityValueOffset];
+            pstrEntityType->u32EntityNameLength        = objstrCachedEntityType.u32EntityNameLength;
+            pstrEntityType->u32EntityValueLength       = objstrCachedEntityType.u32EntityValueLength;
+            pstrEntityType->u32EntityNameHash          = objstrCachedEntityType.u32EntityNameHash;
+            pstrEntityType->objenumReferenceTypeType   = objstrCachedEntityType.objenumReferenceTypeType;
+            pstrEntityType->objenumEntityStoreTypeType = objstrCachedEntityType.objenumEntityStoreTypeType;
+            pstrEntityType->bParsedEntity              = objstrCachedEntityType.bParsedEntity;
         }
         else
         {
-            u8CharacterLength = 0U;
+            bEntryIsLoaded = STD_FALSE;
         }
     }
-#endif
+    bEntryIsLoaded = (BOOLEAN)((bEntryIsLoaded == STD_TRUE) && \
+        (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, pstrDTDTablesType->s16EntityHashTable, \
+                                  sizeof(pstrDTDTablesType->s16EntityHashTable)) == STD_TRUE) && \
+        (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, &pstrDTDTablesType->u8AvaliableAttibuteListCount, \
+                                  sizeof(pstrDTDTablesType->u8AvaliableAttibuteListCount)) == STD_TRUE) && \
+        (pstrDTDTablesType->u8AvaliableAttibuteListCount <= MAX_ATTRIBUTES_LIST) && \
+        (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, pstrDTDTablesType->objstrAttributeListType, \
+                                  pstrDTDTablesType->u8AvaliableAttibuteListCount * (INT32U)sizeof(strAttributeListType)) == STD_TRUE) && \
+        (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, &pstrDTDTablesType->u8AttributeListElementCount, \
+                                  sizeof(pstrDTDTablesType->u8AttributeListElementCount)) == STD_TRUE) && \
+        (pstrDTDTablesType->u8AttributeListElementCount <= MAX_ATTRIBUTES_LIST) && \
+        (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, pstrDTDTablesType->objstrAttributeListElementType, \
+                                  pstrDTDTablesType->u8AttributeListElementCount * (INT32U)sizeof(strAttributeListElementType)) == STD_TRUE) && \
+        (LwXMLP_bDeserializeBytes(pu8Buffer, u32BufferLength, pu32ReadLength, pstrDTDTablesType->s16AttributeListHashTable, \
+                                  sizeof(pstrDTDTablesType->s16AttributeListHashTable)) == STD_TRUE) && \
+        (LwXMLP_bCheckDTDTables(pstrDTDTablesType) == STD_TRUE));
+    if(bEntryIsLoaded == STD_TRUE)
+    {
+        pstrDTDCacheEntryType->pstrDTDTablesType             = pstrDTDTablesType;
+        pstrDTDCacheEntryType->objenumDTDCacheEntryStateType = csDTDCacheEntryValid;
+    }
+    else if(pstrDTDTablesType != STD_NULL)
+    {
+        LwXMLP_vReleaseDTDTables(pstrDTDTablesType);
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
 
-    return u8CharacterLength;
+    return bEntryIsLoaded;
 }
-/**********************************************************************************************************************/
-/*!\fn         INT8U LwXMLP_u8ValidCharacter(INT8U const *pu8Character)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_bCheckDTDTables                                        <LwXMLP_CORE>
 
-@brief         Validate the character if it is Char according to W3C definition which should be in range
-               #x9 | #xA | #xD | [#x20-#xD7FF] | [#xE000-#xFFFD] | [#x10000-#x10FFFF]
-               the LwXMLP assume that all the parsed string are encoded in UTF-8, so this API will get the code point
-               from the UTF-8 sequence to be compared with the W3C range.
+SYNTAX:         BOOLEAN LwXMLP_bCheckDTDTables(strDTDTablesType const *pstrDTDTablesType)
 
-@param[in]       pu8Character : Pointer to the location of the character
+DESCRIPTION :   Check that the indexes of the hash tables and the links of the attribute list declarations of DTD
+                tables which are loaded from a serialized DTD cache are within the tables and that their names are
+                terminated, the hash tables shall not use more slots than the declarations so that the probing always
+                ends at an empty slot
 
-@return         Length of the valid UTF-8 sequence
+PARAMETER1  :   pstrDTDTablesType : pointer to the loaded tables
 
-@note
-***********************************************************************************************************************/
-static INT8U LwXMLP_u8ValidCharacter(INT8U const *pu8Character)
+RETURN VALUE:   STD_TRUE if the tables are consistent, STD_FALSE otherwise
+
+Note        :
+END DESCRIPTION *******************************************************************************************************/
+static BOOLEAN LwXMLP_bCheckDTDTables(strDTDTablesType const *pstrDTDTablesType)
 {
-#if(SUPPORT_ASCII_ONLY == STD_OFF)
-    INT32U  u32CodePoint = 0U;
-#endif
-    INT8U   u8CharacterLength;
+    strAttributeListType        const *pstrAttributeListType;
+    strAttributeListElementType const *pstrAttributeListElementType;
+    INT32U                             u32Index, u32UsedSlots = 0U;
+    BOOLEAN                            bTablesAreConsistent = STD_TRUE;
 
-    if(*pu8Character <= 0x7FU)
+    for(u32Index = 0U; (bTablesAreConsistent == STD_TRUE) && (u32Index < ENTITY_HASH_TABLE_SIZE); u32Index++)
     {
-        if((*pu8Character == 0x09U) ||
-           (*pu8Character == 0x0AU) ||
-           (*pu8Character == 0x0DU) ||
-           (*pu8Character >= 0x20U))
+        if((pstrDTDTablesType->s16EntityHashTable[u32Index] < -1) || \
+           (pstrDTDTablesType->s16EntityHashTable[u32Index] >= (INT16S)pstrDTDTablesType->u16AvaliableEntities))
+        {
+            bTablesAreConsistent = STD_FALSE;
+        }
+        else if(pstrDTDTablesType->s16EntityHashTable[u32Index] >= 0)
         {
-            u8CharacterLength = 1U;
+            u32UsedSlots++;
         }
         else
         {
-            u8CharacterLength = 0U;
+            /*
+             * Nothing to do
+             */
         }
     }
-#if(SUPPORT_ASCII_ONLY == STD_OFF)
-    else if((*pu8Character & 0xE0U) == 0xC0U) /* 110X XXXX  two *pu8Characterlength */
-    {
-        u8CharacterLength = 2U;
-        u32CodePoint = (((INT32U)pu8Character[0] - 192U) * 64U) + \
-                        ((INT32U)pu8Character[1U] - 128U);
-    }
-    else if((*pu8Character & 0xF0U) == 0xE0U) /* 1110 XXXX  three *pu8Characterlength */
+    if(u32UsedSlots > pstrDTDTablesType->u16AvaliableEntities)
     {
-        u8CharacterLength = 3U;
-        u32CodePoint = (((INT32U)pu8Character[0] - 224U) * 4096U) + \
-                       (((INT32U)pu8Character[1U] - 128U) * 64U) + \
-                       ((INT32U)pu8Character[2] - 128U);
+        bTablesAreConsistent = STD_FALSE;
     }
-    else if((*pu8Character & 0xF8U) == 0xF0U) /* 1111 0XXX  four *pu8Characterlength */
+    else
     {
-        u8CharacterLength = 4U;
-        u32CodePoint  = (((INT32U)pu8Character[0] - 240U) * 262144U) + \
-                        (((INT32U)pu8Character[1U] - 128U) * 4096U) + \
-                        (((INT32U)pu8Character[2] - 128U) * 64U) + \
-                        ((INT32U)pu8Character[3] - 128U);
+        /*
+         * Nothing to do
+         */
     }
-#endif
-    else
+    for(u32Index = 0U; (bTablesAreConsistent == STD_TRUE) && (u32Index < pstrDTDTablesType->u8AvaliableAttibuteListCount); u32Index++)
     {
-        u8CharacterLength = 0U;
+        pstrAttributeListType = &pstrDTDTablesType->objstrAttributeListType[u32Index];
+        if((pstrAttributeListType->s16NextAttribute < -1) || \
+           (pstrAttributeListType->s16NextAttribute >= (INT16S)pstrDTDTablesType->u8AvaliableAttibuteListCount) || \
+           (memchr(pstrAttributeListType->u8AttributeName, NULL_ASCII_CHARACTER, MAX_ATTRIBUTES_NAME_LENGTH) == STD_NULL) || \
+           (strlen((INT8S const *)pstrAttributeListType->u8AttributeName) != pstrAttributeListType->u32AttributeNameLength) || \
+           (((pstrAttributeListType->objenumAttributeBehaviourType == csFixed) || \
+             (pstrAttributeListType->objenumAttributeBehaviourType == csDefaultValue)) && \
+            ((memchr(pstrAttributeListType->u8AttributeValue, NULL_ASCII_CHARACTER, MAX_ATTRIBUTES_VALUE_LENGTH) == STD_NULL) || \
+             (strlen((INT8S const *)pstrAttributeListType->u8AttributeValue) != pstrAttributeListType->u32AttributeValueLength))))
+        {
+            bTablesAreConsistent = STD_FALSE;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
     }
-#if(SUPPORT_ASCII_ONLY == STD_OFF)
-    if(u8CharacterLength > 1U)
+    for(u32Index = 0U; (bTablesAreConsistent == STD_TRUE) && (u32Index < pstrDTDTablesType->u8AttributeListElementCount); u32Index++)
     {
-        if(((u32CodePoint >= 0x0080U) && (u32CodePoint <= 0xD7FFU))||\
-           ((u32CodePoint >= 0xE000U) && (u32CodePoint <= 0xFFFDU))||\
-           ((u32CodePoint >= 0x10000U) && (u32CodePoint <= 0x10FFFFU)))
+        pstrAttributeListElementType = &pstrDTDTablesType->objstrAttributeListElementType[u32Index];
+        if((memchr(pstrAttributeListElementType->u8ElementName, NULL_ASCII_CHARACTER, \
+                   sizeof(pstrAttributeListElementType->u8ElementName)) == STD_NULL) || \
+           (pstrAttributeListElementType->s16FirstAttribute < -1) || \
+           (pstrAttributeListElementType->s16FirstAttribute >= (INT16S)pstrDTDTablesType->u8AvaliableAttibuteListCount) || \
+           (pstrAttributeListElementType->s16LastAttribute < -1) || \
+           (pstrAttributeListElementType->s16LastAttribute >= (INT16S)pstrDTDTablesType->u8AvaliableAttibuteListCount))
+        {
+            bTablesAreConsistent = STD_FALSE;
+        }
+        else
         {
             /*
              * Nothing to do
              */
         }
+    }
+    u32UsedSlots = 0U;
+    for(u32Index = 0U; (bTablesAreConsistent == STD_TRUE) && (u32Index < ATTRIBUTE_LIST_HASH_TABLE_SIZE); u32Index++)
+    {
+        if((pstrDTDTablesType->s16AttributeListHashTable[u32Index] < -1) || \
+           (pstrDTDTablesType->s16AttributeListHashTable[u32Index] >= (INT16S)pstrDTDTablesType->u8AttributeListElementCount))
+        {
+            bTablesAreConsistent = STD_FALSE;
+        }
+        else if(pstrDTDTablesType->s16AttributeListHashTable[u32Index] >= 0)
+        {
+            u32UsedSlots++;
+        }
         else
         {
-            u8CharacterLength = 0U;
+            /*
+             * Nothing to do
+             */
         }
     }
-#endif
+    if(u32UsedSlots > pstrDTDTablesType->u8AttributeListElementCount)
+    {
+        bTablesAreConsistent = STD_FALSE;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
 
-    return u8CharacterLength;
+    return bTablesAreConsistent;
 }
+#endif
+#if(ENABLE_DTD_TABLES == STD_ON)
 /* START FUNCTION DESCRIPTION ******************************************************************************************
-LwXMLP_bIsLessThanCharacter                                        <LwXMLP_CORE>
+LwXMLP_vResetDTDTables                                        <LwXMLP_CORE>
 
-SYNTAX:         BOOLEAN LwXMLP_bIsLessThanCharacter(INT8S *pu8Character)
+SYNTAX:         void LwXMLP_vResetDTDTables(strDTDTablesType *pstrDTDTablesType)
 
-DESCRIPTION :   Validate the character if it is acceptable character to be inside an XML file or not
+DESCRIPTION :   Empty the entity and the attribute list tables
 
-PARAMETER1  :   s8Character : The received character
+PARAMETER1  :   pstrDTDTablesType : pointer to the tables
 
-RETURN VALUE:   STD_TRUE : if valid XML character is received
-                STD_FALSE: if invalid XML character is received
+RETURN VALUE:   None
 
-Note
+Note        :   The reference count isn't changed
 END DESCRIPTION *******************************************************************************************************/
-static BOOLEAN LwXMLP_bIsLessThanCharacter(INT8U const *pu8Character)
+static void LwXMLP_vResetDTDTables(strDTDTablesType *pstrDTDTablesType)
 {
-    BOOLEAN IsLessThanCharacter = STD_FALSE;
+    INT32U u32Slot;
 
-    if((INT8U)(*pu8Character) == LESS_THAN_ASCII_CHARACTER)
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+    pstrDTDTablesType->u16AvaliableEntities = 0U;
+    pstrDTDTablesType->u32EntityArenaLength = 0U;
+    for(u32Slot = 0U; u32Slot < ENTITY_HASH_TABLE_SIZE; u32Slot++)
     {
-        IsLessThanCharacter = STD_TRUE;
+        pstrDTDTablesType->s16EntityHashTable[u32Slot] = -1;
     }
-
-    return IsLessThanCharacter;
+#endif
+#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
+    pstrDTDTablesType->u8AvaliableAttibuteListCount = 0U;
+    pstrDTDTablesType->u8AttributeListElementCount  = 0U;
+    for(u32Slot = 0U; u32Slot < ATTRIBUTE_LIST_HASH_TABLE_SIZE; u32Slot++)
+    {
+        pstrDTDTablesType->s16AttributeListHashTable[u32Slot] = -1;
+    }
+#endif
 }
 /* START FUNCTION DESCRIPTION ******************************************************************************************
-LwXMLP_bIsWhiteSpace                                        <LwXMLP_CORE>
+LwXMLP_pstrAllocateDTDTables                                        <LwXMLP_CORE>
 
-SYNTAX:         BOOLEAN LwXMLP_bIsWhiteSpace(INT8S *pu8Character)
-
-DESCRIPTION :   check if the received character shall be ignored or not
-
-PARAMETER1  :   s8Character : The received character
+SYNTAX:         strDTDTablesType *LwXMLP_pstrAllocateDTDTables(void)
 
-RETURN VALUE:   STD_TRUE : if the character shall be ignored
-                STD_FALSE: if the character shall not be ignored
+DESCRIPTION :   Get unreferenced DTD tables from the static pool or from the heap for the internal dynamic allocation
 
-Note        :   XML considers four characters to be whitespace: the carriage return (\r or ch(13)), the linefeed
-                (\n or ch(10U)), the tab(\t), and the spacebar (' '). In XML documents, there are two types of
-                whitespace:
-                - Significant whitespace is part of the document content and should be preserved.
-                - Insignificant whitespace is used when editing XML documents for readability. These whitespaces are
-                  typically not intended for inclusion in the delivery of the document.
+RETURN VALUE:   pointer to the tables with one reference or STD_NULL if there are no free tables
 
+Note        :   The content of the tables isn't initialized, the caller shall be inside the DTD critical section
 END DESCRIPTION *******************************************************************************************************/
-static BOOLEAN LwXMLP_bIsWhiteSpace(INT8U const *pu8Character)
+static strDTDTablesType *LwXMLP_pstrAllocateDTDTables(void)
 {
-    BOOLEAN bIsWhiteSpace = STD_FALSE;
+    strDTDTablesType *pstrDTDTablesType = STD_NULL;
+#if(ALLOCATION_TYPE == INTERNAL_DYNAMIC_ALLOCATION)
 
-    if(((INT8U)(*pu8Character) == SPACE_ASCII_CHARACTER) ||\
-       ((INT8U)(*pu8Character) == CARRIAGE_RETURN_ASCII_CHARACTER) || \
-       ((INT8U)(*pu8Character) == LINE_FEED_ASCII_CHARACTER) || \
-       ((INT8U)(*pu8Character) == HTAB_ASCII_CHARACTER))
+    pstrDTDTablesType = (strDTDTablesType *)malloc(sizeof(strDTDTablesType));
+#else
+    INT16U            u16TablesIndex;
+
+    for(u16TablesIndex = 0U; (u16TablesIndex < MAX_DTD_TABLES) && (pstrDTDTablesType == STD_NULL); u16TablesIndex++)
     {
-        bIsWhiteSpace = STD_TRUE;
+        if(objstrDTDTablesArray[u16TablesIndex].u16ReferenceCount == 0U)
+        {
+            pstrDTDTablesType = &objstrDTDTablesArray[u16TablesIndex];
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+    }
+#endif
+    if(pstrDTDTablesType != STD_NULL)
+    {
+        pstrDTDTablesType->u16ReferenceCount = 1U;
+    }
+    else
+    {
+        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "There are no free DTD tables");
     }
 
-    return bIsWhiteSpace;
+    return pstrDTDTablesType;
 }
 /* START FUNCTION DESCRIPTION ******************************************************************************************
-LwXMLP_pu8GetCurrentCharacter                                        <LwXMLP_CORE>
-
-SYNTAX:         INT8S LwXMLP_pu8GetCurrentCharacter(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
-
-DESCRIPTION :   get current character pointed by the XML instance
+LwXMLP_vReleaseDTDTables                                        <LwXMLP_CORE>
 
-PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+SYNTAX:         void LwXMLP_vReleaseDTDTables(strDTDTablesType *pstrDTDTablesType)
 
-RETURN VALUE:   the current character
+DESCRIPTION :   Drop a reference to DTD tables, the tables become free when no instance or DTD cache entry refers to
+                them
 
+PARAMETER1  :   pstrDTDTablesType : pointer to the tables
 
-Note        :
+RETURN VALUE:   None
 
+Note        :   The empty tables keep a reference to themselves, so they never become free, the caller shall be
+                inside the DTD critical section
 END DESCRIPTION *******************************************************************************************************/
-static INT8U * LwXMLP_pu8GetCurrentCharacter(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType)
+static void LwXMLP_vReleaseDTDTables(strDTDTablesType *pstrDTDTablesType)
 {
-    return (pstrParserInstanceType->pu8LastParserLocation);
+    pstrDTDTablesType->u16ReferenceCount--;
+#if(ALLOCATION_TYPE == INTERNAL_DYNAMIC_ALLOCATION)
+    if(pstrDTDTablesType->u16ReferenceCount == 0U)
+    {
+        free(pstrDTDTablesType);
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+#endif
 }
 /* START FUNCTION DESCRIPTION ******************************************************************************************
-LwXMLP_vPointToNextCharacter                                        <LwXMLP_CORE>
+LwXMLP_bOwnDTDTables                                        <LwXMLP_CORE>
 
-SYNTAX:         void LwXMLP_vPointToNextCharacter(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+SYNTAX:         BOOLEAN LwXMLP_bOwnDTDTables(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 
-DESCRIPTION :   move to the next character pointed by the XML instance
+DESCRIPTION :   Make sure that the instance is the only one which refers to its DTD tables before a declaration is
+                added to them, shared tables are copied to new tables and the instance refers to the copy
 
 PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
 
-RETURN VALUE:   the current character
-
-
-Note        :
+RETURN VALUE:   STD_TRUE if the instance may modify its tables, STD_FALSE if there are no free tables for the copy
 
+Note        :   Only the used parts of the tables are copied, and the entity strings are relocated to the new arena
 END DESCRIPTION *******************************************************************************************************/
-static void LwXMLP_vConsumeCharacter(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+static BOOLEAN LwXMLP_bOwnDTDTables(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 {
+    strDTDTablesType *pstrSharedTablesType = pstrParserInstanceType->pstrDTDTablesType;
+    strDTDTablesType *pstrDTDTablesType;
+    BOOLEAN           bTablesAreOwned = STD_TRUE;
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
-    if(pstrParserInstanceType->bSecondLevelBufferEnabled == STD_TRUE)
+    INT16U            u16EntityIndex;
+    strEntityType    *pstrEntityType;
+#endif
+
+    LwXMLP_mEnterDTDCriticalSection();
+    if(pstrSharedTablesType->u16ReferenceCount > 1U)
     {
-        *pstrParserInstanceType->pu8LastParserLocation = NULL_ASCII_CHARACTER;
-        pstrParserInstanceType->pu8LastParserLocation++;
-        pstrParserInstanceType->u32SecondLevelReadyAmount--;
-        if(pstrParserInstanceType->u32SecondLevelReadyAmount == 0U)
+        pstrDTDTablesType = LwXMLP_pstrAllocateDTDTables();
+        if(pstrDTDTablesType != STD_NULL)
         {
-            pstrParserInstanceType->bSecondLevelBufferEnabled = STD_FALSE;
-            pstrParserInstanceType->bParserSilentModeIsEnabled = STD_FALSE;
-            pstrParserInstanceType->pu8LastParserLocation     = pstrParserInstanceType->pu8SavedLastParserLocation;
-            pstrParserInstanceType->pu8CircularBufferEnd      = pstrParserInstanceType->pu8SavedCircularBufferEnd;
-            if(pstrParserInstanceType->u32SecondLevelPathLength != 0U)
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+            (void)memcpy(pstrDTDTablesType->u8EntityArena, pstrSharedTablesType->u8EntityArena, \
+                         pstrSharedTablesType->u32EntityArenaLength);
+            (void)memcpy(pstrDTDTablesType->objstrEntityType, pstrSharedTablesType->objstrEntityType, \
+                         pstrSharedTablesType->u16AvaliableEntities * sizeof(strEntityType));
+            for(u16EntityIndex = 0U; u16EntityIndex < pstrSharedTablesType->u16AvaliableEntities; u16EntityIndex++)
             {
-                pstrParserInstanceType->objenumErrorType = csParsedEntityError;
+                pstrEntityType = &pstrDTDTablesType->objstrEntityType[u16EntityIndex];
+                pstrEntityType->pu8EntityName  = &pstrDTDTablesType->u8EntityArena[pstrEntityType->pu8EntityName - \
+                                                                                    pstrSharedTablesType->u8EntityArena];
+                pstrEntityType->pu8EntityValue = &pstrDTDTablesType->u8EntityArena[pstrEntityType->pu8EntityValue - \
+                                                                                   pstrSharedTablesType->u8EntityArena];
             }
+            (void)memcpy(pstrDTDTablesType->s16EntityHashTable, pstrSharedTablesType->s16EntityHashTable, \
+                         sizeof(pstrDTDTablesType->s16EntityHashTable));
+            pstrDTDTablesType->u16AvaliableEntities = pstrSharedTablesType->u16AvaliableEntities;
+            pstrDTDTablesType->u32EntityArenaLength = pstrSharedTablesType->u32EntityArenaLength;
+#endif
+#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
+            (void)memcpy(pstrDTDTablesType->objstrAttributeListType, pstrSharedTablesType->objstrAttributeListType, \
+                         pstrSharedTablesType->u8AvaliableAttibuteListCount * sizeof(strAttributeListType));
+            (void)memcpy(pstrDTDTablesType->objstrAttributeListElementType, pstrSharedTablesType->objstrAttributeListElementType, \
+                         pstrSharedTablesType->u8AttributeListElementCount * sizeof(strAttributeListElementType));
+            (void)memcpy(pstrDTDTablesType->s16AttributeListHashTable, pstrSharedTablesType->s16AttributeListHashTable, \
+                         sizeof(pstrDTDTablesType->s16AttributeListHashTable));
+            pstrDTDTablesType->u8AvaliableAttibuteListCount = pstrSharedTablesType->u8AvaliableAttibuteListCount;
+            pstrDTDTablesType->u8AttributeListElementCount  = pstrSharedTablesType->u8AttributeListElementCount;
+#endif
+            LwXMLP_vReleaseDTDTables(pstrSharedTablesType);
+            pstrParserInstanceType->pstrDTDTablesType = pstrDTDTablesType;
         }
         else
         {
-            /*
-             * Nothing to do
-             */
+            bTablesAreOwned = STD_FALSE;
         }
     }
     else
     {
-        if((INT8U)(*pstrParserInstanceType->pu8LastParserLocation) == LINE_FEED_ASCII_CHARACTER)
-        {
-            pstrParserInstanceType->u32LineNumber++;
-            pstrParserInstanceType->u32CoulmnNumber = 0;
-        }
-        else
-        {
-            pstrParserInstanceType->u32CoulmnNumber++;
-        }
-        LwXMLP_mVerbose(VERBOSE_LEVEL_DEBUGGING, \
-                        "Consuming character %c",
-                        *pstrParserInstanceType->pu8LastParserLocation);
-        *pstrParserInstanceType->pu8LastParserLocation = NULL_ASCII_CHARACTER;
-        pstrParserInstanceType->pu8LastParserLocation++;
-        pstrParserInstanceType->u32ParsedLength++;
-        if(pstrParserInstanceType->pu8CircularBufferEnd == pstrParserInstanceType->pu8LastParserLocation)
-        {
-            pstrParserInstanceType->pu8LastParserLocation = pstrParserInstanceType->u8XMLCircularBuffer;
-        }
-        else
-        {
-            /* nothing to do here */
-        }
-        pstrParserInstanceType->u32FreeLocations++;
+        /*
+         * Nothing to do
+         */
     }
+    LwXMLP_mExitDTDCriticalSection();
+
+    return bTablesAreOwned;
+}
+#endif
+#if(ENABLE_FAST_TEXT_SCANNING == STD_ON)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_u32ScanTextBlock                                        <LwXMLP_CORE>
+
+SYNTAX:         INT32U LwXMLP_u32ScanTextBlock(INT8U             const *pu8Block, \
+                                               INT32U                   u32WriteOffset, \
+                                               strTextLoaderType       *pstrTextLoaderType)
+
+DESCRIPTION :   Scan TEXT_BLOCK_LENGTH bytes of the text content at once, 32/16 bytes by AVX2/SSE2 or NEON if the
+                compiler provides them or 4 bytes by the SIMD within a register technique, and locate the first byte
+                which shall be loaded alone: less than, ampersand, carriage return or any other control character
+                than tab and line feed. The bytes before it are plain, so their white space and validation flags are
+                taken from the masks of the block as cu8CharacterClassTable would give them one by one
+
+PARAMETER1  :   pu8Block           : pointer to the block to be scanned
+PARAMETER2  :   u32WriteOffset     : the output index of the first byte of the block
+PARAMETER3  :   pstrTextLoaderType : the output of the loading, the TEXT_SCAN_XXX flags are updated for the plain bytes
+
+RETURN VALUE:   The number of the plain bytes at the start of the block, from 0 to TEXT_BLOCK_LENGTH
+
+Note        :   the scanning may stop before a plain byte, but never after a byte which shall be loaded alone
+END DESCRIPTION *******************************************************************************************************/
+static INT32U LwXMLP_u32ScanTextBlock(INT8U             const *pu8Block, \
+                                      INT32U                   u32WriteOffset, \
+                                      strTextLoaderType       *pstrTextLoaderType)
+{
+    INT64U  u64StopMask, u64NonWhiteSpaceMask, u64ValidationMask, u64PlainMask;
+    INT32U  u32PlainLength = 0U, u32ValidationIndex = 0U;
+#if defined(__AVX2__)
+    __m256i objVector, objWhiteSpace;
+
+    objVector     = _mm256_loadu_si256((__m256i const *)pu8Block);
+    objWhiteSpace = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(objVector, _mm256_set1_epi8((char)SPACE_ASCII_CHARACTER)), \
+                                                    _mm256_cmpeq_epi8(objVector, _mm256_set1_epi8((char)HTAB_ASCII_CHARACTER))), \
+                                    _mm256_cmpeq_epi8(objVector, _mm256_set1_epi8((char)LINE_FEED_ASCII_CHARACTER)));
+    /* the signed comparison marks the non ASCII bytes too, they are removed by their high bits */
+    u64StopMask          = (INT64U)(((INT32U)_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_set1_epi8((char)SPACE_ASCII_CHARACTER), objVector)) & \
+                                     ~(INT32U)_mm256_movemask_epi8(objVector) & ~(INT32U)_mm256_movemask_epi8(objWhiteSpace)) | \
+                                    (INT32U)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(objVector, _mm256_set1_epi8((char)LESS_THAN_ASCII_CHARACTER)), \
+                                                                                 _mm256_cmpeq_epi8(objVector, _mm256_set1_epi8((char)AMPERSAND_ASCII_CHARACTER)))));
+    u64NonWhiteSpaceMask = (INT64U)~(INT32U)_mm256_movemask_epi8(objWhiteSpace);
+    u64ValidationMask    = (INT64U)((INT32U)_mm256_movemask_epi8(objVector) | \
+                                    (INT32U)_mm256_movemask_epi8(_mm256_cmpeq_epi8(objVector, _mm256_set1_epi8((char)CLOSING_BRACKET_CHARACTER))));
+#elif defined(__SSE2__)
+    __m128i objVector, objWhiteSpace;
+
+    objVector     = _mm_loadu_si128((__m128i const *)pu8Block);
+    objWhiteSpace = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(objVector, _mm_set1_epi8((char)SPACE_ASCII_CHARACTER)), \
+                                              _mm_cmpeq_epi8(objVector, _mm_set1_epi8((char)HTAB_ASCII_CHARACTER))), \
+                                 _mm_cmpeq_epi8(objVector, _mm_set1_epi8((char)LINE_FEED_ASCII_CHARACTER)));
+    /* the signed comparison marks the non ASCII bytes too, they are removed by their high bits */
+    u64StopMask          = (INT64U)(((INT32U)_mm_movemask_epi8(_mm_cmplt_epi8(objVector, _mm_set1_epi8((char)SPACE_ASCII_CHARACTER))) & \
+                                     ~(INT32U)_mm_movemask_epi8(objVector) & ~(INT32U)_mm_movemask_epi8(objWhiteSpace)) | \
+                                    (INT32U)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(objVector, _mm_set1_epi8((char)LESS_THAN_ASCII_CHARACTER)), \
+                                                                           _mm_cmpeq_epi8(objVector, _mm_set1_epi8((char)AMPERSAND_ASCII_CHARACTER)))));
+    u64NonWhiteSpaceMask = (INT64U)((INT32U)_mm_movemask_epi8(objWhiteSpace) ^ 0xFFFFU);
+    u64ValidationMask    = (INT64U)((INT32U)_mm_movemask_epi8(objVector) | \
+                                    (INT32U)_mm_movemask_epi8(_mm_cmpeq_epi8(objVector, _mm_set1_epi8((char)CLOSING_BRACKET_CHARACTER))));
+#elif defined(__ARM_NEON)
+    uint8x16_t objVector, objWhiteSpace, objStop;
+
+    objVector     = vld1q_u8(pu8Block);
+    objWhiteSpace = vorrq_u8(vorrq_u8(vceqq_u8(objVector, vdupq_n_u8(SPACE_ASCII_CHARACTER)), \
+                                      vceqq_u8(objVector, vdupq_n_u8(HTAB_ASCII_CHARACTER))), \
+                             vceqq_u8(objVector, vdupq_n_u8(LINE_FEED_ASCII_CHARACTER)));
+    objStop       = vorrq_u8(vbicq_u8(vcltq_u8(objVector, vdupq_n_u8(SPACE_ASCII_CHARACTER)), objWhiteSpace), \
+                             vorrq_u8(vceqq_u8(objVector, vdupq_n_u8(LESS_THAN_ASCII_CHARACTER)), \
+                                      vceqq_u8(objVector, vdupq_n_u8(AMPERSAND_ASCII_CHARACTER))));
+    /* the narrowing shift packs every byte of the comparison to a nibble */
+    u64StopMask          = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(objStop), 4)), 0);
+    u64NonWhiteSpaceMask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(vmvnq_u8(objWhiteSpace)), 4)), 0);
+    u64ValidationMask    = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(vorrq_u8(vcgeq_u8(objVector, vdupq_n_u8(0x80U)), \
+                                                                                                     vceqq_u8(objVector, vdupq_n_u8(CLOSING_BRACKET_CHARACTER)))), 4)), 0);
 #else
-    if((INT8U)(*pstrParserInstanceType->pu8LastParserLocation) == LINE_FEED_ASCII_CHARACTER)
-    {
-        pstrParserInstanceType->u32LineNumber++;
-        pstrParserInstanceType->u32CoulmnNumber = 0;
-    }
-    else
-    {
-        pstrParserInstanceType->u32CoulmnNumber++;
-    }
-    if(pstrParserInstanceType->u32LineNumber == 169)
+    INT32U  u32Word, u32WhiteSpaceMask;
+
+    /* the word is built in the memory order of the bytes, so the first marked byte is the lowest one */
+    u32Word              = (INT32U)pu8Block[0] | ((INT32U)pu8Block[1] << 8U) | ((INT32U)pu8Block[2] << 16U) | ((INT32U)pu8Block[3] << 24U);
+    u32WhiteSpaceMask    = LwXMLP_mMatchWordBytes(u32Word, SPACE_ASCII_CHARACTER) | \
+                           LwXMLP_mMatchWordBytes(u32Word, HTAB_ASCII_CHARACTER) | \
+                           LwXMLP_mMatchWordBytes(u32Word, LINE_FEED_ASCII_CHARACTER);
+    /* the subtraction marks the control characters, its borrow may mark more bytes after them but never less */
+    u64StopMask          = (INT64U)((((u32Word - (SPACE_ASCII_CHARACTER * SCAN_WORD_ONES)) & ~u32Word & ~u32WhiteSpaceMask) | \
+                                     LwXMLP_mMatchWordBytes(u32Word, LESS_THAN_ASCII_CHARACTER) | \
+                                     LwXMLP_mMatchWordBytes(u32Word, AMPERSAND_ASCII_CHARACTER)) & SCAN_WORD_HIGH_BITS) >> 7U;
+    u64NonWhiteSpaceMask = (INT64U)((~u32WhiteSpaceMask & SCAN_WORD_HIGH_BITS) >> 7U);
+    u64ValidationMask    = (INT64U)(((u32Word & SCAN_WORD_HIGH_BITS) | \
+                                     LwXMLP_mMatchWordBytes(u32Word, CLOSING_BRACKET_CHARACTER)) >> 7U);
+#endif
+    while((u32PlainLength < TEXT_BLOCK_LENGTH) && \
+          (((u64StopMask >> (u32PlainLength * TEXT_BLOCK_MASK_BITS)) & 1U) == 0U))
     {
-        pstrParserInstanceType->u32LineNumber = 169;
+        u32PlainLength++;
     }
-    LwXMLP_mVerbose(VERBOSE_LEVEL_DEBUGGING, \
-                    "Consuming character %c",
-                    *pstrParserInstanceType->pu8LastParserLocation);
-    *pstrParserInstanceType->pu8LastParserLocation = NULL_ASCII_CHARACTER;
-    pstrParserInstanceType->pu8LastParserLocation++;
-    pstrParserInstanceType->u32ParsedLength++;
-    if(pstrParserInstanceType->pu8CircularBufferEnd == pstrParserInstanceType->pu8LastParserLocation)
+    if(u32PlainLength < TEXT_BLOCK_LENGTH)
     {
-        pstrParserInstanceType->pu8LastParserLocation = pstrParserInstanceType->u8XMLCircularBuffer;
+        u64PlainMask = ((INT64U)1U << (u32PlainLength * TEXT_BLOCK_MASK_BITS)) - 1U;
     }
     else
     {
-        /* nothing to do here */
+        u64PlainMask = ~(INT64U)0U;
     }
-    pstrParserInstanceType->u32FreeLocations++;
-#endif
-
-}
-static void LwXMLP_vCheckDeclerationEncoding(LwXMLP_strXMLParseInstanceType       *pstrParserInstanceType, \
-                                             INT8U                          const *pu8MLPortionBuffer,\
-                                             INT32U                                 u32PortionLengthLength)
-{
-    if(strncmp((INT8S const *)pu8MLPortionBuffer, "<?xml", strlen("<?xml")) == 0)
+    if((u64NonWhiteSpaceMask & u64PlainMask) != 0U)
     {
-        memcpy(pstrParserInstanceType->u8XMLworkingBuffer, pu8MLPortionBuffer, u32PortionLengthLength);
-        pstrParserInstanceType->u32DirectiveLength = u32PortionLengthLength;
-        LwXMLP_vCheckWellFormedDecl(pstrParserInstanceType);
+        pstrTextLoaderType->u8FoundFlags |= TEXT_SCAN_NON_WHITE_SPACE_FOUND;
     }
     else
     {
         /*
-         * Nothign to do
+         * Nothing to do
          */
     }
-}
-static void LwXMLP_vConsumeCharacterBulk(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, INT32U u32AdvancedLength)
-{
-    INT32U u32HeaderIndex;
-
-    for(u32HeaderIndex = 0U; u32HeaderIndex < u32AdvancedLength; u32HeaderIndex++)
-    {
-        LwXMLP_vConsumeCharacter(pstrParserInstanceType);
-    }
-}
-#if(ENABLE_DTD_RECEIPTION == STD_ON)
-static void LwXMLP_vCheckDTDPortion(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
-{
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-    INT8U         u8EntityIndex;
-    INT8U        *pu8ParameterEntity;
-    INT8U  const *pu8EntityValue = STD_NULL;
-    INT32U        u32EntityValueLength = 0U;
-    BOOLEAN       bParameterEntities = STD_FALSE;
-    BOOLEAN       bFoundGeneralEntities = STD_FALSE;
-#endif
-    INT8U        *pu8WorkingBuffer;
-    INT8U  const *pu8CurrentXMLCharacter;
-    INT32U         u32BufferIndex, u32CheckingDataAmount, u32BracketIndex = 0U;
-    INT32U         u32DataLength = 0U;
-    BOOLEAN        bFoundNonWhiteSpaceCharacter = STD_FALSE;
-    BOOLEAN        bDTDEndIsFound = STD_FALSE, bNewMarkupIsFound = STD_FALSE;
-
-    pu8WorkingBuffer                          = pstrParserInstanceType->u8XMLworkingBuffer;
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-    pu8ParameterEntity                        = pu8WorkingBuffer; /* Initail assumption */
-#endif
-    pu8CurrentXMLCharacter                    = pstrParserInstanceType->pu8LastParserLocation;
-    u32CheckingDataAmount                     = LwXMLP_u32GetReadyData(pstrParserInstanceType);
-    pstrParserInstanceType->bEndOfDataIsFound = STD_FALSE;
-    for(u32BufferIndex = 0U; \
-       (u32BufferIndex < u32CheckingDataAmount) && \
-       (pstrParserInstanceType->objenumErrorType == csNoError)&&\
-       (bNewMarkupIsFound == STD_FALSE)&&\
-       (u32BufferIndex < MAX_WORKING_BUFFER_SIZE); \
-       ++u32BufferIndex)
-    {
-        if(*pu8CurrentXMLCharacter == LESS_THAN_ASCII_CHARACTER)
-        {
-            bNewMarkupIsFound = STD_TRUE;
-        }
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-        else if(((INT8U)*pu8CurrentXMLCharacter) == PERCENT_ASCII_CHARACTER)
-        {
-            bParameterEntities           = STD_TRUE;
-            bFoundNonWhiteSpaceCharacter = STD_TRUE;
-            pu8ParameterEntity           = pu8WorkingBuffer;
-        }
-        else if(((INT8U)*pu8CurrentXMLCharacter) == AMPERSAND_ASCII_CHARACTER)
-        {
-            bFoundGeneralEntities = STD_TRUE;
-        }
-        else if((((INT8U)*pu8CurrentXMLCharacter) == SEMICOLON_ASCII_CHARACTER) && (bParameterEntities == STD_TRUE))
+    u64ValidationMask &= u64PlainMask;
+    if((u64ValidationMask != 0U) && ((pstrTextLoaderType->u8FoundFlags & TEXT_SCAN_VALIDATION_REQUIRED) == 0U))
+    {   /* the UTF-8 sequences and the "]]>" are left to the complete validation */
+        while(((u64ValidationMask >> (u32ValidationIndex * TEXT_BLOCK_MASK_BITS)) & 1U) == 0U)
         {
-            bNewMarkupIsFound = STD_TRUE;
-            *pu8WorkingBuffer = *pu8CurrentXMLCharacter;
-            pu8WorkingBuffer++;
-            u32DataLength++;
+            u32ValidationIndex++;
         }
-        else if((((INT8U)*pu8CurrentXMLCharacter) == SEMICOLON_ASCII_CHARACTER) && (bFoundGeneralEntities == STD_TRUE))
-        {
-            pstrParserInstanceType->objenumErrorType = csGeneralEntityInDTD;
+        pstrTextLoaderType->u8FoundFlags        |= TEXT_SCAN_VALIDATION_REQUIRED;
+        pstrTextLoaderType->u32ValidationOffset  = u32WriteOffset + u32ValidationIndex;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+
+    return u32PlainLength;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_u32LoadTextSegment                                        <LwXMLP_CORE>
+
+SYNTAX:         INT32U LwXMLP_u32LoadTextSegment(INT8U       const *pu8Segment, \
+                                                 INT32U             u32SegmentLength, \
+                                                 strTextLoaderType *pstrTextLoaderType)
+
+DESCRIPTION :   Load a linear segment of the text content till the first less than character in one forward pass,
+                the segment is read by a read cursor and written to the output by a separate write cursor, so every
+                byte is copied, checked and its end of line is normalized at once:
+                - the plain bytes at the start of every block are copied at once (see LwXMLP_u32ScanTextBlock)
+                - the byte which stops the scanning and the tail of the segment are classified by
+                  cu8CharacterClassTable one by one
+                - if the end of line normalization is enabled, every carriage return is written as line feed and
+                  the line feed which follows it is dropped, even if the carriage return is the last byte of the
+                  previous segment
+
+PARAMETER1  :   pu8Segment         : pointer to the start of the linear segment
+PARAMETER2  :   u32SegmentLength   : the length of the linear segment
+PARAMETER3  :   pstrTextLoaderType : the output of the loading, the write cursor and the TEXT_SCAN_XXX flags are updated
+
+RETURN VALUE:   The offset of the first less than character or u32SegmentLength if it is not found
+
+Note        :   The output shall have room for u32SegmentLength bytes after its write cursor
+END DESCRIPTION *******************************************************************************************************/
+static INT32U LwXMLP_u32LoadTextSegment(INT8U       const *pu8Segment, \
+                                        INT32U             u32SegmentLength, \
+                                        strTextLoaderType *pstrTextLoaderType)
+{
+    INT8U   *pu8Output;
+    INT32U   u32ReadOffset = 0U, u32WriteOffset, u32BlockEnd, u32PlainLength;
+    INT8U    u8Character, u8CharacterClass;
+    BOOLEAN  bLessThanFound = STD_FALSE;
+#if(ENABLE_EOL_NORMALIZATION == STD_ON)
+    BOOLEAN  bCarriageReturnIsLast;
+#endif
+
+    pu8Output      = pstrTextLoaderType->pu8Output;
+    u32WriteOffset = pstrTextLoaderType->u32OutputLength;
+#if(ENABLE_EOL_NORMALIZATION == STD_ON)
+    bCarriageReturnIsLast = pstrTextLoaderType->bCarriageReturnIsLast;
+#endif
+    while((u32ReadOffset < u32SegmentLength) && (bLessThanFound == STD_FALSE))
+    {
+#if(ENABLE_EOL_NORMALIZATION == STD_ON)
+        if(bCarriageReturnIsLast == STD_TRUE)
+        {   /* the line feed which may follow the carriage return is loaded alone */
+            u32PlainLength = 0U;
+            u32BlockEnd    = u32ReadOffset + 1U;
         }
+        else if((u32ReadOffset + TEXT_BLOCK_LENGTH) <= u32SegmentLength)
+#else
+        if((u32ReadOffset + TEXT_BLOCK_LENGTH) <= u32SegmentLength)
 #endif
-        else if(((INT8U)*pu8CurrentXMLCharacter) == CLOSING_BRACKET_CHARACTER)
         {
-            if(bDTDEndIsFound == STD_FALSE)
-            {
-                bDTDEndIsFound  = STD_TRUE;
-                u32BracketIndex = u32BufferIndex;
+            u32PlainLength = LwXMLP_u32ScanTextBlock(&pu8Segment[u32ReadOffset], u32WriteOffset, pstrTextLoaderType);
+            u32BlockEnd    = u32ReadOffset + TEXT_BLOCK_LENGTH;
+            if(u32PlainLength < TEXT_BLOCK_LENGTH)
+            {   /* only the byte which stops the scanning is loaded alone */
+                u32BlockEnd = u32ReadOffset + u32PlainLength + 1U;
             }
             else
             {
-                pstrParserInstanceType->objenumErrorType = csDTDMissingPortionError;
-                LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "DTD is missing portion");
+                /*
+                 * Nothing to do
+                 */
             }
         }
-        else if(*pu8CurrentXMLCharacter == GREATER_THAN_ASCII_CHARACTER)
+        else
         {
-            if(((u32BracketIndex + 1U) == u32BufferIndex) &&  (bDTDEndIsFound == STD_TRUE))
-            {
-                u32DataLength++;
-            }
-            else
-            {
-                pstrParserInstanceType->objenumErrorType = csDTDMissingPortionError;
-                LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "DTD is missing portion");
-            }
-            break;
+            u32PlainLength = 0U;
+            u32BlockEnd    = u32SegmentLength;
         }
-        else if(LwXMLP_bIsWhiteSpace(pu8CurrentXMLCharacter) == STD_FALSE)
+        if(u32PlainLength != 0U)
         {
-            bFoundNonWhiteSpaceCharacter = STD_TRUE;
+            (void)memcpy(&pu8Output[u32WriteOffset], &pu8Segment[u32ReadOffset], u32PlainLength);
+            u32ReadOffset  += u32PlainLength;
+            u32WriteOffset += u32PlainLength;
         }
         else
         {
@@ -3089,104 +6556,85 @@ static void LwXMLP_vCheckDTDPortion(LwXMLP_strXMLParseInstanceType *pstrParserIn
              * Nothing to do
              */
         }
-        if(bNewMarkupIsFound == STD_FALSE)
+        while((u32ReadOffset < u32BlockEnd) && (bLessThanFound == STD_FALSE))
         {
-            *pu8WorkingBuffer = *pu8CurrentXMLCharacter;
-            pu8WorkingBuffer++;
-            u32DataLength++;
-            pu8CurrentXMLCharacter++;
-            if(pstrParserInstanceType->pu8CircularBufferEnd == pu8CurrentXMLCharacter)
+            u8Character = pu8Segment[u32ReadOffset];
+            if(u8Character == LESS_THAN_ASCII_CHARACTER)
             {
-                pu8CurrentXMLCharacter = pstrParserInstanceType->u8XMLCircularBuffer;
+                bLessThanFound = STD_TRUE;
             }
             else
             {
-                /* nothing to do here */
-            }
-        }
-        else
-        {
-            /*
-             * Nothing to do
-             */
-        }
-    }
-    if((bDTDEndIsFound == STD_TRUE) && (pstrParserInstanceType->objenumErrorType == csNoError))
-    {
-        pstrParserInstanceType->bParsingDTDInProgress = STD_FALSE;
-        LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32DataLength);
-    }
-    else if((bNewMarkupIsFound == STD_TRUE) && (pstrParserInstanceType->objenumErrorType == csNoError))
-    {
-        if(bFoundNonWhiteSpaceCharacter == STD_TRUE)
-        {
-            *pu8WorkingBuffer = NULL_ASCII_CHARACTER;
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-            /* Now check the Parameter Entities if any */
-            if(bParameterEntities == STD_TRUE)
-            {
-                LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32DataLength);
-                pstrParserInstanceType->objenumErrorType = LwXMLP_enumValidatePEReference(\
-                                                pstrParserInstanceType->u8XMLworkingBuffer, \
-                                                &pstrParserInstanceType->u32Length);
-                if(pstrParserInstanceType->objenumErrorType == csNoError)
+                u8CharacterClass = cu8CharacterClassTable[u8Character];
+                if((u8CharacterClass & CHARACTER_CLASS_WHITE_SPACE) == 0U)
                 {
-                    for(u8EntityIndex = 0; u8EntityIndex < pstrParserInstanceType->u8AvaliableEntities; ++u8EntityIndex)
-                    {
-                        if(strncmp((INT8S const *)&pu8ParameterEntity[1U], \
-                                  (INT8S const *)pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityName, \
-                                  pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityNameLength) == 0)
-                        {
-                            u32EntityValueLength   = pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityValueLength;
-                            pu8EntityValue         = pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityValue;
-                            break;
-                        }
-                    }
-                    if(pu8EntityValue == STD_NULL)
-                    {
-                        pstrParserInstanceType->objenumErrorType = csInvalidParameterEntity;
-                    }
-                    else if(pstrParserInstanceType->objstrEntityType[u8EntityIndex].objenumEntityStoreTypeType == csExternalStorage)
+                    pstrTextLoaderType->u8FoundFlags |= TEXT_SCAN_NON_WHITE_SPACE_FOUND;
+                }
+                else
+                {
+                    /*
+                     * Nothing to do
+                     */
+                }
+                if(u8Character == AMPERSAND_ASCII_CHARACTER)
+                {
+                    pstrTextLoaderType->u8FoundFlags |= TEXT_SCAN_AMPERSAND_FOUND;
+                }
+                else if((u8Character >= 0x80U) || (u8Character == CLOSING_BRACKET_CHARACTER))
+                {   /* the UTF-8 sequences and the "]]>" are left to the complete validation */
+                    if((pstrTextLoaderType->u8FoundFlags & TEXT_SCAN_VALIDATION_REQUIRED) == 0U)
                     {
-                        pstrParserInstanceType->bFoundExternalEntity = STD_TRUE;
+                        pstrTextLoaderType->u8FoundFlags        |= TEXT_SCAN_VALIDATION_REQUIRED;
+                        pstrTextLoaderType->u32ValidationOffset  = u32WriteOffset;
                     }
                     else
                     {
-                        LwXMLP_vSwitchToSecondLevelBuffer(pstrParserInstanceType,\
-                                                          pu8EntityValue,\
-                                                          u32EntityValueLength);
+                        /*
+                         * Nothing to do
+                         */
                     }
                 }
+                else if((u8CharacterClass & CHARACTER_CLASS_CHAR) == 0U)
+                {
+                    pstrTextLoaderType->u8FoundFlags |= TEXT_SCAN_INVALID_CHARACTER_FOUND;
+                }
                 else
                 {
                     /*
                      * Nothing to do
                      */
                 }
-            }
-            else
-            {
-                /* Nothing to do here */
-            }
+#if(ENABLE_EOL_NORMALIZATION == STD_ON)
+                if(u8Character == CARRIAGE_RETURN_ASCII_CHARACTER)
+                {
+                    pu8Output[u32WriteOffset] = LINE_FEED_ASCII_CHARACTER;
+                    u32WriteOffset++;
+                    bCarriageReturnIsLast = STD_TRUE;
+                }
+                else if((u8Character == LINE_FEED_ASCII_CHARACTER) && (bCarriageReturnIsLast == STD_TRUE))
+                {   /* the carriage return before it is already written as line feed */
+                    bCarriageReturnIsLast = STD_FALSE;
+                }
+                else
+                {
+                    pu8Output[u32WriteOffset] = u8Character;
+                    u32WriteOffset++;
+                    bCarriageReturnIsLast = STD_FALSE;
+                }
 #else
-            LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32DataLength);
+                pu8Output[u32WriteOffset] = u8Character;
+                u32WriteOffset++;
 #endif
+                u32ReadOffset++;
+            }
         }
-        else /* it is insignificant white space */
-        {
-            LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32DataLength);
-            pstrParserInstanceType->bEndOfDataIsFound = STD_FALSE;
-        }
-    }
-    else if((u32BufferIndex == MAX_CIRCULAR_BUFFER_SIZE) || (u32BufferIndex == MAX_WORKING_BUFFER_SIZE)) /* if we looked for character and isn't found and reach the buffer end */
-    {
-        pstrParserInstanceType->objenumErrorType = csLargeDTDPortionlength;
-        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Can't load the XML Tag into the buffer");
-    }
-    else
-    {
-        /* unexpected */
     }
+    pstrTextLoaderType->u32OutputLength = u32WriteOffset;
+#if(ENABLE_EOL_NORMALIZATION == STD_ON)
+    pstrTextLoaderType->bCarriageReturnIsLast = bCarriageReturnIsLast;
+#endif
+
+    return u32ReadOffset;
 }
 #endif
 /* START FUNCTION DESCRIPTION ******************************************************************************************
@@ -3197,8 +6645,10 @@ SYNTAX:         StdReturnType LwXMLP_srCheckavailableData(LwXMLP_strXMLParseInst
 
 DESCRIPTION :   This API is doing the following:
                 - Check if the end of the data is available
-                - Copy the data to the working buffer
+                - Copy the data to the working buffer, in the same pass the data is checked and its end of lines
+                  are normalized if ENABLE_FAST_TEXT_SCANNING is enabled
                 - Check if the data contains a predefined entity to be replaced
+                - Normalize the end of lines of the found data if it isn't normalized during the copying
 
 PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance, and once the end of the data found, the
                                          pstrParserInstanceType->bEndOfDataIsFound will be set to STD_TRUE
@@ -3217,18 +6667,22 @@ Note        :
 END DESCRIPTION *******************************************************************************************************/
 static void LwXMLP_vCheckavailableData(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 {
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-    INT32U         u32ResolvingLength;
-#endif
     INT8U         *pu8WorkingBuffer;
     INT8U   const *pu8CurrentXMLCharacter;
     INT32U         u32BufferIndex, u32CheckingDataAmount, u32DataLength;
+#if(ENABLE_FAST_TEXT_SCANNING == STD_ON)
+    INT32U         u32FirstSegmentLength, u32SecondSegmentLength;
+    strTextLoaderType objstrTextLoaderType;
+#endif
+#if(ENABLE_EOL_NORMALIZATION == STD_ON)
+    BOOLEAN        bTextIsNormalized = STD_FALSE;
+#endif
 
     BOOLEAN        bFoundNonWhiteSpaceCharacter = STD_FALSE;
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
     BOOLEAN        bFoundReference = STD_FALSE;
-    INT8U         *pu8EntityValue = STD_NULL;
-    INT8U         u8EntityReferenceUpdateTrials, u8EntityIndex, u8ReferenceIndex, u8LastReferencesCountFound = 0U;
+    INT16S        s16MarkupEntityIndex = -1;
+    INT32U        u32MarkupReferenceOffset = 0U, u32MarkupReferenceNumber = 0U;
 #endif
 
     pu8WorkingBuffer                          = pstrParserInstanceType->u8XMLworkingBuffer;
@@ -3236,7 +6690,116 @@ static void LwXMLP_vCheckavailableData(LwXMLP_strXMLParseInstanceType *pstrParse
     u32CheckingDataAmount                     = LwXMLP_u32GetReadyData(pstrParserInstanceType);
     pstrParserInstanceType->bEndOfDataIsFound = STD_FALSE;
     u32DataLength                             = 0U;
+#if(ENABLE_BUFFER_SCRUBBING == STD_ON)
     memset(pstrParserInstanceType->u8XMLworkingBuffer, 0x00, MAX_WORKING_BUFFER_SIZE);
+#endif
+#if(ENABLE_FAST_TEXT_SCANNING == STD_ON)
+    if(u32CheckingDataAmount > MAX_WORKING_BUFFER_SIZE)
+    {
+        u32CheckingDataAmount = MAX_WORKING_BUFFER_SIZE;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    /*
+     * The ready data is at most two linear segments, the first one till the end of the circular buffer and the
+     * second one from the start of the circular buffer, or one segment if the circular buffer is mapped twice
+     */
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_ON)
+    u32FirstSegmentLength = u32CheckingDataAmount;
+#else
+    u32FirstSegmentLength = (INT32U)(pstrParserInstanceType->pu8CircularBufferEnd - pu8CurrentXMLCharacter);
+#endif
+    if(u32FirstSegmentLength > u32CheckingDataAmount)
+    {
+        u32FirstSegmentLength = u32CheckingDataAmount;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    objstrTextLoaderType.pu8Output             = pu8WorkingBuffer;
+    objstrTextLoaderType.u32OutputLength       = 0U;
+    objstrTextLoaderType.u32ValidationOffset   = 0U;
+    objstrTextLoaderType.u8FoundFlags          = 0U;
+#if(ENABLE_EOL_NORMALIZATION == STD_ON)
+    objstrTextLoaderType.bCarriageReturnIsLast = STD_FALSE;
+#endif
+    u32BufferIndex = LwXMLP_u32LoadTextSegment(pu8CurrentXMLCharacter, u32FirstSegmentLength, &objstrTextLoaderType);
+    if(u32BufferIndex < u32FirstSegmentLength)
+    {
+        pstrParserInstanceType->bEndOfDataIsFound = STD_TRUE;
+    }
+    else if(u32FirstSegmentLength < u32CheckingDataAmount)
+    {
+        u32SecondSegmentLength = LwXMLP_u32LoadTextSegment(pstrParserInstanceType->pu8CircularBufferStart, \
+                                                           u32CheckingDataAmount - u32FirstSegmentLength, \
+                                                           &objstrTextLoaderType);
+        u32BufferIndex += u32SecondSegmentLength;
+        if(u32BufferIndex < u32CheckingDataAmount)
+        {
+            pstrParserInstanceType->bEndOfDataIsFound = STD_TRUE;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    if(pstrParserInstanceType->bEndOfDataIsFound == STD_TRUE)
+    {
+        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "End of Data is found");
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    if((objstrTextLoaderType.u8FoundFlags & TEXT_SCAN_AMPERSAND_FOUND) != 0U)
+    {
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+        bFoundReference = STD_TRUE;
+#else
+        pstrParserInstanceType->objenumErrorType  = csFeatureNotSupported;
+#endif
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    if((objstrTextLoaderType.u8FoundFlags & TEXT_SCAN_NON_WHITE_SPACE_FOUND) != 0U)
+    {
+        bFoundNonWhiteSpaceCharacter = STD_TRUE;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    /* u32BufferIndex is the number of the read bytes, while u32DataLength is the number of the written ones */
+    u32DataLength    = objstrTextLoaderType.u32OutputLength;
+    pu8WorkingBuffer = &pu8WorkingBuffer[u32DataLength];
+#if(ENABLE_EOL_NORMALIZATION == STD_ON)
+    /* the line breaks are normalized before the references are replaced, so the character references of #xD are kept */
+    bTextIsNormalized = STD_TRUE;
+#endif
+#else
     for(u32BufferIndex = 0U; \
        (u32BufferIndex < u32CheckingDataAmount) && (u32BufferIndex < MAX_WORKING_BUFFER_SIZE); \
        ++u32BufferIndex)
@@ -3257,9 +6820,66 @@ static void LwXMLP_vCheckavailableData(LwXMLP_strXMLParseInstanceType *pstrParse
             pstrParserInstanceType->objenumErrorType  = csFeatureNotSupported;
 #endif
         }
-        else if(LwXMLP_bIsWhiteSpace(pu8CurrentXMLCharacter) == STD_FALSE)
+        else if(LwXMLP_bIsWhiteSpace(pu8CurrentXMLCharacter) == STD_FALSE)
+        {
+            bFoundNonWhiteSpaceCharacter = STD_TRUE;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+        *pu8WorkingBuffer = *pu8CurrentXMLCharacter;
+        pu8WorkingBuffer++;
+        u32DataLength++;
+        pu8CurrentXMLCharacter++;
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_OFF)
+        if(pstrParserInstanceType->pu8CircularBufferEnd == pu8CurrentXMLCharacter)
+        {
+            pu8CurrentXMLCharacter = pstrParserInstanceType->pu8CircularBufferStart;
+        }
+        else
+        {
+            /* nothing to do here */
+        }
+#endif
+    }
+#endif
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+    if((pstrParserInstanceType->bEndOfDataIsFound == STD_FALSE) && \
+       (pstrParserInstanceType->u8InputSourceDepth > 0U) && \
+       (u32BufferIndex == LwXMLP_u32GetReadyData(pstrParserInstanceType)))
+    {/* no more characters will be added to the entity value, so its text ends by its end */
+        pstrParserInstanceType->bEndOfDataIsFound = STD_TRUE;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+#endif
+    /*
+     * Validate found data
+     */
+    if((pstrParserInstanceType->objenumErrorType == csNoError) && \
+       (pstrParserInstanceType->bEndOfDataIsFound == STD_TRUE)&&\
+       (bFoundNonWhiteSpaceCharacter == STD_TRUE))
+    {
+#if(ENABLE_FAST_TEXT_SCANNING == STD_ON)
+        /* the loaded ASCII characters are already checked, so only the tail from the first non ASCII or closing
+         * bracket character is validated */
+        *pu8WorkingBuffer = NULL_ASCII_CHARACTER;
+        if((objstrTextLoaderType.u8FoundFlags & TEXT_SCAN_INVALID_CHARACTER_FOUND) != 0U)
+        {
+            pstrParserInstanceType->objenumErrorType = csInvalidXMLCharacter;
+        }
+        else if(((objstrTextLoaderType.u8FoundFlags & TEXT_SCAN_VALIDATION_REQUIRED) != 0U) && \
+                (LwXMLP_bValidateData(&pstrParserInstanceType->u8XMLworkingBuffer[objstrTextLoaderType.u32ValidationOffset], \
+                                      u32DataLength - objstrTextLoaderType.u32ValidationOffset) == STD_FALSE))
         {
-            bFoundNonWhiteSpaceCharacter = STD_TRUE;
+            pstrParserInstanceType->objenumErrorType = csInvalidXMLCharacter;
         }
         else
         {
@@ -3267,26 +6887,7 @@ static void LwXMLP_vCheckavailableData(LwXMLP_strXMLParseInstanceType *pstrParse
              * Nothing to do
              */
         }
-        *pu8WorkingBuffer = *pu8CurrentXMLCharacter;
-        pu8WorkingBuffer++;
-        u32DataLength++;
-        pu8CurrentXMLCharacter++;
-        if(pstrParserInstanceType->pu8CircularBufferEnd == pu8CurrentXMLCharacter)
-        {
-            pu8CurrentXMLCharacter = pstrParserInstanceType->u8XMLCircularBuffer;
-        }
-        else
-        {
-            /* nothing to do here */
-        }
-    }
-    /*
-     * Validate found data
-     */
-    if((pstrParserInstanceType->objenumErrorType == csNoError) && \
-       (pstrParserInstanceType->bEndOfDataIsFound == STD_TRUE)&&\
-       (bFoundNonWhiteSpaceCharacter == STD_TRUE))
-    {
+#else
         if(LwXMLP_bValidateData(pstrParserInstanceType->u8XMLworkingBuffer, u32DataLength) == STD_FALSE)
         {
             pstrParserInstanceType->objenumErrorType = csInvalidXMLCharacter;
@@ -3297,6 +6898,7 @@ static void LwXMLP_vCheckavailableData(LwXMLP_strXMLParseInstanceType *pstrParse
              * Nothing to do
              */
         }
+#endif
     }
     else
     {
@@ -3304,254 +6906,72 @@ static void LwXMLP_vCheckavailableData(LwXMLP_strXMLParseInstanceType *pstrParse
          * Nothing to do
          */
     }
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-    if((pstrParserInstanceType->bEndOfDataIsFound == STD_TRUE) && \
-       (pstrParserInstanceType->objenumErrorType == csNoError) && \
-       (pstrParserInstanceType->bSecondLevelBufferEnabled == STD_FALSE))
-#else
     if((pstrParserInstanceType->bEndOfDataIsFound == STD_TRUE) && \
        (pstrParserInstanceType->objenumErrorType == csNoError))
-#endif
     {
         if(bFoundNonWhiteSpaceCharacter == STD_TRUE)
         {
             *pu8WorkingBuffer = NULL_ASCII_CHARACTER;
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
+            /*
+             * Step 0: the replacement text which contains markup isn't reported as a text, the text before its
+             *         reference is reported and then the entity value is parsed in its place as a new input source
+             */
             if(bFoundReference == STD_TRUE)
             {
-                /*
-                 * Step 1: convert all entity references and check if entity is referring to itself
-                 *         and check if the entity start in one domain and end in other one
-                 */
-                for(u8EntityReferenceUpdateTrials = 0; \
-                    (u8EntityReferenceUpdateTrials < MAX_ENTITY_RESOLVING_DEPTH) && \
-                    (pstrParserInstanceType->objenumErrorType == csNoError); \
-                    ++u8EntityReferenceUpdateTrials)
+                s16MarkupEntityIndex = LwXMLP_s16FindMarkupReference(pstrParserInstanceType, \
+                                                                     pstrParserInstanceType->u8XMLworkingBuffer, \
+                                                                     &u32MarkupReferenceOffset, \
+                                                                     &u32MarkupReferenceNumber);
+                if((s16MarkupEntityIndex < 0) || (pstrParserInstanceType->objenumErrorType != csNoError))
                 {
-                    u32ResolvingLength = strlen((INT8S const *)pstrParserInstanceType->u8XMLworkingBuffer);
-                    /* TODO: remove 40 */
-                    u32ResolvingLength += 120U;
-                    if(u32ResolvingLength < MAX_WORKING_BUFFER_SIZE)
-                    {
-                        pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(pstrParserInstanceType, \
-                                                                                                    pstrParserInstanceType->u8XMLworkingBuffer,\
-                                                                                                    u32ResolvingLength,\
-                                                                                                    UPDATE_ENTITY_REFERENCE | \
-                                                                                                    DONT_DEREF_LT_GENERAL_ENTITY |\
-                                                                                                    DONT_DEREF_AS_GENERAL_ENTITY);
-                        if((pstrParserInstanceType->objenumErrorType == csMissingSemicolon) && (u8EntityReferenceUpdateTrials > 0U))
-                        { /* may be & appears after second round, so it shouldn't consider an error */
-                            pstrParserInstanceType->objenumErrorType = csNoError;
-                        }
-                        else
-                        {
-                            /*
-                             * Nothing to do
-                             */
-                        }
-                        if((pstrParserInstanceType->objenumErrorType == csInvalidReference) && (u8EntityReferenceUpdateTrials > 0U))
-                        {/* may be the entity shouldn't be resolved, so it will be left to the next round */
-                            pstrParserInstanceType->objenumErrorType = csNoError;
-                        }
-                        else
-                        {
-                            /*
-                             * Nothing to do
-                             */
-                        }
-                    }
-                    else
-                    {
-                        pstrParserInstanceType->objenumErrorType = csInternalError;
-                    }
-                    if((pstrParserInstanceType->u8FoundReference > 0U) &&\
-                       (pstrParserInstanceType->objenumErrorType == csNoError))
-                    {
-                        u8LastReferencesCountFound = pstrParserInstanceType->u8FoundReference;
-                        /*
-                        * check for any partial entity
-                        */
-                        for(u8ReferenceIndex = 0; \
-                            (u8ReferenceIndex < pstrParserInstanceType->u8FoundReference) && \
-                            (pstrParserInstanceType->objenumErrorType == csNoError); \
-                            ++u8ReferenceIndex)
-                        {
-                            if(pstrParserInstanceType->objstrFoundReferenceType[u8ReferenceIndex].objenumReferenceTypeType == csEntityReference)
-                            {
-                                u8EntityIndex  = pstrParserInstanceType->objstrFoundReferenceType[u8ReferenceIndex].u8EntityIndex;
-                                pu8EntityValue = pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityValue;
-                                u32ResolvingLength = strlen((INT8S const *)pu8EntityValue);
-                                if(u32ResolvingLength < MAX_ENTITY_VALUE_LENGTH)
-                                {
-                                    pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(pstrParserInstanceType, \
-                                                                                                                pu8EntityValue,\
-                                                                                                                u32ResolvingLength,\
-                                                                                                                REFERENCE_VALIDATEION_ONLY|\
-                                                                                                                UPDATE_CHARACTER_REFERENCE | \
-                                                                                                                DONT_DEREF_LT_GENERAL_ENTITY |\
-                                                                                                                DONT_DEREF_AS_GENERAL_ENTITY);
-                                    if(pstrParserInstanceType->objenumErrorType == csMissingSemicolon)
-                                    {
-                                        /*
-                                         * Chnage the error type
-                                         */
-                                        pstrParserInstanceType->objenumErrorType = csPartialCharacterReference;
-                                    }
-                                    else
-                                    {
-                                        /*
-                                         * Nothing to do
-                                         */
-                                    }
-                                }
-                                else
-                                {
-                                    pstrParserInstanceType->objenumErrorType = csInternalError;
-                                }
-                            }
-                            else
-                            {
-                                /*
-                                 * Nothing to do
-                                 */
-                            }
-                        }
-                        pstrParserInstanceType->u8FoundReference = u8LastReferencesCountFound;
-                    }
-                    else
-                    {
-                        break;
-                    }
+                    /*
+                     * Nothing to do
+                     */
                 }
-                if((u8LastReferencesCountFound > 0U) && (pstrParserInstanceType->objenumErrorType == csNoError))
-                {
-                    for(u8ReferenceIndex = 0U; \
-                        (u8ReferenceIndex < u8LastReferencesCountFound) && \
-                        (pstrParserInstanceType->objenumErrorType == csNoError); \
-                        ++u8ReferenceIndex)
-                    {
-                        if(pstrParserInstanceType->objstrFoundReferenceType[u8ReferenceIndex].objenumReferenceTypeType == csEntityReference)
-                        {   /* check that the found reference had been checked before if it is began in one entity and end in another */
-                            /* Rule 4.3.2 */
-                            u8EntityIndex  = pstrParserInstanceType->objstrFoundReferenceType[u8ReferenceIndex].u8EntityIndex;
-                            pu8EntityValue = pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityValue;
-                            if(pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityValueLength > 0U)
-                            {
-                                /* check if the still have unresolved entity, it may referee to itself */
-                                if(pstrParserInstanceType->u8FoundReference > 0U)
-                                {
-                                    if(strstr((INT8S const *)pstrParserInstanceType->u8XMLworkingBuffer, (INT8S const *)pu8EntityValue) != STD_NULL)
-                                    {
-                                        pstrParserInstanceType->objenumErrorType = csEntityRefereToItself;
-                                    }
-                                    else
-                                    {
-                                        pstrParserInstanceType->objenumErrorType = csLargeResolvingTrialsProperty;
-                                    }
-                                }
-                                else
-                                {
-                                    if(pstrParserInstanceType->u32LastReferenceLine != pstrParserInstanceType->u32LineNumber)
-                                    {/* entity is not validated before */
-                                        pstrParserInstanceType->u32LastReferenceLine       = pstrParserInstanceType->u32LineNumber;
-                                        pstrParserInstanceType->bParserSilentModeIsEnabled = STD_TRUE;
-                                        LwXMLP_vSwitchToSecondLevelBuffer(pstrParserInstanceType,\
-                                                                          pu8EntityValue,\
-                                                                          strlen((INT8S const *)pu8EntityValue));
-                                    }
-                                    else /* entity is validated before in the content and ready for Parsing */
-                                    {
-                                        pstrParserInstanceType->bParserSilentModeIsEnabled = STD_FALSE;
-                                        LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32BufferIndex);
-                                        LwXMLP_vSwitchToSecondLevelBuffer(pstrParserInstanceType,\
-                                                                          pstrParserInstanceType->u8XMLworkingBuffer,\
-                                                                          strlen((INT8S const *)pstrParserInstanceType->u8XMLworkingBuffer));
-                                    }
-                                    break;
-                                }
-                            }
-                            else
-                            {
-                                /*
-                                 * Nothing to do
-                                 */
-                            }
-                        }
-                        else
-                        {
-                            /*
-                             * Nothing to do
-                             */
-                        }
-                    }
+                else if((pstrParserInstanceType->u32LastReferenceLine != pstrParserInstanceType->u32LineNumber) || \
+                        (pstrParserInstanceType->u32LastReferenceColumn != pstrParserInstanceType->u32CoulmnNumber))
+                {/* the entity value is validated silently before any of the text is reported */
+                    pstrParserInstanceType->u32LastReferenceLine   = pstrParserInstanceType->u32LineNumber;
+                    pstrParserInstanceType->u32LastReferenceColumn = pstrParserInstanceType->u32CoulmnNumber;
+                    pstrParserInstanceType->bEndOfDataIsFound      = STD_FALSE;
+                    LwXMLP_vPushInputSource(pstrParserInstanceType, s16MarkupEntityIndex, STD_TRUE, STD_FALSE);
                 }
-                else /* there is no more references */
+                else /* the entity value is validated before, so only the text till its reference is taken */
                 {
-                    /*TODO: erro */
+                    u32BufferIndex = LwXMLP_u32GetReferenceEnd(pstrParserInstanceType, u32MarkupReferenceNumber);
+                    pstrParserInstanceType->u8XMLworkingBuffer[u32MarkupReferenceOffset] = NULL_ASCII_CHARACTER;
+                    u32DataLength                                                        = u32MarkupReferenceOffset;
                 }
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+            if((bFoundReference == STD_TRUE) && (pstrParserInstanceType->bEndOfDataIsFound == STD_TRUE) && \
+               (pstrParserInstanceType->objenumErrorType == csNoError))
+            {
                 /*
-                 * Step 2: update all character reference
+                 * Step 1: replace the entity and the character references in one pass, the nested references are
+                 *         replaced through the stack of the expansion, which also finds the entities which refer to
+                 *         themselves and the references which begin in one entity and end outside it
                  */
-                if((pstrParserInstanceType->objenumErrorType == csNoError) && (pstrParserInstanceType->bSecondLevelBufferEnabled == STD_FALSE))
+                if(u32DataLength < MAX_WORKING_BUFFER_SIZE)
                 {
-                    u32ResolvingLength = strlen((INT8S const *)pstrParserInstanceType->u8XMLworkingBuffer);
-                    if(u32ResolvingLength < MAX_WORKING_BUFFER_SIZE)
-                    {
-                        pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(pstrParserInstanceType, \
-                                                                                                    pstrParserInstanceType->u8XMLworkingBuffer,\
-                                                                                                    u32ResolvingLength,\
-                                                                                                    UPDATE_CHARACTER_REFERENCE |\
-                                                                                                    DONT_DEREF_LT_GENERAL_ENTITY |\
-                                                                                                    DONT_DEREF_AS_GENERAL_ENTITY);
-                    }
-                    else
-                    {
-                        pstrParserInstanceType->objenumErrorType = csInternalError;
-                    }
+                    pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(pstrParserInstanceType, \
+                                                                                                pstrParserInstanceType->u8XMLworkingBuffer,\
+                                                                                                &u32DataLength,\
+                                                                                                0U,\
+                                                                                                MAX_WORKING_BUFFER_SIZE,\
+                                                                                                UPDATE_ENTITY_REFERENCE | \
+                                                                                                UPDATE_CHARACTER_REFERENCE | \
+                                                                                                VALIDATE_REPLACEMENT_TEXT);
                 }
                 else
                 {
-                    /*
-                     * Nothing to do
-                     */
-                }
-                if(pstrParserInstanceType->bSecondLevelBufferEnabled == STD_TRUE)
-                {
-                    pstrParserInstanceType->bEndOfDataIsFound = STD_FALSE;
-                }
-                else
-                {/* we prevented the dereference for the &lt during the validation, so it is time to be referenced before reporting */
-                    if(pstrParserInstanceType->objenumErrorType == csNoError)
-                    {
-                        u32ResolvingLength = strlen((INT8S const *)pstrParserInstanceType->u8XMLworkingBuffer);
-                        if(u32ResolvingLength < MAX_WORKING_BUFFER_SIZE)
-                        {
-                            pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(pstrParserInstanceType, \
-                                                                                                        pstrParserInstanceType->u8XMLworkingBuffer,\
-                                                                                                        u32ResolvingLength,\
-                                                                                                        UPDATE_ENTITY_REFERENCE);
-                            if(pstrParserInstanceType->objenumErrorType == csMissingSemicolon)
-                            { /* may be & appears due to character entity */
-                                pstrParserInstanceType->objenumErrorType = csNoError;
-                            }
-                            else
-                            {
-                                /*
-                                 * Nothing to do
-                                 */
-                            }
-                        }
-                        else
-                        {
-                            pstrParserInstanceType->objenumErrorType = csInternalError;
-                        }
-                    }
-                    else
-                    {
-                        /*
-                         * Nothing to do
-                         */
-                    }
+                    pstrParserInstanceType->objenumErrorType = csInternalError;
                 }
             }
             else /* no available references */
@@ -3565,7 +6985,36 @@ static void LwXMLP_vCheckavailableData(LwXMLP_strXMLParseInstanceType *pstrParse
             {
                 LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found Data %s", pstrParserInstanceType->u8XMLworkingBuffer);
                 pstrParserInstanceType->pu8ParsedDataBuffer = &pstrParserInstanceType->u8XMLworkingBuffer[0];
+                pstrParserInstanceType->u32ParsedDataLength = u32DataLength;
                 LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32BufferIndex); /* consume the read data */
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+                if(s16MarkupEntityIndex >= 0)
+                {/* the reference is consumed with the text before it, so the entity value is parsed next, it is
+                  * already charged to the budget while it is validated silently */
+                    LwXMLP_vPushInputSource(pstrParserInstanceType, s16MarkupEntityIndex, STD_FALSE, STD_TRUE);
+                    pu8WorkingBuffer = pstrParserInstanceType->u8XMLworkingBuffer;
+                    while((*pu8WorkingBuffer != NULL_ASCII_CHARACTER) && (LwXMLP_bIsWhiteSpace(pu8WorkingBuffer) == STD_TRUE))
+                    {
+                        pu8WorkingBuffer++;
+                    }
+                    if(*pu8WorkingBuffer == NULL_ASCII_CHARACTER)
+                    {/* the text before the reference is insignificant white space */
+                        pstrParserInstanceType->bEndOfDataIsFound = STD_FALSE;
+                    }
+                    else
+                    {
+                        /*
+                         * Nothing to do
+                         */
+                    }
+                }
+                else
+                {
+                    /*
+                     * Nothing to do
+                     */
+                }
+#endif
             }
             else
             {
@@ -3581,11 +7030,12 @@ static void LwXMLP_vCheckavailableData(LwXMLP_strXMLParseInstanceType *pstrParse
             {
                 *pu8WorkingBuffer                           = NULL_ASCII_CHARACTER;
                 pstrParserInstanceType->pu8ParsedDataBuffer = &pstrParserInstanceType->u8XMLworkingBuffer[0];
-                LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32DataLength);
+                pstrParserInstanceType->u32ParsedDataLength = u32DataLength;
+                LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32BufferIndex);
             }
             else/* it is insignificant white space, so it shouldn't reported as a data */
             {
-                LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32DataLength);
+                LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32BufferIndex);
                 pstrParserInstanceType->bEndOfDataIsFound = STD_FALSE;
             }
         }
@@ -3595,61 +7045,25 @@ static void LwXMLP_vCheckavailableData(LwXMLP_strXMLParseInstanceType *pstrParse
         pstrParserInstanceType->objenumErrorType = csLargeDatalength;
         LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Can't load the XML Tag into the buffer");
     }
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-    else if(pstrParserInstanceType->bSecondLevelBufferEnabled == STD_TRUE)/* the second level buffer contain data */
+    else
     {
-        *pu8WorkingBuffer = NULL_ASCII_CHARACTER;
-        u32ResolvingLength = strlen((INT8S const *)pstrParserInstanceType->u8XMLworkingBuffer);
-        if(u32ResolvingLength < MAX_WORKING_BUFFER_SIZE)
-        {
-            pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(pstrParserInstanceType, \
-                                                                                        pstrParserInstanceType->u8XMLworkingBuffer,\
-                                                                                        u32ResolvingLength,\
-                                                                                        UPDATE_ENTITY_REFERENCE | UPDATE_CHARACTER_REFERENCE);
-            if(pstrParserInstanceType->objenumErrorType == csNoError)
-            {
-                u32DataLength = strlen((INT8S const *)pstrParserInstanceType->u8XMLworkingBuffer);
-                if(LwXMLP_bValidateData(pstrParserInstanceType->u8XMLworkingBuffer, u32DataLength) == STD_FALSE)
-                {
-                    pstrParserInstanceType->objenumErrorType = csInvalidXMLCharacter;
-                }
-                else
-                {
-                    LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found Data %s", pstrParserInstanceType->u8XMLworkingBuffer);
-                    pstrParserInstanceType->pu8ParsedDataBuffer = &pstrParserInstanceType->u8XMLworkingBuffer[0];
-                    /*
-                     * if we have data in non silent mode, we have to report
-                     */
-                    if(pstrParserInstanceType->bParserSilentModeIsEnabled == STD_FALSE)
-                    {
-                        pstrParserInstanceType->bEndOfDataIsFound = STD_TRUE;
-                    }
-                    else
-                    {
-                        /*
-                         * Nothing to do
-                         */
-                    }
-                    LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32BufferIndex); /* consume the read data */
-                }
-            }
-            else
-            {
-                /*
-                 * Nothing to do
-                 */
-            }
-        }
-        else
-        {
-            pstrParserInstanceType->objenumErrorType = csInternalError;
-        }
+        /* unexpected */
+    }
+#if(ENABLE_EOL_NORMALIZATION == STD_ON)
+    if((pstrParserInstanceType->objenumErrorType == csNoError) && \
+       (pstrParserInstanceType->bEndOfDataIsFound == STD_TRUE) && \
+       (bTextIsNormalized == STD_FALSE))
+    {
+        pstrParserInstanceType->u32ParsedDataLength = LwXMLP_u32NormalizeEndOfLine(pstrParserInstanceType->u8XMLworkingBuffer, \
+                                                                                   u32DataLength);
     }
-#endif
     else
     {
-        /* unexpected */
+        /*
+         * Nothing to do
+         */
     }
+#endif
 }
 /*
  * search for ]]>
@@ -3664,15 +7078,29 @@ static BOOLEAN LwXMLP_bValidateData(INT8U const *pu8DataString, INT32U u32dataLe
         (u32DataIndex < u32dataLength) && (bValidData == STD_TRUE);\
         u32DataIndex += u32CharacterLength)
     {
-        if(u32dataLength >= 3U)
+        if(((u32DataIndex + ASCII_RUN_LENGTH) <= u32dataLength) && \
+           (LwXMLP_bIsPlainASCIIRun(&pu8DataString[u32DataIndex]) == STD_TRUE))
+        {
+            u32CharacterLength = ASCII_RUN_LENGTH;
+        }
+        else
         {
-            if(pu8DataString[u32DataIndex] == CLOSING_BRACKET_CHARACTER)
+            if(u32dataLength >= 3U)
             {
-                if(pu8DataString[u32DataIndex + 1U] == CLOSING_BRACKET_CHARACTER)
+                if(pu8DataString[u32DataIndex] == CLOSING_BRACKET_CHARACTER)
                 {
-                    if(pu8DataString[u32DataIndex + 2U] == GREATER_THAN_ASCII_CHARACTER)
+                    if(pu8DataString[u32DataIndex + 1U] == CLOSING_BRACKET_CHARACTER)
                     {
-                        bValidData = STD_FALSE;
+                        if(pu8DataString[u32DataIndex + 2U] == GREATER_THAN_ASCII_CHARACTER)
+                        {
+                            bValidData = STD_FALSE;
+                        }
+                        else
+                        {
+                            /*
+                             * Nothing to do
+                             */
+                        }
                     }
                     else
                     {
@@ -3688,6 +7116,11 @@ static BOOLEAN LwXMLP_bValidateData(INT8U const *pu8DataString, INT32U u32dataLe
                      */
                 }
             }
+            u32CharacterLength = LwXMLP_u8ValidCharacter(&pu8DataString[u32DataIndex]);
+            if(u32CharacterLength == 0U)
+            {
+                bValidData = STD_FALSE;
+            }
             else
             {
                 /*
@@ -3695,10 +7128,40 @@ static BOOLEAN LwXMLP_bValidateData(INT8U const *pu8DataString, INT32U u32dataLe
                  */
             }
         }
-        u32CharacterLength = LwXMLP_u8ValidCharacter(&pu8DataString[u32DataIndex]);
-        if(u32CharacterLength == 0U)
+    }
+
+    return bValidData;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_bIsPlainASCIIRun                                        <LwXMLP_CORE>
+
+SYNTAX:         BOOLEAN LwXMLP_bIsPlainASCIIRun(INT8U const *pu8DataString)
+
+DESCRIPTION :   Check ASCII_RUN_LENGTH characters at once, 4 bytes per word, if all of them are printable ASCII
+                characters (0x20 to 0x7F) which are valid W3C Char, and none of them is closing bracket which may
+                start the "]]>" sequence
+
+PARAMETER1  :   pu8DataString : pointer to the run to be checked
+
+RETURN VALUE:   STD_TRUE : if the run can be accepted without checking its characters one by one
+                STD_FALSE: if the run shall be checked character by character
+
+Note        :   a byte below 0x20 causes a borrow which sets its own high bit, so the subtraction can't hide it
+END DESCRIPTION *******************************************************************************************************/
+static BOOLEAN LwXMLP_bIsPlainASCIIRun(INT8U const *pu8DataString)
+{
+    BOOLEAN bPlainASCIIRun = STD_TRUE;
+    INT32U  u32Word, u32WordIndex;
+
+    for(u32WordIndex = 0U; \
+        (u32WordIndex < ASCII_RUN_LENGTH) && (bPlainASCIIRun == STD_TRUE); \
+        u32WordIndex += 4U)
+    {
+        (void)memcpy(&u32Word, &pu8DataString[u32WordIndex], 4U);
+        if((((u32Word | (u32Word - (SPACE_ASCII_CHARACTER * SCAN_WORD_ONES))) & SCAN_WORD_HIGH_BITS) != 0U) || \
+           (LwXMLP_mMatchWordBytes(u32Word, CLOSING_BRACKET_CHARACTER) != 0U))
         {
-            bValidData = STD_FALSE;
+            bPlainASCIIRun = STD_FALSE;
         }
         else
         {
@@ -3708,337 +7171,369 @@ static BOOLEAN LwXMLP_bValidateData(INT8U const *pu8DataString, INT32U u32dataLe
         }
     }
 
-    return bValidData;
+    return bPlainASCIIRun;
 }
 /* START FUNCTION DESCRIPTION ******************************************************************************************
 LwXMLP_enumUpdateEntityReference                                        <LwXMLP_CORE>
 
-SYNTAX:         LwXMLP_enumErrorType LwXMLP_enumUpdateEntityReference(NT8U *pu8BufferString)
+SYNTAX:         LwXMLP_enumErrorType LwXMLP_enumUpdateEntityReference(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                                      INT8U                          *pu8BufferString,\
+                                                                      INT32U                         *pu32StringLength,\
+                                                                      INT32U                          u32BlockLength,\
+                                                                      INT32U                          u32BufferSize,\
+                                                                      INT32U                          u32UpdateOptionMask)
 
-DESCRIPTION :   this API responsible to search in the working buffer for the
-
-PARAMETER1  :   pstrParserInstanceType : pointer to the buffer that contains the Entity Reference
-
-RETURN VALUE:
+DESCRIPTION :   Replace the references of the string by their values in its own place, the expansion is measured
+                first, then the block of the string is moved once by the largest growth, so the expansion is written
+                from the start of the buffer by a cursor which never overtakes the moved input
 
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   pu8BufferString        : the string with NULL terminator which its references are replaced
+PARAMETER3  :   pu32StringLength       : the length of the string, it is updated by the length of the expanded string
+PARAMETER4  :   u32BlockLength         : the length of the block which starts by the string, the bytes which follow
+                                         the string terminator inside the block are kept after the expanded string
+PARAMETER5  :   u32BufferSize          : the number of the bytes which can be written from the start of the string
+PARAMETER6  :   u32UpdateOptionMask    : the references which shall be replaced
 
-Note        :   this API assume that the (& ;) are available if the & is only
+RETURN VALUE:   the first found error or csNoError
 
+Note        :   if the string has an error it is kept as it is
 END DESCRIPTION *******************************************************************************************************/
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
 static LwXMLP_enumErrorType LwXMLP_enumUpdateEntityReference(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
                                                                     INT8U                          *pu8BufferString,\
-                                                                    INT32U                          u32MaxBlockLength,\
+                                                                    INT32U                         *pu32StringLength,\
+                                                                    INT32U                          u32BlockLength,\
+                                                                    INT32U                          u32BufferSize,\
                                                                     INT32U                          u32UpdateOptionMask)
+{
+    strReferenceExpansionType objstrReferenceExpansionType;
+    INT32U                    u32StringLength;
+    LwXMLP_enumErrorType      objenumErrorType;
+
+    u32StringLength = *pu32StringLength;
+    if(u32BlockLength <= u32StringLength)
+    {
+        u32BlockLength = u32StringLength + 1U; /* the block contains at least the string and its terminator */
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    /* round one, measure the expansion without writing */
+    objstrReferenceExpansionType.pu8Input         = pu8BufferString;
+    objstrReferenceExpansionType.pu8Output        = STD_NULL;
+    objstrReferenceExpansionType.pu32ProbedLength = STD_NULL;
+    objenumErrorType = LwXMLP_enumExpandReferences(pstrParserInstanceType, &objstrReferenceExpansionType, u32UpdateOptionMask);
+    if(((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) == 0U) && \
+       (objenumErrorType == csNoError) && \
+       (objstrReferenceExpansionType.u16ReplacedReferences > 0U))
+    {/* the references are charged by the measuring, so the writing can't stop where a failed measuring stops */
+        if((u32BufferSize >= u32BlockLength) && \
+           (objstrReferenceExpansionType.u32LargestGrowth <= (u32BufferSize - u32BlockLength)))
+        {
+            /* round two, move the block once and write the expansion in front of it */
+            (void)memmove(&pu8BufferString[objstrReferenceExpansionType.u32LargestGrowth], pu8BufferString, u32BlockLength);
+            objstrReferenceExpansionType.pu8Input  = &pu8BufferString[objstrReferenceExpansionType.u32LargestGrowth];
+            objstrReferenceExpansionType.pu8Output = pu8BufferString;
+            objenumErrorType = LwXMLP_enumExpandReferences(pstrParserInstanceType, &objstrReferenceExpansionType, u32UpdateOptionMask);
+            /* join the rest of the block to the expanded string */
+            (void)memmove(&pu8BufferString[objstrReferenceExpansionType.u32OutputLength], \
+                          &objstrReferenceExpansionType.pu8Input[objstrReferenceExpansionType.u32InputLength], \
+                          u32BlockLength - objstrReferenceExpansionType.u32InputLength);
+            *pu32StringLength = (u32StringLength + objstrReferenceExpansionType.u32OutputLength) - \
+                                objstrReferenceExpansionType.u32InputLength;
+        }
+        else
+        {
+            objenumErrorType = csInternalError;
+            LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "No room for the entity expansion");
+        }
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+
+    return objenumErrorType;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_enumExpandReferences                                        <LwXMLP_CORE>
+
+SYNTAX:         LwXMLP_enumErrorType LwXMLP_enumExpandReferences(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                                 strReferenceExpansionType      *pstrReferenceExpansionType, \
+                                                                 INT32U                          u32UpdateOptionMask)
+
+DESCRIPTION :   Scan the input once and write it to the output cursor with the selected references replaced by their
+                values, the value of an entity isn't copied to be scanned again, it is scanned in its place in the
+                entity arena, and the source which includes it is kept in a stack, so the nested references are
+                replaced in the same pass
+
+PARAMETER1  :   pstrParserInstanceType     : pointer to the XML instance
+PARAMETER2  :   pstrReferenceExpansionType : the input and the output of the expansion
+PARAMETER3  :   u32UpdateOptionMask        : the references which shall be replaced
+
+RETURN VALUE:   the first found error or csNoError
+
+Note        :   the found references are recorded in objstrFoundReferenceType in the order of their expansion, the
+                written characters are never scanned again, so a reference which is made by a character reference
+                (e.g. &#38;lt;) is kept as a text
+END DESCRIPTION *******************************************************************************************************/
+static LwXMLP_enumErrorType LwXMLP_enumExpandReferences(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                        strReferenceExpansionType      *pstrReferenceExpansionType, \
+                                                        INT32U                          u32UpdateOptionMask)
 {
     typedef enum
     {
         csCheckSemicolonDelimiterState,
         csCheckAmpersandDelimiterState
     }enumEntityUpdateStateType;
-                 BOOLEAN                   bStopChecking = STD_FALSE;
-    static const INT8S                     cs8SmallerCharEntity[]          = "lt";
-    static const INT8S                     cs8GreaterCharEntity[]          = "gt";
-    static const INT8S                     cs8AmpersandCharEntity[]        = "amp";
-    static const INT8S                     cs8SingleQuoteCharEntity[]      = "apos";
-    static const INT8S                     cs8DoubleQuoteCharEntity[]      = "quot";
-                 INT8U                    *pu8AmpersandDelimiter, *pu8TempString, u8UTF8CodeLength, u8EntityIndex;
-                 INT8U   const            *pu8EntityValue;
-                 INT32U                    u32CheckedLength = 0U, u32EntityValueLength = 0U, u32EntityNameLength = 0U;
-                 INT32U                    u32TempUniCode = 0U, u32FinalUniCode = 0U, u32StringLength, u32MoveLength;
-                 LwXMLP_enumErrorType      objenumErrorType = csNoError; /* Assume no error */
-                 enumEntityUpdateStateType objenumEntityUpdateStateType = csCheckAmpersandDelimiterState;
-                 LwXMLP_enumReferenceTypeType objenumReferenceTypeType = csUnkownEntity;
-
-    pstrParserInstanceType->u8FoundReference = 0U;
-    pu8AmpersandDelimiter                    = pu8BufferString; /*Initial value */
-    u32StringLength                          = strlen((INT8S const *)pu8BufferString); /*Initial value */
-    pu8TempString                            = pu8BufferString;
+    typedef struct
+    {
+        INT8U const *pu8ResumeAddress; /* where the including source continues after the reference */
+        INT16S       s16EntityIndex;   /* the entity which its value is scanned */
+    }strIncludingSourceType;
+    static const INT8S * const     cs8PredefinedEntityName[PREDEFINED_ENTITIES_COUNT] = {"lt", "gt", "amp", "apos", "quot"};
+    static const INT8U             cu8PredefinedEntityValue[PREDEFINED_ENTITIES_COUNT] = {(INT8U)'<', (INT8U)'>', (INT8U)'&', (INT8U)'\'', (INT8U)'"'};
+    static const INT8U             cu8AttributeSpace = SPACE_ASCII_CHARACTER;
+    strIncludingSourceType         objstrIncludingSourceType[MAX_ENTITY_RESOLVING_DEPTH];
+    INT8U                          u8SourceDepth = 0U, u8SourceIndex, u8PredefinedIndex, u8UTF8CodeLength;
+    INT8U                          u8UTF8Code[5U];
+    INT8U                  const  *pu8Read, *pu8ReferenceStart = STD_NULL, *pu8Replacement;
+    INT32U                         u32RunLength, u32ReferenceLength, u32ReplacementLength, u32EntitySlot;
+    INT32U                         u32TempUniCode = 0U, u32FinalUniCode = 0U;
+    INT16S                         s16EntityIndex;
+    BOOLEAN                        bExpansionIsDone = STD_FALSE;
+    LwXMLP_enumErrorType           objenumErrorType = csNoError; /* Assume no error */
+    enumEntityUpdateStateType      objenumEntityUpdateStateType = csCheckAmpersandDelimiterState;
+    LwXMLP_enumReferenceTypeType   objenumReferenceTypeType = csUnkownEntity;
+
+    pstrParserInstanceType->u8FoundReference          = 0U;
+    pstrReferenceExpansionType->u32InputLength        = 0U;
+    pstrReferenceExpansionType->u32OutputLength       = 0U;
+    pstrReferenceExpansionType->u32LargestGrowth      = 0U;
+    pstrReferenceExpansionType->u16ReplacedReferences = 0U;
+    pstrReferenceExpansionType->bMarkupIsFound        = STD_FALSE;
+    pu8Read                                           = pstrReferenceExpansionType->pu8Input;
     do
     {
-        switch(objenumEntityUpdateStateType)
+        if((*pu8Read == NULL_ASCII_CHARACTER) && (u8SourceDepth > 0U))
+        {/* end of the entity value, continue in the source which includes it */
+            if(objenumEntityUpdateStateType == csCheckSemicolonDelimiterState)
+            {/* the reference is began in the entity and ended outside it */
+                objenumErrorType = csPartialCharacterReference;
+            }
+            else
+            {
+                u8SourceDepth--;
+                pu8Read = objstrIncludingSourceType[u8SourceDepth].pu8ResumeAddress;
+            }
+        }
+        else
         {
-            case csCheckAmpersandDelimiterState:
-                 if(*pu8TempString == AMPERSAND_ASCII_CHARACTER)
-                 {
-                     u32EntityNameLength   = 0U;/* Initialize to calculate the code length */
-                     u32FinalUniCode       = 0U;
-                     pu8AmpersandDelimiter = pu8TempString;
-                     if(pu8AmpersandDelimiter[1U] == HASH_ASCII_CHARACTER)
+            switch(objenumEntityUpdateStateType)
+            {
+                case csCheckAmpersandDelimiterState:
+                     if(*pu8Read == AMPERSAND_ASCII_CHARACTER)
                      {
-                         if(pu8AmpersandDelimiter[2] == X_SMALL_ASCII_CHARACTER) /* Character reference in hexadecimal*/
+                         u32FinalUniCode   = 0U;
+                         pu8ReferenceStart = pu8Read;
+                         if(pu8Read[1U] == HASH_ASCII_CHARACTER)
                          {
-                             objenumReferenceTypeType  = csHexCharcterReference;
-                             pu8TempString             = &pu8TempString[3];
-                             u32CheckedLength         += 3U;
-                             u32EntityNameLength      += 4U; /* Add the &#x ; */
+                             if(pu8Read[2U] == X_SMALL_ASCII_CHARACTER) /* Character reference in hexadecimal*/
+                             {
+                                 objenumReferenceTypeType = csHexCharcterReference;
+                                 pu8Read                  = &pu8Read[3U];
+                             }
+                             else
+                             {
+                                 objenumReferenceTypeType = csDecimalCharcterReference;
+                                 pu8Read                  = &pu8Read[2U];
+                             }
                          }
                          else
                          {
-                             objenumReferenceTypeType  = csDecimalCharcterReference;
-                             pu8TempString             = &pu8TempString[2];
-                             u32CheckedLength         += 2U;
-                             u32EntityNameLength      += 3U; /* Add the &# ; */
+                             objenumReferenceTypeType = csEntityReference;
+                             pu8Read++;
+                         }
+                         if(((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) != 0U)||
+                            (((u32UpdateOptionMask & (UPDATE_ENTITY_REFERENCE | UPDATE_PARAMETER_REFERENCE)) != 0U) && \
+                                    (objenumReferenceTypeType == csEntityReference))||
+                            (((u32UpdateOptionMask & (UPDATE_DECIMAL_CHAR_REFERENCE | UPDATE_CHARACTER_REFERENCE)) != 0U) && \
+                                    (objenumReferenceTypeType == csDecimalCharcterReference))||
+                            (((u32UpdateOptionMask & (UPDATE_HEX_CHARACTER_REFERENCE | UPDATE_CHARACTER_REFERENCE)) != 0U) && \
+                                    (objenumReferenceTypeType == csHexCharcterReference)))
+                         {
+                             objenumEntityUpdateStateType = csCheckSemicolonDelimiterState;
+                         }
+                         else
+                         {/* the reference is kept as it is */
+                             LwXMLP_vWriteExpansion(pstrReferenceExpansionType, \
+                                                    pu8ReferenceStart, \
+                                                    (INT32U)(pu8Read - pu8ReferenceStart), \
+                                                    pu8Read, \
+                                                    u8SourceDepth);
                          }
                      }
-                     else
-                     {
-                         objenumReferenceTypeType = csEntityReference;
-                         pu8TempString++;
-                         u32CheckedLength++;
+                     else if(((u32UpdateOptionMask & NORMALIZE_ATTRIBUTE_VALUE) != 0U) && (u8SourceDepth > 0U) && \
+                             (*pu8Read == LESS_THAN_ASCII_CHARACTER))
+                     {/* the replacement text of a reference in an attribute value shall not contain < */
+                         objenumErrorType = csInvalidDirectReference;
                      }
-                     if(((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) != 0U)||
-                        (((u32UpdateOptionMask & UPDATE_ENTITY_REFERENCE) != 0U) && \
-                                (objenumReferenceTypeType == csEntityReference))||
-                        (((u32UpdateOptionMask & UPDATE_PARAMETER_REFERENCE) != 0U) && \
-                                (objenumReferenceTypeType == csEntityReference))||
-                        (((u32UpdateOptionMask & UPDATE_DECIMAL_CHAR_REFERENCE) != 0U) && \
-                                (objenumReferenceTypeType == csDecimalCharcterReference))||
-                        (((u32UpdateOptionMask & UPDATE_HEX_CHARACTER_REFERENCE) != 0U) && \
-                                (objenumReferenceTypeType == csHexCharcterReference))||
-                        (((u32UpdateOptionMask & UPDATE_CHARACTER_REFERENCE) != 0U) && \
-                                ((objenumReferenceTypeType == csDecimalCharcterReference) || \
-                                        (objenumReferenceTypeType == csHexCharcterReference))))
-                     {
-                         objenumEntityUpdateStateType = csCheckSemicolonDelimiterState;
+                     else if(((u32UpdateOptionMask & NORMALIZE_ATTRIBUTE_VALUE) != 0U) && (u8SourceDepth > 0U) && \
+                             ((*pu8Read == HTAB_ASCII_CHARACTER) || (*pu8Read == LINE_FEED_ASCII_CHARACTER) || \
+                              (*pu8Read == CARRIAGE_RETURN_ASCII_CHARACTER)))
+                     {/* the white space of the replacement text is appended as a space */
+                         LwXMLP_vWriteExpansion(pstrReferenceExpansionType, \
+                                                &cu8AttributeSpace, \
+                                                1U, \
+                                                &pu8Read[1U], \
+                                                u8SourceDepth);
+                         pu8Read++;
                      }
                      else
-                     {
-                         /*
-                          * Nothing to do
-                          */
+                     {/* copy the run of characters till the next reference or the end of the source */
+                         if(((u32UpdateOptionMask & NORMALIZE_ATTRIBUTE_VALUE) != 0U) && (u8SourceDepth > 0U))
+                         {
+                             u32RunLength = strcspn((INT8S const *)pu8Read, "&<\t\n\r");
+                         }
+                         else
+                         {
+                             u32RunLength = strcspn((INT8S const *)pu8Read, "&");
+                         }
+                         if((pu8Read[u32RunLength] == NULL_ASCII_CHARACTER) && (u8SourceDepth == 0U))
+                         {
+                             u32RunLength++; /* the terminator of the input is written too */
+                             bExpansionIsDone = STD_TRUE;
+                         }
+                         else
+                         {
+                             /*
+                              * Nothing to do
+                              */
+                         }
+                         LwXMLP_vWriteExpansion(pstrReferenceExpansionType, \
+                                                pu8Read, \
+                                                u32RunLength, \
+                                                &pu8Read[u32RunLength], \
+                                                u8SourceDepth);
+                         pu8Read = &pu8Read[u32RunLength];
                      }
-
-                 }
-                 else if(*pu8TempString == PERCENT_ASCII_CHARACTER)
-                 {
-                     objenumReferenceTypeType = csParamterEntity;
-                     pu8TempString++;
-                     u32CheckedLength++;
-                 }
-                 else
-                 {
-                     u32CheckedLength++;
-                     pu8TempString++;
-                 }
-                 break;
-            case csCheckSemicolonDelimiterState:
-                 if(*pu8TempString == SEMICOLON_ASCII_CHARACTER)
-                 { /* reach end of the reference and we are ready for substitution Original */
-                     if(LwXMLP_bValideEntity(pu8AmpersandDelimiter) == STD_TRUE)
-                     {
-                         if(objenumReferenceTypeType == csEntityReference)
+                     break;
+                case csCheckSemicolonDelimiterState:
+                     if(*pu8Read == SEMICOLON_ASCII_CHARACTER)
+                     { /* reach end of the reference and we are ready for substitution */
+                         pu8Read++;
+                         u32ReferenceLength   = (INT32U)(pu8Read - pu8ReferenceStart);
+                         pu8Replacement       = STD_NULL;
+                         u32ReplacementLength = 0U;
+                         s16EntityIndex       = -1;
+                         if(LwXMLP_bValideEntity(pu8ReferenceStart) == STD_FALSE)
                          {
-                             pu8EntityValue = STD_NULL;
-                             if(strncmp((INT8S const *)&pu8AmpersandDelimiter[1U], cs8SmallerCharEntity, u32EntityNameLength) == 0)
+                             objenumErrorType = csInvalidReference;
+                             LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid Character Reference");
+                         }
+                         else if(objenumReferenceTypeType == csEntityReference)
+                         {
+                             u8PredefinedIndex = LwXMLP_u8FindPredefinedEntity(cs8PredefinedEntityName, \
+                                                                               &pu8ReferenceStart[1U], \
+                                                                               u32ReferenceLength - 2U);
+                             if(u8PredefinedIndex < PREDEFINED_ENTITIES_COUNT)
                              {
-                                 if(((u32UpdateOptionMask & DONT_DEREF_LT_GENERAL_ENTITY) != 0U) ||
-                                    (((u32UpdateOptionMask & UPDATE_ENTITY_REFERENCE) != UPDATE_ENTITY_REFERENCE)&&
-                                    ((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) != REFERENCE_VALIDATEION_ONLY)))
+                                 if((((u32UpdateOptionMask & UPDATE_ENTITY_REFERENCE) != 0U) ||
+                                     ((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) != 0U)) &&
+                                    (((u32UpdateOptionMask & DONT_DEREF_LT_GENERAL_ENTITY) == 0U) ||
+                                     (cu8PredefinedEntityValue[u8PredefinedIndex] != LESS_THAN_ASCII_CHARACTER)) &&
+                                    (((u32UpdateOptionMask & DONT_DEREF_AS_GENERAL_ENTITY) == 0U) ||
+                                     (cu8PredefinedEntityValue[u8PredefinedIndex] != AMPERSAND_ASCII_CHARACTER)))
                                  {
-                                     pu8TempString++; /* escape semicolomn */
+                                     pu8Replacement       = &cu8PredefinedEntityValue[u8PredefinedIndex];
+                                     u32ReplacementLength = 1U;
+                                     LwXMLP_vRecordFoundReference(pstrParserInstanceType, csCharacterEntityReference, 0U);
                                  }
                                  else
                                  {
-                                     pu8EntityValue = (INT8U const*)"<";
-                                     u32EntityValueLength   = 1U;
-                                     if(pstrParserInstanceType->u8FoundReference < MAX_FOUND_REFERENCE)
-                                     {
-                                         pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].objenumReferenceTypeType = csCharacterEntityReference;
-                                         pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].u8EntityIndex = 0U;
-                                         pstrParserInstanceType->u8FoundReference++;
-                                     }
-                                     else
-                                     {
-                                         /*
-                                          * Nothing to do
-                                          */
-                                     }
+                                     /*
+                                      * Nothing to do
+                                      */
                                  }
                              }
-                             else if(strncmp((INT8S const *)&pu8AmpersandDelimiter[1U], cs8GreaterCharEntity, u32EntityNameLength) == 0)
+                             else if((u32UpdateOptionMask & UPDATE_ENTITY_REFERENCE) != 0U)
                              {
-                                 if(((u32UpdateOptionMask & UPDATE_ENTITY_REFERENCE) != 0U) || \
-                                    ((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) != 0U))
-                                 {
-                                     pu8EntityValue = (INT8U const *)">";
-                                     u32EntityValueLength   = 1U;
-                                     if(pstrParserInstanceType->u8FoundReference < MAX_FOUND_REFERENCE)
-                                     {
-                                         pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].objenumReferenceTypeType = csCharacterEntityReference;
-                                         pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].u8EntityIndex = 0U;
-                                         pstrParserInstanceType->u8FoundReference++;
-                                     }
-                                     else
-                                     {
-                                         /*
-                                          * Nothing to do
-                                          */
-                                     }
-                                 }
-                                 else
+                                 s16EntityIndex = LwXMLP_s16FindEntity(pstrParserInstanceType, \
+                                                                       &pu8ReferenceStart[1U], \
+                                                                       u32ReferenceLength - 2U, \
+                                                                       csEntityReference, \
+                                                                       &u32EntitySlot);
+                                 if(s16EntityIndex >= 0)
                                  {
-                                     pu8TempString++; /* escape semicolomn */
+                                     LwXMLP_vRecordFoundReference(pstrParserInstanceType, \
+                                                                  pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[s16EntityIndex].objenumReferenceTypeType, \
+                                                                  (INT16U)s16EntityIndex);
                                  }
-                             }
-                             else if(strncmp((INT8S const *)&pu8AmpersandDelimiter[1U], cs8AmpersandCharEntity, u32EntityNameLength) == 0)
-                             {
-                                 if((((u32UpdateOptionMask & UPDATE_ENTITY_REFERENCE) != 0U) ||
-                                    ((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) != 0U)) &&
-                                    ((u32UpdateOptionMask & DONT_DEREF_AS_GENERAL_ENTITY) != DONT_DEREF_AS_GENERAL_ENTITY))
+                                 else if((u32UpdateOptionMask & UPDATE_PARAMETER_REFERENCE) == 0U)
                                  {
-                                     pu8EntityValue       = (INT8U const *)"&";
-                                     u32EntityValueLength = 1U;
-                                     if(pstrParserInstanceType->u8FoundReference < MAX_FOUND_REFERENCE)
-                                     {
-                                         pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].objenumReferenceTypeType = csCharacterEntityReference;
-                                         pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].u8EntityIndex = 0U;
-                                         pstrParserInstanceType->u8FoundReference++;
-                                     }
-                                     else
-                                     {
-                                         /*
-                                          * Nothing to do
-                                          */
-                                     }
+                                     objenumErrorType = csInvalidReference;
+                                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid Character Reference");
                                  }
                                  else
                                  {
-                                     pu8TempString++; /* escape semicolomn */
+                                     /*
+                                      * Nothing to do
+                                      */
                                  }
                              }
-                             else if(strncmp((INT8S const *)&pu8AmpersandDelimiter[1U], cs8SingleQuoteCharEntity, u32EntityNameLength) == 0)
-                             {
-                                 if(((u32UpdateOptionMask & UPDATE_ENTITY_REFERENCE) != 0U) || \
-                                    ((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) != 0U))
-                                 {
-                                     pu8EntityValue       = (INT8U const *)"'";
-                                     u32EntityValueLength = 1U;
-                                     if(pstrParserInstanceType->u8FoundReference < MAX_FOUND_REFERENCE)
-                                     {
-                                         pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].objenumReferenceTypeType = csCharacterEntityReference;
-                                         pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].u8EntityIndex = 0U;
-                                         pstrParserInstanceType->u8FoundReference++;
-                                     }
-                                     else
-                                     {
-                                         /*
-                                          * Nothing to do
-                                          */
-                                     }
-                                 }
-                                 else
-                                 {
-                                     pu8TempString++; /* escape semicolomn */
-                                 }
+                             else
+                             {/* inside the entity value the general entity references are kept as they are */
+                                 /*
+                                  * Nothing to do
+                                  */
                              }
-                             else if(strncmp((INT8S const *)&pu8AmpersandDelimiter[1U], cs8DoubleQuoteCharEntity, u32EntityNameLength) == 0)
+                         }
+                         else if((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) == 0U)
+                         {
+                             (void)memset(u8UTF8Code, 0, sizeof(u8UTF8Code));
+                             u8UTF8CodeLength = LwXMLP_u8ConvertCodePointToUTF8(u32FinalUniCode, u8UTF8Code);
+                             if(u8UTF8CodeLength == 0U)
                              {
-                                 if((((u32UpdateOptionMask & UPDATE_ENTITY_REFERENCE) != 0U)||
-                                    ((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) != 0U)))
-                                 {
-                                     pu8EntityValue       = (INT8U const *)"\"";
-                                     u32EntityValueLength = 1U;
-                                     if(pstrParserInstanceType->u8FoundReference < MAX_FOUND_REFERENCE)
-                                     {
-                                         pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].objenumReferenceTypeType = csCharacterEntityReference;
-                                         pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].u8EntityIndex = 0U;
-                                         pstrParserInstanceType->u8FoundReference++;
-                                     }
-                                     else
-                                     {
-                                         /*
-                                          * Nothing to do
-                                          */
-                                     }
-                                 }
-                                 else
-                                 {
-                                     pu8TempString++; /* escape semicolomn */
-                                 }
+                                 objenumErrorType = csInvalidReference;
+                                 LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid Character Reference");
                              }
-                             else if(((u32UpdateOptionMask & UPDATE_ENTITY_REFERENCE) != 0U) || \
-                                     ((u32UpdateOptionMask & UPDATE_PARAMETER_REFERENCE) != 0U))
+                             else if(LwXMLP_u8ValidCharacter(u8UTF8Code) == 0U)
                              {
-                                 for(u8EntityIndex = 0; u8EntityIndex < pstrParserInstanceType->u8AvaliableEntities; ++u8EntityIndex)
-                                 {
-                                     if(strncmp((INT8S const *)&pu8AmpersandDelimiter[1U], \
-                                                (INT8S const *)pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityName, \
-                                                 u32EntityNameLength) == 0)
-                                     {
-                                         if(u32EntityNameLength == pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityNameLength)
-                                         {
-                                             if(((pstrParserInstanceType->objstrEntityType[u8EntityIndex].objenumReferenceTypeType == csEntityReference) &&
-                                                 ((u32UpdateOptionMask & UPDATE_ENTITY_REFERENCE) != 0U)) ||
-                                                 ((pstrParserInstanceType->objstrEntityType[u8EntityIndex].objenumReferenceTypeType == csParamterEntity) &&
-                                                 ((u32UpdateOptionMask & UPDATE_PARAMETER_REFERENCE) != 0U)))
-                                             {
-                                                 u32EntityValueLength   = pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityValueLength;
-                                                 pu8EntityValue         = pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityValue;
-                                                 objenumReferenceTypeType = csMixedContent;
-                                                 break;
-                                             }
-                                             else
-                                             {
-                                                 /*
-                                                  * Nothing to do
-                                                  */
-                                             }
-                                         }
-                                         else
-                                         {
-                                             /*
-                                              * Nothing to do
-                                              */
-                                         }
-                                     }
-                                     else
-                                     {
-                                         /*
-                                          * Nothing to do
-                                          */
-                                     }
-                                 }
-                                 /* if we reach the end without finding reference */
-                                 if(u8EntityIndex == pstrParserInstanceType->u8AvaliableEntities)
-                                 {
-                                     if((u32UpdateOptionMask & UPDATE_PARAMETER_REFERENCE) != 0U)
-                                     {
-
-                                     }
-                                     else
-                                     {
-                                         objenumErrorType = csInvalidReference;
-                                     }
-                                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid Character Reference");
-                                 }
-                                 else
-                                 {
-                                     if(pstrParserInstanceType->u8FoundReference < MAX_FOUND_REFERENCE)
-                                     {
-                                         pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].objenumReferenceTypeType = \
-                                                 pstrParserInstanceType->objstrEntityType[u8EntityIndex].objenumReferenceTypeType;
-                                         pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].u8EntityIndex = \
-                                                 u8EntityIndex;
-                                         pstrParserInstanceType->u8FoundReference++;
-                                     }
-                                     else
-                                     {
-                                         /*
-                                          * Nothing to do
-                                          */
-                                     }
-                                 }
+                                 objenumErrorType = csInvalidXMLCharacter;
+                                 LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid XML character");
                              }
                              else
                              {
-                                 pu8TempString++; /* escape semicolomn */
+                                 pu8Replacement       = u8UTF8Code;
+                                 u32ReplacementLength = u8UTF8CodeLength;
+                                 LwXMLP_vRecordFoundReference(pstrParserInstanceType, csCharacterReference, 0U);
                              }
-                             if((objenumErrorType == csNoError) && (pu8EntityValue != STD_NULL) && ((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) == 0U))
+                         }
+                         else
+                         {
+                             /*
+                              * Nothing to do
+                              */
+                         }
+                         if(objenumErrorType != csNoError)
+                         {
+                             /*
+                              * Nothing to do
+                              */
+                         }
+                         else if((s16EntityIndex >= 0) && ((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) == 0U))
+                         {/* scan the entity value in its place, its own references are replaced on the way */
+                             for(u8SourceIndex = 0U; u8SourceIndex < u8SourceDepth; ++u8SourceIndex)
                              {
-                                 if(objenumReferenceTypeType == csUnkownEntity)
+                                 if(objstrIncludingSourceType[u8SourceIndex].s16EntityIndex == s16EntityIndex)
                                  {
-                                     objenumReferenceTypeType = csPredefinedCharacterEntity;
+                                     objenumErrorType = csEntityRefereToItself;
                                  }
                                  else
                                  {
@@ -4046,217 +7541,313 @@ static LwXMLP_enumErrorType LwXMLP_enumUpdateEntityReference(LwXMLP_strXMLParseI
                                       * Nothing to do
                                       */
                                  }
-                                 u32EntityNameLength += 2U; /* Add the & ; */
-                                 if(u32EntityNameLength >=  u32EntityValueLength)
-                                 {
-                                     LwXMLP_vMoveBlockLeft(&pu8AmpersandDelimiter[u32EntityValueLength], \
-                                                             u32EntityNameLength - u32EntityValueLength,\
-                                                             u32MaxBlockLength - u32CheckedLength);
-                                 }
-                                 else
-                                 {
-                                     if(((u32MaxBlockLength - u32CheckedLength)< u32MaxBlockLength) &&
-                                         ((u32CheckedLength + (u32EntityValueLength - u32EntityNameLength)) < u32MaxBlockLength))
-                                     {
-                                         LwXMLP_vMoveBlockRight(&pu8AmpersandDelimiter[u32EntityNameLength],\
-                                                                u32EntityValueLength - u32EntityNameLength,\
-                                                                u32MaxBlockLength - u32CheckedLength);
-                                     }
-                                     else
-                                     {
-                                         objenumErrorType = csInternalError;
-                                     }
-                                 }
-                                 pu8TempString = &pu8AmpersandDelimiter[u32EntityValueLength]; /*Adjust the pointer to the new string */
-                                 memcpy(pu8AmpersandDelimiter, pu8EntityValue, u32EntityValueLength);
                              }
-                             else
+                             if(objenumErrorType != csNoError)
                              {
                                  /*
                                   * Nothing to do
                                   */
                              }
-                         }
-                         else
-                         {
-                             if((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) == 0U)
+                             else if(u8SourceDepth >= pstrParserInstanceType->u8MaxExpansionDepth)
                              {
-                                 u8UTF8CodeLength = LwXMLP_u8ConvertCodePointToUTF8(u32FinalUniCode, pu8AmpersandDelimiter);
-                                 if(u8UTF8CodeLength > 0U)
-                                 {
-                                     if(LwXMLP_u8ValidCharacter(pu8AmpersandDelimiter) > 0U)
-                                     {
-                                         u32MoveLength = u32EntityNameLength - u8UTF8CodeLength;
-                                         if(((u32MaxBlockLength - u32CheckedLength)< u32MaxBlockLength) &&
-                                             (u32MoveLength < u32MaxBlockLength))
-                                         {
-                                             LwXMLP_vMoveBlockLeft(&pu8AmpersandDelimiter[u8UTF8CodeLength], \
-                                                                    u32MoveLength,\
-                                                                    u32MaxBlockLength - u32CheckedLength);
-                                             pu8TempString = &pu8AmpersandDelimiter[u8UTF8CodeLength]; /*Adjust the pointer to the new string */
-                                             if(pstrParserInstanceType->u8FoundReference < MAX_FOUND_REFERENCE)
-                                             {
-                                                 pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].objenumReferenceTypeType = csCharacterReference;
-                                                 pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].u8EntityIndex            = 0U;
-                                                 pstrParserInstanceType->u8FoundReference++;
-                                             }
-                                             else
-                                             {
-                                                 /*
-                                                  * Nothing to do
-                                                  */
-                                             }
-                                         }
-                                         else
-                                         {
-                                             objenumErrorType = csInternalError;
-                                         }
-                                     }
-                                     else
-                                     {
-                                         objenumErrorType = csInvalidXMLCharacter;
-                                         LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid XML character");
-                                     }
+                                 objenumErrorType = csLargeResolvingTrialsProperty;
+                             }
+                             else if((pstrReferenceExpansionType->pu8Output == STD_NULL) && \
+                                     (LwXMLP_bChargeExpansion(pstrParserInstanceType, \
+                                                              pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[s16EntityIndex].u32EntityValueLength, \
+                                                              pstrReferenceExpansionType->pu32ProbedLength) == STD_FALSE))
+                             {/* the reference is charged once while the expansion is measured, not while it is written */
+                                 objenumErrorType = csEntityExpansionBudgetExceeded;
+                             }
+                             else if(((u32UpdateOptionMask & VALIDATE_REPLACEMENT_TEXT) != 0U) && \
+                                     (pstrReferenceExpansionType->pu8Output == STD_NULL) && \
+                                     (LwXMLP_bValidateData(pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[s16EntityIndex].pu8EntityValue, \
+                                                           pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[s16EntityIndex].u32EntityValueLength) == STD_FALSE))
+                             {/* the replacement text is checked once while the expansion is measured */
+                                 objenumErrorType = csInvalidXMLCharacter;
+                             }
+                             else
+                             {
+                                 if(u8SourceDepth == 0U)
+                                 {/* the input cursor stays after the reference while its value is scanned */
+                                     pstrReferenceExpansionType->u32InputLength = (INT32U)(pu8Read - pstrReferenceExpansionType->pu8Input);
                                  }
                                  else
                                  {
-                                     objenumErrorType = csInvalidReference;
-                                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid Character Reference");
+                                     /*
+                                      * Nothing to do
+                                      */
                                  }
+                                 objstrIncludingSourceType[u8SourceDepth].pu8ResumeAddress = pu8Read;
+                                 objstrIncludingSourceType[u8SourceDepth].s16EntityIndex   = s16EntityIndex;
+                                 u8SourceDepth++;
+                                 pu8Read = pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[s16EntityIndex].pu8EntityValue;
+                                 pstrReferenceExpansionType->u16ReplacedReferences++;
                              }
-                             else
-                             {
-                                 /*
-                                  * Nothing to do
-                                  */
-                             }
+                         }
+                         else if((pu8Replacement != STD_NULL) && ((u32UpdateOptionMask & REFERENCE_VALIDATEION_ONLY) == 0U))
+                         {
+                             LwXMLP_vWriteExpansion(pstrReferenceExpansionType, \
+                                                    pu8Replacement, \
+                                                    u32ReplacementLength, \
+                                                    pu8Read, \
+                                                    u8SourceDepth);
+                             pstrReferenceExpansionType->u16ReplacedReferences++;
+                         }
+                         else
+                         {/* the reference is kept as it is */
+                             LwXMLP_vWriteExpansion(pstrReferenceExpansionType, \
+                                                    pu8ReferenceStart, \
+                                                    u32ReferenceLength, \
+                                                    pu8Read, \
+                                                    u8SourceDepth);
                          }
                          objenumEntityUpdateStateType = csCheckAmpersandDelimiterState;
-                         u32CheckedLength++;
                      }
-                     else
+                     else if(*pu8Read == NULL_ASCII_CHARACTER) /* we reach the end without semicolon */
                      {
-                         objenumErrorType = csInvalidReference;
-                         LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid Character Reference");
+                         objenumErrorType = csMissingSemicolon;
                      }
-                 }
-                 else
-                 {/* update the code per character for the hex and decimal type */
-                     if(objenumReferenceTypeType == csHexCharcterReference)
-                     {
-                         if((*pu8TempString >= ZERO_ASCII_CHARACTER) && (*pu8TempString <= NINE_ASCII_CHARACTER))
-                         {
-                             u32TempUniCode = (INT32U)(*pu8TempString) - ZERO_ASCII_CHARACTER;
-                         }
-                         else if((*pu8TempString >= A_SMALL_ASCII_CHARACTER) && (*pu8TempString <= F_SMALL_ASCII_CHARACTER))
-                         {
-                              u32TempUniCode = ((INT32U)(*pu8TempString) - A_SMALL_ASCII_CHARACTER) + 10U;
-                         }
-                         else if((*pu8TempString >= A_CAPITAL_ASCII_CHARACTER) && (*pu8TempString <= F_CAPITAL_ASCII_CHARACTER))
-                         {
-                             u32TempUniCode = ((INT32U)(*pu8TempString) - A_CAPITAL_ASCII_CHARACTER) + 10U;
-                         }
-                         else
+                     else
+                     {/* update the code per character for the hex and decimal type */
+                         if(objenumReferenceTypeType == csHexCharcterReference)
                          {
-                             if((INT8U)(*pu8TempString) == NULL_ASCII_CHARACTER) /* we reach the end without semicolon */
+                             if((*pu8Read >= ZERO_ASCII_CHARACTER) && (*pu8Read <= NINE_ASCII_CHARACTER))
+                             {
+                                 u32TempUniCode = (INT32U)(*pu8Read) - ZERO_ASCII_CHARACTER;
+                             }
+                             else if((*pu8Read >= A_SMALL_ASCII_CHARACTER) && (*pu8Read <= F_SMALL_ASCII_CHARACTER))
                              {
-                                 objenumErrorType = csMissingSemicolon;
+                                 u32TempUniCode = ((INT32U)(*pu8Read) - A_SMALL_ASCII_CHARACTER) + 10U;
+                             }
+                             else if((*pu8Read >= A_CAPITAL_ASCII_CHARACTER) && (*pu8Read <= F_CAPITAL_ASCII_CHARACTER))
+                             {
+                                 u32TempUniCode = ((INT32U)(*pu8Read) - A_CAPITAL_ASCII_CHARACTER) + 10U;
                              }
                              else
                              {
                                  objenumErrorType = csInvalidReference;
                                  LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid Character Reference");
                              }
-                         }
-                         if(objenumErrorType == csNoError)
-                         {/* check for 32bit integer overflow */
-                             if(u32FinalUniCode <= (u32FinalUniCode * 16U))
-                             {
-                                 u32FinalUniCode *= 16U;
-                                 u32FinalUniCode += u32TempUniCode;
+                             if(objenumErrorType == csNoError)
+                             {/* check for 32bit integer overflow */
+                                 if(u32FinalUniCode <= (u32FinalUniCode * 16U))
+                                 {
+                                     u32FinalUniCode *= 16U;
+                                     u32FinalUniCode += u32TempUniCode;
+                                 }
+                                 else
+                                 {
+                                     objenumErrorType = csInvalidReference;
+                                 }
                              }
                              else
                              {
-                                 objenumErrorType = csInvalidReference;
+                                 /* nothing to do */
                              }
                          }
-                         else
-                         {
-                             /* nothing to do */
-                         }
-                     }
-                     else if(objenumReferenceTypeType == csDecimalCharcterReference)
-                     {
-                         if(((INT8U)(*pu8TempString) >= ZERO_ASCII_CHARACTER) && \
-                             ((INT8U)(*pu8TempString) <= NINE_ASCII_CHARACTER))
-                         {
-                             u32TempUniCode = (INT32U)(*pu8TempString) - ZERO_ASCII_CHARACTER;
-                         }
-                         else
+                         else if(objenumReferenceTypeType == csDecimalCharcterReference)
                          {
-                             if((INT8U)(*pu8TempString) == NULL_ASCII_CHARACTER) /* we reach the end without semicolon */
+                             if((*pu8Read >= ZERO_ASCII_CHARACTER) && (*pu8Read <= NINE_ASCII_CHARACTER))
                              {
-                                 objenumErrorType = csMissingSemicolon;
+                                 u32TempUniCode = (INT32U)(*pu8Read) - ZERO_ASCII_CHARACTER;
                              }
                              else
                              {
                                  objenumErrorType = csInvalidReference;
                                  LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid Character Reference");
                              }
-                         }
-                         if(objenumErrorType == csNoError)
-                         {/* check for 32bit integer overflow */
-                             if(u32FinalUniCode <= (u32FinalUniCode * 10U))
-                             {
-                                 u32FinalUniCode *= 10U;
-                                 u32FinalUniCode += u32TempUniCode;
+                             if(objenumErrorType == csNoError)
+                             {/* check for 32bit integer overflow */
+                                 if(u32FinalUniCode <= (u32FinalUniCode * 10U))
+                                 {
+                                     u32FinalUniCode *= 10U;
+                                     u32FinalUniCode += u32TempUniCode;
+                                 }
+                                 else
+                                 {
+                                     objenumErrorType = csInvalidReference;
+                                 }
                              }
                              else
                              {
-                                 objenumErrorType = csInvalidReference;
+                                 /* nothing to do */
                              }
                          }
+                         else
+                         {
+                             /*
+                              * Nothing to do
+                              */
+                         }
+                         pu8Read++;
                      }
-                     else
-                     {
-                         /*
-                          * Nothing to do
-                          */
-                     }
-                     pu8TempString++;
-                     u32CheckedLength++;
-                     u32EntityNameLength++;
-                 }
-                 break;
-            default:
-                 /*
-                  * Shouldn't be here
-                  */
-                 break;
+                     break;
+                default:
+                     /*
+                      * Shouldn't be here
+                      */
+                     break;
+            }
         }
-    }while((objenumErrorType == csNoError) && \
-           (u32CheckedLength <= u32StringLength) &&\
-           (bStopChecking == STD_FALSE));
-    /* check the propose final state */
-    if(objenumErrorType == csNoError)
+    }while((objenumErrorType == csNoError) && (bExpansionIsDone == STD_FALSE));
+    if((objenumErrorType != csNoError) && (u8SourceDepth == 0U))
+    {/* the input is left unchanged from the start of the wrong reference */
+        pstrReferenceExpansionType->u32InputLength = (INT32U)(pu8ReferenceStart - pstrReferenceExpansionType->pu8Input);
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+
+    return objenumErrorType;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vWriteExpansion                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vWriteExpansion(strReferenceExpansionType       *pstrReferenceExpansionType, \
+                                            INT8U                     const *pu8Bytes, \
+                                            INT32U                           u32BytesLength, \
+                                            INT8U                     const *pu8InputCursor, \
+                                            INT8U                            u8SourceDepth)
+
+DESCRIPTION :   Write bytes to the output cursor of the expansion and keep the largest distance which the output went
+                ahead of the input, while the expansion is only measured the bytes are checked for markup
+
+PARAMETER1  :   pstrReferenceExpansionType : the input and the output of the expansion
+PARAMETER2  :   pu8Bytes                   : the bytes which are written
+PARAMETER3  :   u32BytesLength             : the number of the bytes
+PARAMETER4  :   pu8InputCursor             : the next byte to be read from the current source
+PARAMETER5  :   u8SourceDepth              : zero if the current source is the input, otherwise it is an entity value
+                                             and the input cursor stays after the reference which includes it
+
+RETURN VALUE:   None
+
+Note        :
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vWriteExpansion(strReferenceExpansionType       *pstrReferenceExpansionType, \
+                                   INT8U                     const *pu8Bytes, \
+                                   INT32U                           u32BytesLength, \
+                                   INT8U                     const *pu8InputCursor, \
+                                   INT8U                            u8SourceDepth)
+{
+    if(u8SourceDepth == 0U)
+    {
+        pstrReferenceExpansionType->u32InputLength = (INT32U)(pu8InputCursor - pstrReferenceExpansionType->pu8Input);
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    if(pstrReferenceExpansionType->pu8Output != STD_NULL)
+    {/* the output may overlap the input which isn't read yet only if the bytes are the same */
+        (void)memmove(&pstrReferenceExpansionType->pu8Output[pstrReferenceExpansionType->u32OutputLength], \
+                      pu8Bytes, \
+                      u32BytesLength);
+    }
+    else if(memchr(pu8Bytes, LESS_THAN_ASCII_CHARACTER, u32BytesLength) != STD_NULL)
+    {
+        pstrReferenceExpansionType->bMarkupIsFound = STD_TRUE;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    pstrReferenceExpansionType->u32OutputLength += u32BytesLength;
+    if(pstrReferenceExpansionType->u32OutputLength > \
+       (pstrReferenceExpansionType->u32InputLength + pstrReferenceExpansionType->u32LargestGrowth))
+    {
+        pstrReferenceExpansionType->u32LargestGrowth = pstrReferenceExpansionType->u32OutputLength - \
+                                                       pstrReferenceExpansionType->u32InputLength;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_u8FindPredefinedEntity                                        <LwXMLP_CORE>
+
+SYNTAX:         INT8U LwXMLP_u8FindPredefinedEntity(INT8S const * const *ps8PredefinedEntityName, \
+                                                    INT8U         const *pu8EntityName, \
+                                                    INT32U               u32EntityNameLength)
+
+DESCRIPTION :   Search for the entity name between the predefined entities (lt, gt, amp, apos and quot)
+
+PARAMETER1  :   ps8PredefinedEntityName : the names of the predefined entities
+PARAMETER2  :   pu8EntityName           : the entity name, it isn't NULL terminated
+PARAMETER3  :   u32EntityNameLength     : the length of the entity name
+
+RETURN VALUE:   the index of the predefined entity or PREDEFINED_ENTITIES_COUNT if it isn't predefined
+
+Note        :
+END DESCRIPTION *******************************************************************************************************/
+static INT8U LwXMLP_u8FindPredefinedEntity(INT8S const * const *ps8PredefinedEntityName, \
+                                           INT8U         const *pu8EntityName, \
+                                           INT32U               u32EntityNameLength)
+{
+    INT8U u8EntityIndex;
+
+    for(u8EntityIndex = 0U; u8EntityIndex < PREDEFINED_ENTITIES_COUNT; ++u8EntityIndex)
     {
-        switch(objenumEntityUpdateStateType)
+        if((strlen(ps8PredefinedEntityName[u8EntityIndex]) == u32EntityNameLength) && \
+           (strncmp((INT8S const *)pu8EntityName, ps8PredefinedEntityName[u8EntityIndex], u32EntityNameLength) == 0))
         {
-            case csCheckSemicolonDelimiterState:
-                 objenumErrorType = csMissingSemicolon;
-                 break;
-            case csCheckAmpersandDelimiterState:
-            default:
-                 /*
-                  * Nothing to do
-                  */
-                 break;
+            break;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
         }
     }
 
-    return objenumErrorType;
+    return u8EntityIndex;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vRecordFoundReference                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vRecordFoundReference(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                  LwXMLP_enumReferenceTypeType    objenumReferenceTypeType, \
+                                                  INT16U                          u16EntityIndex)
+
+DESCRIPTION :   Record the found reference if there is a room for it
+
+PARAMETER1  :   pstrParserInstanceType   : pointer to the XML instance
+PARAMETER2  :   objenumReferenceTypeType : the type of the found reference
+PARAMETER3  :   u16EntityIndex           : the index of the entity or zero if it isn't an entity
+
+RETURN VALUE:   None
+
+Note        :
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vRecordFoundReference(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                         LwXMLP_enumReferenceTypeType    objenumReferenceTypeType, \
+                                         INT16U                          u16EntityIndex)
+{
+    if(pstrParserInstanceType->u8FoundReference < MAX_FOUND_REFERENCE)
+    {
+        pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].objenumReferenceTypeType = objenumReferenceTypeType;
+        pstrParserInstanceType->objstrFoundReferenceType[pstrParserInstanceType->u8FoundReference].u16EntityIndex = u16EntityIndex;
+        pstrParserInstanceType->u8FoundReference++;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
 }
-static BOOLEAN LwXMLP_bValideEntity(INT8U* pu8Entity)
+static BOOLEAN LwXMLP_bValideEntity(INT8U const *pu8Entity)
 {
     typedef enum
     {
@@ -4269,7 +7860,7 @@ static BOOLEAN LwXMLP_bValideEntity(INT8U* pu8Entity)
         csCheckDone
     }enumValidEntityStateType;
     BOOLEAN  bValideEntity = STD_TRUE;
-    INT8U   *pu8ValidatedEntity = pu8Entity;
+    INT8U const *pu8ValidatedEntity = pu8Entity;
     INT32U   u32CharacterLength = 0U, u32EntityLength = 0U;
     enumValidEntityStateType objenumValidEntityStateType = csCheckAmperSand;
 
@@ -4393,12 +7984,326 @@ static BOOLEAN LwXMLP_bValideEntity(INT8U* pu8Entity)
                   */
                  break;
         }
-        pu8ValidatedEntity = &pu8ValidatedEntity[u32CharacterLength];
+        pu8ValidatedEntity = &pu8ValidatedEntity[u32CharacterLength];
+    }
+    while((objenumValidEntityStateType != csCheckDone) && (bValideEntity == STD_TRUE));
+    if(u32EntityLength == 0U)
+    {/* Invalid entity length */
+        bValideEntity = STD_FALSE;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+
+    return bValideEntity;
+}
+/*
+ * shouldn't larger than 4 byte sequence, such that the W3C dosn't allow for more than 4 byte sequence UTF-8
+ */
+static INT8U LwXMLP_u8ConvertCodePointToUTF8(INT32U u32CodePoint, INT8U *pu8UTF8Code)
+{
+    INT8U         u8CodeLength;
+
+    if(u32CodePoint < 0x80U)    /* 1 byte sequence */
+    {
+        pu8UTF8Code[0U] = (INT8U) (u32CodePoint);
+        u8CodeLength   = 1U;
+        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, \
+                        "UTF-8 codes for 0x%x are =: 0x%x ", \
+                        u32CodePoint, \
+                        pu8UTF8Code[0U]);
+    }
+#if(SUPPORT_ASCII_ONLY == STD_OFF)
+    else if(u32CodePoint < 0x800U)  /* 2 byte sequence */
+    {
+        pu8UTF8Code[1U] = (INT8U) ((u32CodePoint | 0x80U) & 0xBFU);
+        u32CodePoint        >>= 6U;
+        pu8UTF8Code[0U] = (INT8U) (u32CodePoint | 0xC0U);
+        u8CodeLength   = 2U;
+        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "UTF-8 codes for 0x%x are =: 0x%x 0x%x",\
+                        u32CodePoint,\
+                        pu8UTF8Code[0U],\
+                        pu8UTF8Code[1U]);
+
+    }
+    else if(u32CodePoint < 0x10000U)    /* 3 byte sequence */
+    {
+        pu8UTF8Code[2U] = (INT8U) ((u32CodePoint | 0x80U) & 0xBFU);
+        u32CodePoint        >>= 6U;
+        pu8UTF8Code[1U] = (INT8U) ((u32CodePoint | 0x80U) & 0xBFU);
+        u32CodePoint        >>= 6U;
+        pu8UTF8Code[0U] = (INT8U) (u32CodePoint | 0xE0U);
+        u8CodeLength   = 3;
+        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "UTF-8 codes for 0x%x are =: 0x%x 0x%x 0x%x",\
+                        u32CodePoint,\
+                        pu8UTF8Code[0U],\
+                        pu8UTF8Code[1U],\
+                        pu8UTF8Code[2U]);
+    }
+    else if(u32CodePoint < 0x200000U)   /* 4 byte sequence */
+    {
+        pu8UTF8Code[3] = (INT8U) ((u32CodePoint | 0x80U) & 0xBFU);
+        u32CodePoint        >>= 6U;
+        pu8UTF8Code[2] = (INT8U) ((u32CodePoint | 0x80U) & 0xBFU);
+        u32CodePoint        >>= 6U;
+        pu8UTF8Code[1U] = (INT8U) ((u32CodePoint | 0x80U) & 0xBFU);
+        u32CodePoint        >>= 6U;
+        pu8UTF8Code[0] = (INT8U) (u32CodePoint | 0xF0U);
+        u8CodeLength   = 4U;
+        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "UTF-8 codes for 0x%x are =: 0x%x 0x%x 0x%x 0x%x",\
+                        u32CodePoint,\
+                        pu8UTF8Code[0U],\
+                        pu8UTF8Code[1U],\
+                        pu8UTF8Code[2U],\
+                        pu8UTF8Code[3U]);
+    }
+#endif
+    else
+    {
+        u8CodeLength = 0U;
+    }
+
+    return u8CodeLength;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_s16FindMarkupReference                                        <LwXMLP_CORE>
+
+SYNTAX:         INT16S LwXMLP_s16FindMarkupReference(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                     INT8U                    const *pu8Text, \
+                                                     INT32U                         *pu32ReferenceOffset, \
+                                                     INT32U                         *pu32ReferenceNumber)
+
+DESCRIPTION :   Look for the first general entity reference in the text which its replacement text contains markup,
+                the replacement text of every reference is measured in the entity arena without being written, the
+                nested references are only checked against the rest of the budget, they are charged by the expansion
+                or the parsing which follows
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   pu8Text                : the text with NULL terminator which its references are checked
+PARAMETER3  :   pu32ReferenceOffset    : it is set to the offset of the found reference in the text
+PARAMETER4  :   pu32ReferenceNumber    : it is set to the number of the references which are before the found one
+
+RETURN VALUE:   the index of the entity of the found reference, or -1 if no replacement text contains markup
+
+Note        :   the error of the measuring is set to pstrParserInstanceType->objenumErrorType
+END DESCRIPTION *******************************************************************************************************/
+static INT16S LwXMLP_s16FindMarkupReference(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                            INT8U                    const *pu8Text, \
+                                            INT32U                         *pu32ReferenceOffset, \
+                                            INT32U                         *pu32ReferenceNumber)
+{
+    strReferenceExpansionType objstrReferenceExpansionType;
+    INT8U               const *pu8Reference, *pu8ReferenceEnd;
+    INT32U                     u32EntitySlot, u32ReferenceNumber = 0U, u32ProbedLength = 0U;
+    INT16S                     s16EntityIndex, s16MarkupEntityIndex = -1;
+
+    pu8Reference = (INT8U const *)strchr((INT8S const *)pu8Text, AMPERSAND_ASCII_CHARACTER);
+    while((pu8Reference != STD_NULL) && (s16MarkupEntityIndex < 0) && \
+          (pstrParserInstanceType->objenumErrorType == csNoError))
+    {
+        pu8ReferenceEnd = (INT8U const *)strchr((INT8S const *)pu8Reference, SEMICOLON_ASCII_CHARACTER);
+        if(pu8ReferenceEnd == STD_NULL)
+        {/* the missing semicolon is reported by the expansion */
+            pu8Reference = STD_NULL;
+        }
+        else
+        {
+            if(pu8Reference[1U] != HASH_ASCII_CHARACTER)
+            {
+                s16EntityIndex = LwXMLP_s16FindEntity(pstrParserInstanceType, \
+                                                      &pu8Reference[1U], \
+                                                      (INT32U)(pu8ReferenceEnd - &pu8Reference[1U]), \
+                                                      csEntityReference, \
+                                                      &u32EntitySlot);
+                if((s16EntityIndex >= 0) && \
+                   (pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[s16EntityIndex].objenumEntityStoreTypeType != csExternalStorage))
+                {
+                    objstrReferenceExpansionType.pu8Input         = pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[s16EntityIndex].pu8EntityValue;
+                    objstrReferenceExpansionType.pu8Output        = STD_NULL;
+                    objstrReferenceExpansionType.pu32ProbedLength = &u32ProbedLength;
+                    pstrParserInstanceType->objenumErrorType = LwXMLP_enumExpandReferences(pstrParserInstanceType, \
+                                                                                           &objstrReferenceExpansionType, \
+                                                                                           UPDATE_ENTITY_REFERENCE | \
+                                                                                           DONT_DEREF_LT_GENERAL_ENTITY | \
+                                                                                           DONT_DEREF_AS_GENERAL_ENTITY);
+                    if(objstrReferenceExpansionType.bMarkupIsFound == STD_TRUE)
+                    {
+                        s16MarkupEntityIndex = s16EntityIndex;
+                        *pu32ReferenceOffset = (INT32U)(pu8Reference - pu8Text);
+                        *pu32ReferenceNumber = u32ReferenceNumber;
+                    }
+                    else
+                    {
+                        /*
+                         * Nothing to do
+                         */
+                    }
+                }
+                else
+                {
+                    /*
+                     * Nothing to do
+                     */
+                }
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+            u32ReferenceNumber++;
+            pu8Reference = (INT8U const *)strchr((INT8S const *)&pu8Reference[1U], AMPERSAND_ASCII_CHARACTER);
+        }
+    }
+
+    return s16MarkupEntityIndex;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_u32GetReferenceEnd                                        <LwXMLP_CORE>
+
+SYNTAX:         INT32U LwXMLP_u32GetReferenceEnd(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                 INT32U                                u32ReferenceNumber)
+
+DESCRIPTION :   Count the ready characters till the end of a reference, the references are counted instead of the
+                characters because the loaded text may be shorter than the ready one after the end of lines
+                normalization
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   u32ReferenceNumber     : the number of the references which are before the required one
+
+RETURN VALUE:   the number of the ready characters including the semicolon of the reference
+
+Note        :
+END DESCRIPTION *******************************************************************************************************/
+static INT32U LwXMLP_u32GetReferenceEnd(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                        INT32U                                u32ReferenceNumber)
+{
+    INT8U  const *pu8Character;
+    INT32U        u32Offset = 0U, u32FoundReferences = 0U, u32ReadyAmount;
+    BOOLEAN       bReferenceEndIsFound = STD_FALSE;
+
+    u32ReadyAmount = LwXMLP_u32GetReadyData(pstrParserInstanceType);
+    while((u32Offset < u32ReadyAmount) && (bReferenceEndIsFound == STD_FALSE))
+    {
+        pu8Character = LwXMLP_pu8GetReadyCharacter(pstrParserInstanceType, u32Offset);
+        if(*pu8Character == AMPERSAND_ASCII_CHARACTER)
+        {
+            u32FoundReferences++;
+        }
+        else if((*pu8Character == SEMICOLON_ASCII_CHARACTER) && (u32FoundReferences > u32ReferenceNumber))
+        {
+            bReferenceEndIsFound = STD_TRUE;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+        u32Offset++;
     }
-    while((objenumValidEntityStateType != csCheckDone) && (bValideEntity == STD_TRUE));
-    if(u32EntityLength == 0U)
-    {/* Invalid entity length */
-        bValideEntity = STD_FALSE;
+
+    return u32Offset;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vPushInputSource                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vPushInputSource(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                             INT16S                          s16EntityIndex, \
+                                             BOOLEAN                         bSilentMode, \
+                                             BOOLEAN                         bValueIsReplayed)
+
+DESCRIPTION :   Continue the parsing from the value of the entity in its place in the entity arena, the state of the
+                current source is kept in objstrInputSourceType and the value is seen by the parser as the ready
+                characters of the circular buffer, so the consuming of the characters isn't aware of the source
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   s16EntityIndex         : the entity which its value is parsed
+PARAMETER3  :   bSilentMode            : STD_TRUE if the value is parsed only to be validated without firing events
+PARAMETER4  :   bValueIsReplayed       : STD_TRUE if the value is parsed again after it is validated silently, the
+                                         value and the references inside it are already charged to the budget
+
+RETURN VALUE:   None
+
+Note        :   the error (csEntityRefereToItself) is set if the entity value is already parsed, and the error
+                (csLargeResolvingTrialsProperty) is set if the maximum number of the nested values are under parsing,
+                and the error (csEntityExpansionBudgetExceeded) is set if the value can't be charged to the budget
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vPushInputSource(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                    INT16S                          s16EntityIndex, \
+                                    BOOLEAN                         bSilentMode, \
+                                    BOOLEAN                         bValueIsReplayed)
+{
+    strInputSourceType  *pstrInputSourceType;
+    strEntityType const *pstrEntityType = &pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[s16EntityIndex];
+    INT8U                u8SourceIndex;
+
+    for(u8SourceIndex = 0U; u8SourceIndex < pstrParserInstanceType->u8InputSourceDepth; ++u8SourceIndex)
+    {
+        if(pstrParserInstanceType->objstrInputSourceType[u8SourceIndex].s16EntityIndex == s16EntityIndex)
+        {
+            pstrParserInstanceType->objenumErrorType = csEntityRefereToItself;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+    }
+    if(pstrParserInstanceType->objenumErrorType != csNoError)
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    else if(pstrParserInstanceType->u8InputSourceDepth >= pstrParserInstanceType->u8MaxExpansionDepth)
+    {
+        pstrParserInstanceType->objenumErrorType = csLargeResolvingTrialsProperty;
+    }
+    else if(pstrEntityType->u32EntityValueLength > MAX_CIRCULAR_BUFFER_SIZE)
+    {
+        pstrParserInstanceType->objenumErrorType = csLargeDatalength;
+    }
+    else if((bValueIsReplayed == STD_FALSE) && \
+            (LwXMLP_bChargeExpansion(pstrParserInstanceType, pstrEntityType->u32EntityValueLength, STD_NULL) == STD_FALSE))
+    {
+        pstrParserInstanceType->objenumErrorType = csEntityExpansionBudgetExceeded;
+    }
+    else if(pstrEntityType->u32EntityValueLength > 0U)
+    {
+        pstrInputSourceType = &pstrParserInstanceType->objstrInputSourceType[pstrParserInstanceType->u8InputSourceDepth];
+        pstrInputSourceType->pu8ResumeLocation        = pstrParserInstanceType->pu8LastParserLocation;
+        pstrInputSourceType->pu8ResumeBufferEnd       = pstrParserInstanceType->pu8CircularBufferEnd;
+        pstrInputSourceType->u32ResumeFreeLocations   = pstrParserInstanceType->u32FreeLocations;
+        pstrInputSourceType->u32ResumeParsedLength    = pstrParserInstanceType->u32ParsedLength;
+        pstrInputSourceType->u32ResumeLineNumber      = pstrParserInstanceType->u32LineNumber;
+        pstrInputSourceType->u32ResumeCoulmnNumber    = pstrParserInstanceType->u32CoulmnNumber;
+        pstrInputSourceType->u32ResumeReferenceLine   = pstrParserInstanceType->u32LastReferenceLine;
+        pstrInputSourceType->u32ResumeReferenceColumn = pstrParserInstanceType->u32LastReferenceColumn;
+        pstrInputSourceType->u32BaseDepth             = pstrParserInstanceType->u32ElementDepth;
+        pstrInputSourceType->s16EntityIndex           = s16EntityIndex;
+        pstrInputSourceType->bResumeSilentMode        = pstrParserInstanceType->bParserSilentModeIsEnabled;
+        pstrInputSourceType->bValueIsReplayed         = bValueIsReplayed;
+        pstrParserInstanceType->u8InputSourceDepth++;
+        /* the value is parsed in its place, the free locations are counted as if it fills the circular buffer */
+        pstrParserInstanceType->pu8LastParserLocation = pstrEntityType->pu8EntityValue;
+        pstrParserInstanceType->pu8CircularBufferEnd  = &pstrEntityType->pu8EntityValue[pstrEntityType->u32EntityValueLength];
+        pstrParserInstanceType->u32FreeLocations      = MAX_CIRCULAR_BUFFER_SIZE - pstrEntityType->u32EntityValueLength;
+        if(bSilentMode == STD_TRUE)
+        {
+            pstrParserInstanceType->bParserSilentModeIsEnabled = STD_TRUE;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
     }
     else
     {
@@ -4406,199 +8311,376 @@ static BOOLEAN LwXMLP_bValideEntity(INT8U* pu8Entity)
          * Nothing to do
          */
     }
-
-    return bValideEntity;
 }
-static void LwXMLP_vMoveBlockRight(INT8U* pu8StringBlockAddress, INT32U u32MoveLength, INT32U u32BlockLength)
-{
-    INT32U u32ByteIndex;
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vPopInputSource                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vPopInputSource(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   Resume the parsing of the source which includes the entity value which its last character is consumed,
+                it is called by the engine after the event of the last characters is reported such that the silent
+                mode of the value is still applied on that event
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+
+RETURN VALUE:   None
 
-    for(u32ByteIndex = u32BlockLength; u32ByteIndex > 0U; --u32ByteIndex)
+Note        :   the error (csParsedEntityError) is set if the elements which are opened inside the entity value aren't
+                closed inside it
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vPopInputSource(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+{
+    strInputSourceType const *pstrInputSourceType;
+
+    pstrParserInstanceType->u8InputSourceDepth--;
+    pstrInputSourceType = &pstrParserInstanceType->objstrInputSourceType[pstrParserInstanceType->u8InputSourceDepth];
+    pstrParserInstanceType->pu8LastParserLocation      = pstrInputSourceType->pu8ResumeLocation;
+    pstrParserInstanceType->pu8CircularBufferEnd       = pstrInputSourceType->pu8ResumeBufferEnd;
+    pstrParserInstanceType->u32FreeLocations           = pstrInputSourceType->u32ResumeFreeLocations;
+    pstrParserInstanceType->u32ParsedLength            = pstrInputSourceType->u32ResumeParsedLength;
+    pstrParserInstanceType->u32LineNumber              = pstrInputSourceType->u32ResumeLineNumber;
+    pstrParserInstanceType->u32CoulmnNumber            = pstrInputSourceType->u32ResumeCoulmnNumber;
+    pstrParserInstanceType->u32LastReferenceLine       = pstrInputSourceType->u32ResumeReferenceLine;
+    pstrParserInstanceType->u32LastReferenceColumn     = pstrInputSourceType->u32ResumeReferenceColumn;
+    pstrParserInstanceType->bParserSilentModeIsEnabled = pstrInputSourceType->bResumeSilentMode;
+    if(pstrParserInstanceType->u32ElementDepth != pstrInputSourceType->u32BaseDepth)
+    {
+        pstrParserInstanceType->objenumErrorType = csParsedEntityError;
+    }
+    else
     {
-        pu8StringBlockAddress[u32ByteIndex + u32MoveLength - 1U] = pu8StringBlockAddress[u32ByteIndex - 1U];
+        /*
+         * Nothing to do
+         */
     }
-    pu8StringBlockAddress[u32MoveLength + u32BlockLength] = NULL_ASCII_CHARACTER;
 }
-static void LwXMLP_vMoveBlockLeft(INT8U* pu8StringBlockAddress, INT32U u32MoveLength, INT32U u32BlockLength)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_bChargeExpansion                                        <LwXMLP_CORE>
+
+SYNTAX:         BOOLEAN LwXMLP_bChargeExpansion(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                INT32U                          u32ExpansionLength, \
+                                                INT32U                         *pu32ProbedLength)
+
+DESCRIPTION :   Charge the length of an entity value to the expansion budget of the instance before the value is
+                scanned, so the scanning of the entity values is bounded by the budget and the size of the received
+                document, the charge costs the same whatever the length of the value is
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   u32ExpansionLength     : the length of the entity value which will be scanned
+PARAMETER3  :   pu32ProbedLength       : the length which is probed before, or STD_NULL if the value is charged, a
+                                         probed value is only checked against the rest of the budget and added to
+                                         the probed length because it is charged again by the scanning which follows
+
+RETURN VALUE:   STD_TRUE if the value can be scanned, STD_FALSE if the budget or the ratio is exceeded
+
+Note        :   u32ExpandedBytes never exceeds u32MaxExpandedBytes, so once the budget is consumed every later charge
+                fails without being counted, and nothing is charged while a replayed value is parsed because its
+                references are charged while it is validated silently
+END DESCRIPTION *******************************************************************************************************/
+static BOOLEAN LwXMLP_bChargeExpansion(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                       INT32U                          u32ExpansionLength, \
+                                       INT32U                         *pu32ProbedLength)
 {
-    INT32U u32ByteIndex;
+    BOOLEAN bExpansionIsCharged = STD_FALSE, bValueIsReplayed = STD_FALSE;
+    INT32U  u32ProbedLength = 0U, u32ExpandedBytes;
+    INT8U   u8SourceIndex;
 
-    for(u32ByteIndex = 0U; u32ByteIndex < u32BlockLength; ++u32ByteIndex)
+    for(u8SourceIndex = 0U; u8SourceIndex < pstrParserInstanceType->u8InputSourceDepth; ++u8SourceIndex)
     {
-        pu8StringBlockAddress[u32ByteIndex] = pu8StringBlockAddress[u32ByteIndex + u32MoveLength];
+        if(pstrParserInstanceType->objstrInputSourceType[u8SourceIndex].bValueIsReplayed == STD_TRUE)
+        {
+            bValueIsReplayed = STD_TRUE;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+    }
+    if(pu32ProbedLength != STD_NULL)
+    {
+        u32ProbedLength = *pu32ProbedLength;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    if(bValueIsReplayed == STD_TRUE)
+    {
+        bExpansionIsCharged = STD_TRUE;
+    }
+    else if(u32ExpansionLength <= ((pstrParserInstanceType->u32MaxExpandedBytes - pstrParserInstanceType->u32ExpandedBytes) - \
+                                   u32ProbedLength))
+    {
+        u32ExpandedBytes = pstrParserInstanceType->u32ExpandedBytes + u32ProbedLength + u32ExpansionLength;
+        if(pu32ProbedLength != STD_NULL)
+        {
+            *pu32ProbedLength = u32ProbedLength + u32ExpansionLength;
+        }
+        else
+        {
+            pstrParserInstanceType->u32ExpandedBytes = u32ExpandedBytes;
+            pstrParserInstanceType->u32ExpandedReferences++;
+        }
+        if((pstrParserInstanceType->u32MaxExpansionRatio == 0U) || \
+           (u32ExpandedBytes <= ENTITY_EXPANSION_RATIO_THRESHOLD) || \
+           ((u32ExpandedBytes / pstrParserInstanceType->u32MaxExpansionRatio) <= \
+            pstrParserInstanceType->u32ReceivedBytes))
+        {
+            bExpansionIsCharged = STD_TRUE;
+        }
+        else
+        {
+            LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "The entity expansion ratio is exceeded");
+        }
+    }
+    else
+    {
+        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "The entity expansion budget is exceeded");
     }
+
+    return bExpansionIsCharged;
 }
-/*
- * shouldn't larger than 4 byte sequence, such that the W3C dosn't allow for more than 4 byte sequence UTF-8
- */
-static INT8U LwXMLP_u8ConvertCodePointToUTF8(INT32U u32CodePoint, INT8U *pu8UTF8Code)
-{
-    INT8U         u8CodeLength;
+#endif
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_srLoadTagToBuffer                                        <LwXMLP_CORE>
 
-    if(u32CodePoint < 0x80U)    /* 1 byte sequence */
+SYNTAX:         StdReturnType LwXMLP_srLoadTagToBuffer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   This API is doing the following by two steps:
+                Step1 : load the TAG into the working buffer
+                Step2 : If the TAG is complete, it will be parsed to get the Name, Attributes, so on
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance and if end of the TAG/TAG Closer is found the
+                                         pstrParserInstanceType->bTagCloserIsFound will be set to STD_TRUE
+
+RETURN VALUE:   E_NOT_OK: if the loading for the TAG into the working buffer is failed or parsing error is occured
+                E_OK    : if the loading for the TAG into the working buffer is succeeded
+
+Note
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vLoadTagToBuffer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+{
+    /* Look for the TAG closure while the loaded characters are tokenized */
+    LwXMLP_vCheckTagCloserAndType(pstrParserInstanceType);
+    /* if complete TAG is found, finish the tokenizing and the checking of the TAG */
+    if(pstrParserInstanceType->bTagCloserIsFound == STD_TRUE)
     {
-        pu8UTF8Code[0U] = (INT8U) (u32CodePoint);
-        u8CodeLength   = 1U;
-        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, \
-                        "UTF-8 codes for 0x%x are =: 0x%x ", \
-                        u32CodePoint, \
-                        pu8UTF8Code[0U]);
+        if(pstrParserInstanceType->objenumErrorType == csNoError)
+        {
+            LwXMLP_vProcesssTag(pstrParserInstanceType);
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+        LwXMLP_vResetTagScanner(pstrParserInstanceType);
     }
-#if(SUPPORT_ASCII_ONLY == STD_OFF)
-    else if(u32CodePoint < 0x800U)  /* 2 byte sequence */
+    else
     {
-        pu8UTF8Code[1U] = (INT8U) ((u32CodePoint | 0x80U) & 0xBFU);
-        u32CodePoint        >>= 6U;
-        pu8UTF8Code[0U] = (INT8U) (u32CodePoint | 0xC0U);
-        u8CodeLength   = 2U;
-        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "UTF-8 codes for 0x%x are =: 0x%x 0x%x",\
-                        u32CodePoint,\
-                        pu8UTF8Code[0U],\
-                        pu8UTF8Code[1U]);
+        /*
+         * Nothing to do
+         */
+    }
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_srProcesssTag                                        <LwXMLP_CORE>
+
+SYNTAX:         StdReturnType LwXMLP_srProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   This API is doing the following:
+                - Tokenize the last characters of the TAG which were kept behind the closer scanning.
+                - Report the first error found by the tokenizer.
+                - Check that the TAG doesn't end in the middle of an attribute.
+                - Normalize the TAG attributes in case of the start and empty TAG
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance and if end of the TAG/TAG Closer is found the
+                                         pstrParserInstanceType->bTagCloserIsFound will be set to STD_TRUE
+
+RETURN VALUE:   E_NOT_OK: if the loading for the TAG into the working buffer is failed
+                E_OK    : if the loading for the TAG into the working buffer is succeeded
+
+Note        :   the API will fail to load the buffer in the following cases:
+                - Detect invalid start Name character in the TAG, , and the error (csInvalidStartNameCharacter) will be set.
+                - Detect invalid Name character in the TAG, , and the error (csInvalidNameCharacter) will be set.
+                - The = is missing between the attribute name and the attribute value,
+                  and the error (csMissingEqual) will be set.
+                - an attribute value is missing quote" , and the error (csMissingQuote) will be set.
+                - The quotes on both ends of an attribute value must match , and the error
+                  (csQuotesMissmatch) will be set.
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+{
+    INT32U             u32ContentEnd;
+    strTagScannerType *pstrTagScannerType;
 
+    pstrTagScannerType = &pstrParserInstanceType->objstrTagScannerType;
+    /* the content of the TAG ends before > and before the / of the empty TAG */
+    u32ContentEnd = pstrParserInstanceType->u32CurrentTagLength - 1U;
+    if(pstrParserInstanceType->objenumTagTypeType == csEmptyTagType)
+    {
+        u32ContentEnd--;/* remove the / length */
     }
-    else if(u32CodePoint < 0x10000U)    /* 3 byte sequence */
+    else
     {
-        pu8UTF8Code[2U] = (INT8U) ((u32CodePoint | 0x80U) & 0xBFU);
-        u32CodePoint        >>= 6U;
-        pu8UTF8Code[1U] = (INT8U) ((u32CodePoint | 0x80U) & 0xBFU);
-        u32CodePoint        >>= 6U;
-        pu8UTF8Code[0U] = (INT8U) (u32CodePoint | 0xE0U);
-        u8CodeLength   = 3;
-        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "UTF-8 codes for 0x%x are =: 0x%x 0x%x 0x%x",\
-                        u32CodePoint,\
-                        pu8UTF8Code[0U],\
-                        pu8UTF8Code[1U],\
-                        pu8UTF8Code[2U]);
+        /*
+         * Nothing to do
+         */
     }
-    else if(u32CodePoint < 0x200000U)   /* 4 byte sequence */
+    LwXMLP_vTokenizeTag(pstrParserInstanceType, u32ContentEnd);
+    pstrParserInstanceType->objenumErrorType = pstrTagScannerType->objenumTagErrorType;
+#if((ENABLE_IN_PLACE_TOKENIZATION == STD_ON) && (ENABLE_ENTITY_SUPPORT == STD_ON))
+    if((pstrParserInstanceType->pu8TagBuffer != pstrParserInstanceType->u8XMLworkingBuffer) && \
+       (memchr(pstrParserInstanceType->pu8TagBuffer, AMPERSAND_ASCII_CHARACTER, pstrParserInstanceType->u32CurrentTagLength) != STD_NULL))
+    {/* the replaced references may be longer than themselves, so they can't be replaced in the circular buffer */
+        LwXMLP_vRelocateTag(pstrParserInstanceType, pstrParserInstanceType->u32CurrentTagLength);
+    }
+    else
     {
-        pu8UTF8Code[3] = (INT8U) ((u32CodePoint | 0x80U) & 0xBFU);
-        u32CodePoint        >>= 6U;
-        pu8UTF8Code[2] = (INT8U) ((u32CodePoint | 0x80U) & 0xBFU);
-        u32CodePoint        >>= 6U;
-        pu8UTF8Code[1U] = (INT8U) ((u32CodePoint | 0x80U) & 0xBFU);
-        u32CodePoint        >>= 6U;
-        pu8UTF8Code[0] = (INT8U) (u32CodePoint | 0xF0U);
-        u8CodeLength   = 4U;
-        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "UTF-8 codes for 0x%x are =: 0x%x 0x%x 0x%x 0x%x",\
-                        u32CodePoint,\
-                        pu8UTF8Code[0U],\
-                        pu8UTF8Code[1U],\
-                        pu8UTF8Code[2U],\
-                        pu8UTF8Code[3U]);
+        /*
+         * Nothing to do
+         */
     }
 #endif
-    else
+    /* validation part, such that the state machine shall terminate on specific states, otherwise, it shall be error */
+    if(pstrParserInstanceType->objenumErrorType == csNoError)
     {
-        u8CodeLength = 0U;
+        switch(pstrTagScannerType->objenumCheckTagStateType)
+        {
+            case csCheckAttributeName:
+            case csCheckEquality:
+                 pstrParserInstanceType->objenumErrorType = csMissingAttributeValue;
+                 LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "an attribute value is missing");
+                 break;
+            case csCheckAttributeValueStartQuot:
+            case csCheckAttributeValueEndQuot:
+                 pstrParserInstanceType->objenumErrorType = csMissingQuote;
+                 LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "an attribute value is missing its quote");
+                 break;
+            case csCheckTAGNameStart:
+            case csCheckTAGName:
+            case csCheckAttributeNameStart:
+                 /* valid exit states */
+            default:
+                 /*
+                  * Nothing to do
+                  */
+                 break;
+        }
     }
-
-    return u8CodeLength;
-}
-static void LwXMLP_vSwitchToSecondLevelBuffer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, INT8U const *pu8PortionBuffer, INT32U u32PortionLength)
-{
-    pstrParserInstanceType->u32SecondLevelReadyAmount = u32PortionLength;
-    memcpy(pstrParserInstanceType->u8SecondLevelBuffer, \
-           pu8PortionBuffer, \
-           u32PortionLength);
-    pstrParserInstanceType->u8SecondLevelBuffer[pstrParserInstanceType->u32SecondLevelReadyAmount] = NULL_ASCII_CHARACTER;
-    pstrParserInstanceType->pu8SavedLastParserLocation  = pstrParserInstanceType->pu8LastParserLocation;
-    pstrParserInstanceType->pu8LastParserLocation       = &pstrParserInstanceType->u8SecondLevelBuffer[0];
-    pstrParserInstanceType->pu8SavedCircularBufferEnd   = pstrParserInstanceType->pu8CircularBufferEnd;
-    pstrParserInstanceType->pu8CircularBufferEnd        = &pstrParserInstanceType->u8SecondLevelBuffer[pstrParserInstanceType->u32SecondLevelReadyAmount];
-    pstrParserInstanceType->u8SecondLevelPathBuffer[0]  = 0U;
-    pstrParserInstanceType->u32SecondLevelPathLength    = 0U;
-    pstrParserInstanceType->bSecondLevelBufferEnabled   = STD_TRUE;
-}
+    if(pstrParserInstanceType->objenumErrorType == csNoError)
+    {
+         if(pstrParserInstanceType->s16AttributeCounts > 0)
+         {
+#if(ENABLE_ATTRIBUTE_Normalization == STD_ON)
+             LwXMLP_vNormalizeAttributes(pstrParserInstanceType);
 #endif
-/* START FUNCTION DESCRIPTION ******************************************************************************************
-LwXMLP_srLoadTagToBuffer                                        <LwXMLP_CORE>
-
-SYNTAX:         StdReturnType LwXMLP_srLoadTagToBuffer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
-
-DESCRIPTION :   This API is doing the following by two steps:
-                Step1 : load the TAG into the working buffer
-                Step2 : If the TAG is complete, it will be parsed to get the Name, Attributes, so on
-
-PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance and if end of the TAG/TAG Closer is found the
-                                         pstrParserInstanceType->bTagCloserIsFound will be set to STD_TRUE
-
-RETURN VALUE:   E_NOT_OK: if the loading for the TAG into the working buffer is failed or parsing error is occured
-                E_OK    : if the loading for the TAG into the working buffer is succeeded
-
-Note
-END DESCRIPTION *******************************************************************************************************/
-static void LwXMLP_vLoadTagToBuffer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
-{
-    /* First round is to check the TAG closure and TAG type */
-    LwXMLP_vCheckTagCloserAndType(pstrParserInstanceType);
-    /* second round, if complete TAG is found, copy it to the working buffer */
-    if((pstrParserInstanceType->bTagCloserIsFound == STD_TRUE) && (pstrParserInstanceType->objenumErrorType == csNoError))
+         }
+         else
+         {
+             /* String termination if there were not a white space at the end of the element */
+             pstrParserInstanceType->pu8TagBuffer[pstrTagScannerType->u32TokenOffset] = NULL_ASCII_CHARACTER;
+         }
+#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
+         if(pstrParserInstanceType->objenumTagTypeType != csEndTagType)
+         {
+             LwXMLP_vAddDefaultAttributes(pstrParserInstanceType);
+         }
+         else
+         {
+             /*
+              * Nothing to do
+              */
+         }
+#endif
+    }
+    else
     {
-        LwXMLP_vProcesssTag(pstrParserInstanceType);
+        /*
+         * Nothing to do
+         */
     }
 }
 /* START FUNCTION DESCRIPTION ******************************************************************************************
-LwXMLP_srProcesssTag                                        <LwXMLP_CORE>
+LwXMLP_vTokenizeTag                                        <LwXMLP_CORE>
 
-SYNTAX:         StdReturnType LwXMLP_srProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+SYNTAX:         void LwXMLP_vTokenizeTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, INT32U u32TokenLimit)
 
-DESCRIPTION :   This API is doing the following:
-                - Extract the TAG name and size.
+DESCRIPTION :   This API tokenizes the TAG characters which are loaded into the TAG buffer up to u32TokenLimit,
+                resuming from the state saved by the previous call, it is doing the following:
+                - Extract the TAG name.
                 - Validate the TAG characters.
                 - Extract the TAG attributes in case of the start and empty TAG
 
-PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance and if end of the TAG/TAG Closer is found the
-                                         pstrParserInstanceType->bTagCloserIsFound will be set to STD_TRUE
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
 
-RETURN VALUE:   E_NOT_OK: if the loading for the TAG into the working buffer is failed
-                E_OK    : if the loading for the TAG into the working buffer is succeeded
+PARAMETER2  :   u32TokenLimit          : the TAG buffer index which the tokenizing shall stop before it
 
-Note        :   the API will fail to load the buffer in the following cases:
+RETURN VALUE:   None
+
+Note        :   the first error is saved in objenumTagErrorType of the TAG scanner and the tokenizing is stopped,
+                the error is reported by LwXMLP_vProcesssTag when the TAG is complete:
                 - Detect invalid start Name character in the TAG, , and the error (csInvalidStartNameCharacter) will be set.
                 - Detect invalid Name character in the TAG, , and the error (csInvalidNameCharacter) will be set.
                 - The = is missing between the attribute name and the attribute value,
                   and the error (csMissingEqual) will be set.
                 - an attribute value is missing quote" , and the error (csMissingQuote) will be set.
-                - The quotes on both ends of an attribute value must match , and the error
-                  (csQuotesMissmatch) will be set.
 END DESCRIPTION *******************************************************************************************************/
-static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+static void LwXMLP_vTokenizeTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, INT32U u32TokenLimit)
 {
-    typedef enum
-    {
-        csCheckTAGNameStart,\
-        csCheckTAGName,\
-        csCheckAttributeNameStart, \
-        csCheckAttributeName,\
-        csCheckEquality,\
-        csCheckAttributeValueStartQuot,\
-        csCheckAttributeValueEndQuot
-    }enumCheckTagStateType;
     /* bEnableWightSpaceChecking, needed to check the white space between attributes but not before the first one */
     BOOLEAN               bEnableWhiteSpaceChecking;
-    INT8U                *pu8WorkingBuffer, u8AttributeEndCharacter = SPACE_ASCII_CHARACTER;
-    INT32U                u32CheckingDataAmount, u32BufferIndex, u32CharacterLength = 0U;
+    INT8U                *pu8WorkingBuffer, u8AttributeEndCharacter;
+    INT32U                u32BufferIndex, u32CharacterLength = 0U;
     enumCheckTagStateType objenumCheckTagStateType;
-
-    objenumCheckTagStateType  = csCheckTAGNameStart;
-    bEnableWhiteSpaceChecking = STD_FALSE;
-    u32CheckingDataAmount = strlen((INT8S const*)pstrParserInstanceType->u8XMLworkingBuffer);
-    pu8WorkingBuffer      = pstrParserInstanceType->u8XMLworkingBuffer;
-    pstrParserInstanceType->s16AttributeCounts = 0;
-    /* escape <  */
-    pu8WorkingBuffer++;
-    u32CheckingDataAmount -= 2U;/* remove the < > length */
-    if(pstrParserInstanceType->objenumTagTypeType == csEndTagType)
-    {
-        /* escape \  */
-        pu8WorkingBuffer++;
-        u32CheckingDataAmount--;/* remove the \ length */
+    LwXMLP_enumErrorType  objenumTagErrorType;
+    strTagScannerType    *pstrTagScannerType;
+
+    pstrTagScannerType        = &pstrParserInstanceType->objstrTagScannerType;
+    objenumCheckTagStateType  = pstrTagScannerType->objenumCheckTagStateType;
+    objenumTagErrorType       = pstrTagScannerType->objenumTagErrorType;
+    bEnableWhiteSpaceChecking = pstrTagScannerType->bEnableWhiteSpaceChecking;
+    u8AttributeEndCharacter   = pstrTagScannerType->u8AttributeEndCharacter;
+    pu8WorkingBuffer          = pstrParserInstanceType->pu8TagBuffer;
+    u32BufferIndex            = pstrTagScannerType->u32TokenOffset;
+    if((u32BufferIndex == 0U) && (u32TokenLimit > 0U))
+    {
+        pstrParserInstanceType->s16AttributeCounts = 0;
+        /* escape <  */
+        u32BufferIndex = 1U;
+        if(pu8WorkingBuffer[u32BufferIndex] == SLASH_ASCII_CHARACTER)
+        {
+            /* escape \  */
+            pstrTagScannerType->bEndTag = STD_TRUE;
+            u32BufferIndex++;
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
     }
-    else  if(pstrParserInstanceType->objenumTagTypeType == csEmptyTagType)
+    else
     {
-        u32CheckingDataAmount--;/* remove the \ length */
+        /*
+         * Nothing to do
+         */
+    }
+#if(ENABLE_IN_PLACE_TOKENIZATION == STD_ON)
+    if((pu8WorkingBuffer != pstrParserInstanceType->u8XMLworkingBuffer) && \
+       (u32TokenLimit > pstrParserInstanceType->u32TagCountedLength))
+    {/* the terminators overwrite the white spaces in the circular buffer, so the line feeds are counted before */
+        LwXMLP_vUpdateLineAndColumn(&pstrParserInstanceType->u32TagLineNumber, \
+                                    &pstrParserInstanceType->u32TagCoulmnNumber, \
+                                    &pu8WorkingBuffer[pstrParserInstanceType->u32TagCountedLength], \
+                                    u32TokenLimit - pstrParserInstanceType->u32TagCountedLength);
+        pstrParserInstanceType->u32TagCountedLength = u32TokenLimit;
     }
     else
     {
@@ -4606,8 +8688,9 @@ static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstan
          * Nothing to do
          */
     }
-    for(u32BufferIndex = 0U; \
-       (u32BufferIndex < u32CheckingDataAmount) && (pstrParserInstanceType->objenumErrorType == csNoError);\
+#endif
+    for(; \
+       (u32BufferIndex < u32TokenLimit) && (objenumTagErrorType == csNoError);\
        u32BufferIndex += u32CharacterLength)
     {
         switch(objenumCheckTagStateType)
@@ -4616,13 +8699,18 @@ static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstan
                  u32CharacterLength = LwXMLP_u8ValidNameStartCharacter(&pu8WorkingBuffer[u32BufferIndex]);
                  if(u32CharacterLength > 0U)
                  {
-                     pstrParserInstanceType->pu8ElementName     = &pu8WorkingBuffer[u32BufferIndex];
-                     pstrParserInstanceType->s16AttributeCounts = 0;
-                     objenumCheckTagStateType                   = csCheckTAGName;
+                     pstrParserInstanceType->pu8ElementName       = &pu8WorkingBuffer[u32BufferIndex];
+                     pstrParserInstanceType->s16AttributeCounts   = 0;
+                     /* the name is hashed and measured while it is tokenized */
+                     pstrParserInstanceType->u32ElementNameHash   = LwXMLP_u32HashBytes(NAME_HASH_OFFSET_BASIS, \
+                                                                                        &pu8WorkingBuffer[u32BufferIndex], \
+                                                                                        u32CharacterLength);
+                     pstrParserInstanceType->u32ElementNameLength = u32CharacterLength;
+                     objenumCheckTagStateType                     = csCheckTAGName;
                  }
                  else
                  {
-                      pstrParserInstanceType->objenumErrorType = csInvalidStartNameCharacter;
+                      objenumTagErrorType = csInvalidStartNameCharacter;
                       LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid Start Name character");
                  }
                  break;
@@ -4639,13 +8727,14 @@ static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstan
                      u32CharacterLength = LwXMLP_u8ValidNameCharacter(&pu8WorkingBuffer[u32BufferIndex]);
                      if(u32CharacterLength > 0U)
                      {
-                         /*
-                          * Nothing to do
-                          */
+                         pstrParserInstanceType->u32ElementNameHash    = LwXMLP_u32HashBytes(pstrParserInstanceType->u32ElementNameHash, \
+                                                                                             &pu8WorkingBuffer[u32BufferIndex], \
+                                                                                             u32CharacterLength);
+                         pstrParserInstanceType->u32ElementNameLength += u32CharacterLength;
                      }
                      else /* Invalid Name character */
                      {
-                         pstrParserInstanceType->objenumErrorType = csInvalidNameCharacter;
+                         objenumTagErrorType = csInvalidNameCharacter;
                          LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid Start Name character");
                      }
 
@@ -4661,7 +8750,7 @@ static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstan
                      }
                      else
                       {
-                         pstrParserInstanceType->objenumErrorType = csMissingWhiteSpaceCharacter;
+                         objenumTagErrorType = csMissingWhiteSpaceCharacter;
                           LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Missing white Space");
                      }
                  }/* Will ignore the white spaces between the element name and the attribute name */
@@ -4674,20 +8763,25 @@ static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstan
                      u32CharacterLength = LwXMLP_u8ValidNameStartCharacter(&pu8WorkingBuffer[u32BufferIndex]);
                      if(u32CharacterLength > 0U)
                      {
-                         if(pstrParserInstanceType->objenumTagTypeType != csEndTagType)
+                         if(pstrTagScannerType->bEndTag == STD_FALSE)
                          {
                              pstrParserInstanceType->pu8AttributeNameArray[pstrParserInstanceType->s16AttributeCounts] = \
                                      &pu8WorkingBuffer[u32BufferIndex];
+                             /* the name is hashed while it is tokenized */
+                             pstrParserInstanceType->u32AttributeHashArray[pstrParserInstanceType->s16AttributeCounts] = \
+                                     LwXMLP_u32HashBytes(NAME_HASH_OFFSET_BASIS, &pu8WorkingBuffer[u32BufferIndex], u32CharacterLength);
+                             pstrParserInstanceType->u32AttributeNameLengthArray[pstrParserInstanceType->s16AttributeCounts] = \
+                                     u32CharacterLength;
                              objenumCheckTagStateType  = csCheckAttributeName;
                          }
                          else
                          {
-                             pstrParserInstanceType->objenumErrorType = csAttributeInEndTag;
+                             objenumTagErrorType = csAttributeInEndTag;
                          }
                      }
                      else
                      {
-                         pstrParserInstanceType->objenumErrorType = csInvalidStartNameCharacter;
+                         objenumTagErrorType = csInvalidStartNameCharacter;
                          LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid Start Name character");
                      }
                  }
@@ -4712,13 +8806,16 @@ static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstan
                      u32CharacterLength = LwXMLP_u8ValidNameCharacter(&pu8WorkingBuffer[u32BufferIndex]);
                      if(u32CharacterLength > 0U)
                      {
-                         /*
-                          * Nothing to do
-                          */
+                         pstrParserInstanceType->u32AttributeHashArray[pstrParserInstanceType->s16AttributeCounts] = \
+                                 LwXMLP_u32HashBytes(pstrParserInstanceType->u32AttributeHashArray[pstrParserInstanceType->s16AttributeCounts], \
+                                                     &pu8WorkingBuffer[u32BufferIndex], \
+                                                     u32CharacterLength);
+                         pstrParserInstanceType->u32AttributeNameLengthArray[pstrParserInstanceType->s16AttributeCounts] += \
+                                 u32CharacterLength;
                      }
                      else/* Invalid Name character */
                      {
-                         pstrParserInstanceType->objenumErrorType = csInvalidNameCharacter;
+                         objenumTagErrorType = csInvalidNameCharacter;
                          LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid Start Name character");
                      }
 
@@ -4738,7 +8835,7 @@ static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstan
                  }
                  else
                  {
-                     pstrParserInstanceType->objenumErrorType = csMissingEqual;
+                     objenumTagErrorType = csMissingEqual;
                      LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, \
                                        "The = is missing between the attribute name and the attribute value");
                  }
@@ -4761,7 +8858,7 @@ static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstan
                  }
                  else
                  {
-                     pstrParserInstanceType->objenumErrorType = csMissingQuote;
+                     objenumTagErrorType = csMissingQuote;
                      LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Missing quote");
                  }
                  break;
@@ -4770,15 +8867,16 @@ static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstan
                  {
                      u32CharacterLength = 1U; /* update character length */
                      pu8WorkingBuffer[u32BufferIndex] = NULL_ASCII_CHARACTER;
-                     if(LwXMLP_bNewAttribute(pstrParserInstanceType, \
-                        pstrParserInstanceType->pu8AttributeNameArray[pstrParserInstanceType->s16AttributeCounts]) \
-                             == STD_TRUE)
+                     pstrParserInstanceType->u32AttributeValueLengthArray[pstrParserInstanceType->s16AttributeCounts] = \
+                             (INT32U)(&pu8WorkingBuffer[u32BufferIndex] - \
+                                      pstrParserInstanceType->pu8AttributeValueArray[pstrParserInstanceType->s16AttributeCounts]);
+                     if(LwXMLP_bNewAttribute(pstrParserInstanceType) == STD_TRUE)
                      {
                          LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, \
                                          "Found attribute name: %s value: %s", \
                                          pstrParserInstanceType->pu8AttributeNameArray[pstrParserInstanceType->s16AttributeCounts],\
                                          pstrParserInstanceType->pu8AttributeValueArray[pstrParserInstanceType->s16AttributeCounts]);
-                         if(pstrParserInstanceType->objenumErrorType == csNoError)
+                         if(objenumTagErrorType == csNoError)
                          {
                              bEnableWhiteSpaceChecking = STD_TRUE;
                              pstrParserInstanceType->s16AttributeCounts++;
@@ -4788,7 +8886,7 @@ static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstan
                              }
                              else
                              {
-                                 pstrParserInstanceType->objenumErrorType = csLargeNumberOfAttributes;
+                                 objenumTagErrorType = csLargeNumberOfAttributes;
                              }
                          }
                          else
@@ -4800,21 +8898,21 @@ static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstan
                      }
                      else
                      {
-                         pstrParserInstanceType->objenumErrorType = csRepeatedAttributeName;
+                         objenumTagErrorType = csRepeatedAttributeName;
                          LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, \
                                          "Repeated attribute Name");
                      }
                  }
                  else if(pu8WorkingBuffer[u32BufferIndex] == LESS_THAN_ASCII_CHARACTER)
                  {
-                     pstrParserInstanceType->objenumErrorType = csInvalidAttributeValue;
+                     objenumTagErrorType = csInvalidAttributeValue;
                  }
                  else
                  {
                      u32CharacterLength = LwXMLP_u8ValidCharacter(&pu8WorkingBuffer[u32BufferIndex]);
                      if(u32CharacterLength == 0U)
                      {
-                         pstrParserInstanceType->objenumErrorType = csInvalidXMLCharacter;
+                         objenumTagErrorType = csInvalidXMLCharacter;
                          LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid XML character");
                      }
                      else/* valid Name character */
@@ -4832,53 +8930,11 @@ static void LwXMLP_vProcesssTag(LwXMLP_strXMLParseInstanceType *pstrParserInstan
                  break;
         }
     }
-    /* validation part, such that the state machine shall terminate on specific states, otherwise, it shall be error */
-    if(pstrParserInstanceType->objenumErrorType == csNoError)
-    {
-        switch(objenumCheckTagStateType)
-        {
-            case csCheckAttributeName:
-            case csCheckEquality:
-                 pstrParserInstanceType->objenumErrorType = csMissingAttributeValue;
-                 LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "an attribute value is missing");
-                 break;
-            case csCheckAttributeValueStartQuot:
-            case csCheckAttributeValueEndQuot:
-                 pstrParserInstanceType->objenumErrorType = csMissingQuote;
-                 LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "an attribute value is missing its quote");
-                 break;
-            case csCheckTAGNameStart:
-            case csCheckTAGName:
-            case csCheckAttributeNameStart:
-                 /* valid exit states */
-            default:
-                 /*
-                  * Nothing to do
-                  */
-                 break;
-        }
-    }
-    if(pstrParserInstanceType->objenumErrorType == csNoError)
-    {
-         if(pstrParserInstanceType->s16AttributeCounts > 0)
-         {
-#if(ENABLE_ATTRIBUTE_Normalization == STD_ON)
-             LwXMLP_vNormalizeAttributes(pstrParserInstanceType);
-#endif
-         }
-         else
-         {
-             /* String termination if there were not a white space at the end of the element */
-             pu8WorkingBuffer[u32BufferIndex] = NULL_ASCII_CHARACTER;
-         }
-    }
-    else
-    {
-        /*
-         * Nothing to do
-         */
-    }
-
+    pstrTagScannerType->u32TokenOffset            = u32BufferIndex;
+    pstrTagScannerType->objenumCheckTagStateType  = objenumCheckTagStateType;
+    pstrTagScannerType->objenumTagErrorType       = objenumTagErrorType;
+    pstrTagScannerType->bEnableWhiteSpaceChecking = bEnableWhiteSpaceChecking;
+    pstrTagScannerType->u8AttributeEndCharacter   = u8AttributeEndCharacter;
 }
 /* START FUNCTION DESCRIPTION ******************************************************************************************
 LwXMLP_srCheckTagCloserAndType                                        <LwXMLP_CORE>
@@ -4888,7 +8944,7 @@ SYNTAX:         StdReturnType LwXMLP_srCheckTagCloserAndType(LwXMLP_strXMLParseI
 DESCRIPTION :   This API is doing the following:
                 - Check if the TAG Closer is available
                 - Check the TAG type, Is it start, end or empty TAG
-                - Copy TAG into the working buffer
+                - Copy TAG into the working buffer, unless it is tokenized in its place in the circular buffer
                 - Consume TAG
 
 PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance and if end of the TAG/TAG Closer is found the
@@ -4903,23 +8959,60 @@ Note        :   the API will fail to load the buffer in the following cases:
 END DESCRIPTION *******************************************************************************************************/
 static void LwXMLP_vCheckTagCloserAndType(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 {
-    BOOLEAN               bQuotIsFound      = STD_FALSE;
-    INT8U                 u8LastCharacter   = SPACE_ASCII_CHARACTER; /* avoid to be being used without init */
-    INT8U                 u8SecondCharacter = SPACE_ASCII_CHARACTER;/* avoid to be being used without init */
-    INT8U                 u8QuotCharacter   = SPACE_ASCII_CHARACTER;/* avoid to be being used without init */
+    BOOLEAN               bQuotIsFound;
+    INT8U                 u8LastCharacter;
+    INT8U                 u8SecondCharacter;
+    INT8U                 u8QuotCharacter;
     INT8U                *pu8WorkingBuffer;
     INT8U          const *pu8CurrentXMLCharacter;
     INT32U                u32CheckingDataAmount, u32BufferIndex;
-
+    strTagScannerType    *pstrTagScannerType;
+
+    pstrTagScannerType = &pstrParserInstanceType->objstrTagScannerType;
+    if(pstrTagScannerType->pu8TagStart != pstrParserInstanceType->pu8LastParserLocation)
+    {/* new TAG, the saved state doesn't belong to it */
+        LwXMLP_vResetTagScanner(pstrParserInstanceType);
+        pstrTagScannerType->pu8TagStart      = pstrParserInstanceType->pu8LastParserLocation;
+        pstrParserInstanceType->pu8TagBuffer = pstrParserInstanceType->u8XMLworkingBuffer;
+#if(ENABLE_IN_PLACE_TOKENIZATION == STD_ON)
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+        if(pstrParserInstanceType->u8InputSourceDepth == 0U) /* the entity values are kept for the next references */
+#endif
+        {
+            pstrParserInstanceType->pu8TagBuffer = pstrParserInstanceType->pu8LastParserLocation;
+        }
+        /* the TAG starts at the current location */
+        pstrParserInstanceType->u32TagCountedLength = 0U;
+        pstrParserInstanceType->u32TagLineNumber    = pstrParserInstanceType->u32LineNumber;
+        pstrParserInstanceType->u32TagCoulmnNumber  = pstrParserInstanceType->u32CoulmnNumber;
+#endif
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    /* the bytes checked by the previous calls are still in the TAG buffer, so resume after them */
+    bQuotIsFound                                 = pstrTagScannerType->bQuotIsFound;
+    u8LastCharacter                              = pstrTagScannerType->u8LastCharacter;
+    u8SecondCharacter                            = pstrTagScannerType->u8SecondCharacter;
+    u8QuotCharacter                              = pstrTagScannerType->u8QuotCharacter;
     pstrParserInstanceType->bTagCloserIsFound   = STD_FALSE;
-    pu8CurrentXMLCharacter                       = pstrParserInstanceType->pu8LastParserLocation; /* we need to to escape < */
+    pu8CurrentXMLCharacter                       = LwXMLP_pu8GetReadyCharacter(pstrParserInstanceType, \
+                                                                               pstrTagScannerType->u32ScanOffset);
     u32CheckingDataAmount                        = LwXMLP_u32GetReadyData(pstrParserInstanceType);
-    pu8WorkingBuffer                             = pstrParserInstanceType->u8XMLworkingBuffer;
-    for(u32BufferIndex = 0U; \
+    pu8WorkingBuffer                             = &pstrParserInstanceType->pu8TagBuffer[pstrTagScannerType->u32ScanOffset];
+    for(u32BufferIndex = pstrTagScannerType->u32ScanOffset; \
         (u32BufferIndex < u32CheckingDataAmount)&& (u32BufferIndex < MAX_WORKING_BUFFER_SIZE); \
         ++u32BufferIndex)
     {
-        *pu8WorkingBuffer = *pu8CurrentXMLCharacter;
+#if(ENABLE_IN_PLACE_TOKENIZATION == STD_ON)
+        if(pu8WorkingBuffer != pu8CurrentXMLCharacter) /* the TAG which is tokenized in place isn't copied */
+#endif
+        {
+            *pu8WorkingBuffer = *pu8CurrentXMLCharacter;
+        }
         if(bQuotIsFound == STD_TRUE)
         {
             if(*pu8CurrentXMLCharacter == u8QuotCharacter)
@@ -4966,20 +9059,59 @@ static void LwXMLP_vCheckTagCloserAndType(LwXMLP_strXMLParseInstanceType *pstrPa
              */
         }
         u8LastCharacter  = *pu8CurrentXMLCharacter; /* Save last character to check it against / for empty Tag */
+        /* tokenize the loaded characters in the same pass, except the last ones which may belong to a partially
+         * loaded UTF-8 character or to the / of the empty TAG */
+        if(u32BufferIndex >= TAG_TOKENIZER_LOOKAHEAD)
+        {
+            LwXMLP_vTokenizeTag(pstrParserInstanceType, u32BufferIndex - (TAG_TOKENIZER_LOOKAHEAD - 1U));
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
         pu8WorkingBuffer++;
         pu8CurrentXMLCharacter++;
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_OFF)
         if(pstrParserInstanceType->pu8CircularBufferEnd == pu8CurrentXMLCharacter)
         {
-            pu8CurrentXMLCharacter = pstrParserInstanceType->u8XMLCircularBuffer;
+            pu8CurrentXMLCharacter = pstrParserInstanceType->pu8CircularBufferStart;
+#if(ENABLE_IN_PLACE_TOKENIZATION == STD_ON)
+            if(pstrParserInstanceType->pu8TagBuffer != pstrParserInstanceType->u8XMLworkingBuffer)
+            {/* the TAG wraps the circular buffer, so the rest of it is loaded to the working buffer */
+                LwXMLP_vRelocateTag(pstrParserInstanceType, u32BufferIndex + 1U);
+                pu8WorkingBuffer = &pstrParserInstanceType->u8XMLworkingBuffer[u32BufferIndex + 1U];
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+#endif
         }
         else
         {
             /* nothing to do here */
         }
+#endif
     }
+#if(ENABLE_PARSER_STATISTICS == STD_ON)
+    pstrParserInstanceType->u32TagScannedBytes += u32BufferIndex - pstrTagScannerType->u32ScanOffset;
+#endif
     if(pstrParserInstanceType->bTagCloserIsFound == STD_TRUE)
     {
-        *pu8WorkingBuffer = NULL_ASCII_CHARACTER; /* terminate teh TAG */
+        if(pstrParserInstanceType->pu8TagBuffer == pstrParserInstanceType->u8XMLworkingBuffer)
+        {/* the byte after the TAG which is tokenized in place belongs to the next portion */
+            *pu8WorkingBuffer = NULL_ASCII_CHARACTER; /* terminate teh TAG */
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
         if(u8SecondCharacter == SLASH_ASCII_CHARACTER)
         {
             pstrParserInstanceType->objenumTagTypeType  = csEndTagType;
@@ -4996,17 +9128,179 @@ static void LwXMLP_vCheckTagCloserAndType(LwXMLP_strXMLParseInstanceType *pstrPa
             LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Start TAG is found");
         }
         pstrParserInstanceType->u32CurrentTagLength = u32BufferIndex + 1U;
+#if(ENABLE_PARSER_STATISTICS == STD_ON)
+        pstrParserInstanceType->u32TagScannedBytes++; /* the closer itself */
+        pstrParserInstanceType->u32TagLoadedBytes  += pstrParserInstanceType->u32CurrentTagLength;
+#endif
     }/* if we looked for character and isn't found and reach the buffer end */
     else if((u32BufferIndex == MAX_CIRCULAR_BUFFER_SIZE) || (u32BufferIndex == MAX_WORKING_BUFFER_SIZE))
     {
         pstrParserInstanceType->objenumErrorType = csLargeElementProperty;
         LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Can't load the XML Tag into the buffer");
+        LwXMLP_vResetTagScanner(pstrParserInstanceType);
     }
     else
     {
-        /* unexpected */
+        /* may be the rest of the TAG will be received later */
+        pstrTagScannerType->u32ScanOffset     = u32BufferIndex;
+        pstrTagScannerType->bQuotIsFound      = bQuotIsFound;
+        pstrTagScannerType->u8QuotCharacter   = u8QuotCharacter;
+        pstrTagScannerType->u8SecondCharacter = u8SecondCharacter;
+        pstrTagScannerType->u8LastCharacter   = u8LastCharacter;
+    }
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vResetTagScanner                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vResetTagScanner(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   This API clears the saved state of the TAG closer scanner, so the next TAG will be loaded and checked
+                from its first byte
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+
+RETURN VALUE:   None
+
+Note        :
+
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vResetTagScanner(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+{
+    pstrParserInstanceType->objstrTagScannerType.pu8TagStart               = STD_NULL;
+    pstrParserInstanceType->objstrTagScannerType.u32ScanOffset             = 0U;
+    pstrParserInstanceType->objstrTagScannerType.bQuotIsFound              = STD_FALSE;
+    pstrParserInstanceType->objstrTagScannerType.u8QuotCharacter           = SPACE_ASCII_CHARACTER; /* avoid to be being used without init */
+    pstrParserInstanceType->objstrTagScannerType.u8SecondCharacter         = SPACE_ASCII_CHARACTER; /* avoid to be being used without init */
+    pstrParserInstanceType->objstrTagScannerType.u8LastCharacter           = SPACE_ASCII_CHARACTER; /* avoid to be being used without init */
+    pstrParserInstanceType->objstrTagScannerType.u32TokenOffset            = 0U;
+    pstrParserInstanceType->objstrTagScannerType.objenumCheckTagStateType  = csCheckTAGNameStart;
+    pstrParserInstanceType->objstrTagScannerType.objenumTagErrorType       = csNoError;
+    pstrParserInstanceType->objstrTagScannerType.u8AttributeEndCharacter   = SPACE_ASCII_CHARACTER;
+    pstrParserInstanceType->objstrTagScannerType.bEnableWhiteSpaceChecking = STD_FALSE;
+    pstrParserInstanceType->objstrTagScannerType.bEndTag                   = STD_FALSE;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vConsumeTag                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vConsumeTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   Consume the current TAG, the line and column numbers of the characters which are tokenized in their
+                place are taken from the counting which is done before they are tokenized
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+
+RETURN VALUE:   None
+
+Note        :   the terminators of the in place tokenizing overwrite the white spaces, so the line feeds between
+                the attributes can't be counted from the circular buffer
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vConsumeTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+{
+#if(ENABLE_IN_PLACE_TOKENIZATION == STD_ON)
+    INT32U u32CountedLength;
+
+    u32CountedLength = pstrParserInstanceType->u32TagCountedLength;
+    if(u32CountedLength > 0U)
+    {
+        LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, u32CountedLength);
+        pstrParserInstanceType->u32LineNumber       = pstrParserInstanceType->u32TagLineNumber;
+        pstrParserInstanceType->u32CoulmnNumber     = pstrParserInstanceType->u32TagCoulmnNumber;
+        pstrParserInstanceType->u32TagCountedLength = 0U;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
     }
+    /* the rest of the TAG is still as it is received */
+    LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32CurrentTagLength - u32CountedLength);
+#else
+    LwXMLP_vConsumeCharacterBulk(pstrParserInstanceType, pstrParserInstanceType->u32CurrentTagLength);
+#endif
+}
+#if(ENABLE_IN_PLACE_TOKENIZATION == STD_ON)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vRelocateTag                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vRelocateTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, INT32U u32TagLength)
+
+DESCRIPTION :   Move the TAG which is tokenized in its place in the circular buffer to the working buffer, the already
+                tokenized characters are copied as they are and the element name and the attributes pointers are
+                moved with them, so the tokenizing is resumed in the working buffer
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   u32TagLength           : the number of the TAG characters which are already loaded
+
+RETURN VALUE:   None
+
+Note        :   it is used when the TAG wraps the circular buffer or when its attribute values carry references
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vRelocateTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, INT32U u32TagLength)
+{
+    INT16S s16AttributeIndex;
+
+    (void)memcpy(pstrParserInstanceType->u8XMLworkingBuffer, pstrParserInstanceType->pu8TagBuffer, u32TagLength);
+    pstrParserInstanceType->pu8ElementName = LwXMLP_pu8RelocateTagPointer(pstrParserInstanceType, \
+                                                                          pstrParserInstanceType->pu8ElementName, \
+                                                                          u32TagLength);
+    /* the attribute which is being tokenized is moved too */
+    for(s16AttributeIndex = 0; \
+        (s16AttributeIndex <= pstrParserInstanceType->s16AttributeCounts) && (s16AttributeIndex < MAX_NUMBER_OF_ATTRIBUTES); \
+        ++s16AttributeIndex)
+    {
+        pstrParserInstanceType->pu8AttributeNameArray[s16AttributeIndex]  = \
+                LwXMLP_pu8RelocateTagPointer(pstrParserInstanceType, \
+                                             pstrParserInstanceType->pu8AttributeNameArray[s16AttributeIndex], \
+                                             u32TagLength);
+        pstrParserInstanceType->pu8AttributeValueArray[s16AttributeIndex] = \
+                LwXMLP_pu8RelocateTagPointer(pstrParserInstanceType, \
+                                             pstrParserInstanceType->pu8AttributeValueArray[s16AttributeIndex], \
+                                             u32TagLength);
+    }
+    pstrParserInstanceType->pu8TagBuffer = pstrParserInstanceType->u8XMLworkingBuffer;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_pu8RelocateTagPointer                                        <LwXMLP_CORE>
+
+SYNTAX:         INT8U *LwXMLP_pu8RelocateTagPointer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                    INT8U                          *pu8Pointer, \
+                                                    INT32U                          u32TagLength)
+
+DESCRIPTION :   Return the location in the working buffer of the TAG character which pu8Pointer points to in the TAG
+                buffer
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   pu8Pointer             : the pointer to be moved
+PARAMETER3  :   u32TagLength           : the number of the TAG characters which are moved
+
+RETURN VALUE:   the moved pointer, or pu8Pointer itself if it doesn't point to the moved characters
+
+Note        :   the pointers which are left from the previous TAGs aren't used before they are set again, so they are
+                kept as they are
+END DESCRIPTION *******************************************************************************************************/
+static INT8U *LwXMLP_pu8RelocateTagPointer(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                           INT8U                          *pu8Pointer, \
+                                           INT32U                          u32TagLength)
+{
+    INT8U *pu8RelocatedPointer = pu8Pointer;
+
+    if((pu8Pointer != STD_NULL) && \
+       (pu8Pointer >= pstrParserInstanceType->pu8TagBuffer) && \
+       (pu8Pointer <= &pstrParserInstanceType->pu8TagBuffer[u32TagLength]))
+    {
+        pu8RelocatedPointer = &pstrParserInstanceType->u8XMLworkingBuffer[pu8Pointer - pstrParserInstanceType->pu8TagBuffer];
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+
+    return pu8RelocatedPointer;
 }
+#endif
 /* START FUNCTION DESCRIPTION ******************************************************************************************
 LwXMLP_bTagContainXMLDirective                                        <LwXMLP_CORE>
 
@@ -5037,13 +9331,14 @@ static void LwXMLP_vCheckTagForDirective(LwXMLP_strXMLParseInstanceType *pstrPar
     static const INT8S cs8CommentHeaderString[]               = "<!--";
     const INT8U  *pu8CurrentXMLCharacter;
           INT8U  *pu8WorkingBuffer;
-          INT32U  u32byteIndex, u32DirectiveLength;
+          INT32U  u32byteIndex, u32DirectiveLength, u32CheckingDataAmount;
 
     pstrParserInstanceType->bTagContainDirective = STD_FALSE;
     pu8WorkingBuffer                             = pstrParserInstanceType->u8XMLworkingBuffer;
     pu8CurrentXMLCharacter                       = pstrParserInstanceType->pu8LastParserLocation;
+    u32CheckingDataAmount                        = LwXMLP_u32GetReadyData(pstrParserInstanceType);
     for(u32byteIndex = 0U; \
-        (u32byteIndex < MAX_CIRCULAR_BUFFER_SIZE) && (u32byteIndex < MAXIMUM_DIRECTIVE_LENTGH); \
+        (u32byteIndex < u32CheckingDataAmount) && (u32byteIndex < MAXIMUM_DIRECTIVE_LENTGH); \
         ++u32byteIndex)
     {
         if(u32byteIndex == 1U)
@@ -5053,6 +9348,7 @@ static void LwXMLP_vCheckTagForDirective(LwXMLP_strXMLParseInstanceType *pstrPar
             {
                 pu8WorkingBuffer[u32byteIndex]               = *pu8CurrentXMLCharacter;
                 pstrParserInstanceType->bTagContainDirective = STD_TRUE;
+                LwXMLP_vResetTagScanner(pstrParserInstanceType); /* the bytes taken as a TAG are a directive */
             }
             else
             {/* No Directive is available */
@@ -5064,18 +9360,24 @@ static void LwXMLP_vCheckTagForDirective(LwXMLP_strXMLParseInstanceType *pstrPar
             pu8WorkingBuffer[u32byteIndex] = *pu8CurrentXMLCharacter;
         }
         pu8CurrentXMLCharacter++;
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_OFF)
         if(pstrParserInstanceType->pu8CircularBufferEnd == pu8CurrentXMLCharacter)
         {
-            pu8CurrentXMLCharacter = pstrParserInstanceType->u8XMLCircularBuffer;
+            pu8CurrentXMLCharacter = pstrParserInstanceType->pu8CircularBufferStart;
         }
         else
         {
             /* nothing to do here */
         }
+#endif
     }
     if(pstrParserInstanceType->bTagContainDirective == STD_TRUE)
     {
-
+        /* the not received part of the header shall not match any directive */
+        for(; u32byteIndex < MAXIMUM_DIRECTIVE_LENTGH; ++u32byteIndex)
+        {
+            pu8WorkingBuffer[u32byteIndex] = NULL_ASCII_CHARACTER;
+        }
         if(strncmp((INT8S const *)pu8WorkingBuffer, cs8DeclarationHeaderString, strlen(cs8DeclarationHeaderString)) == 0)
         {
             LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found Declaration header directive");
@@ -5083,7 +9385,7 @@ static void LwXMLP_vCheckTagForDirective(LwXMLP_strXMLParseInstanceType *pstrPar
             if((pu8WorkingBuffer[u32DirectiveLength] == QUESTION_MARK_ASCII_CHARACTER) ||
                (LwXMLP_bIsWhiteSpace(&pu8WorkingBuffer[u32DirectiveLength]) == STD_TRUE))
             {
-                if((strlen((INT8S const *)pstrParserInstanceType->u8XMLPathBuffer) == 0U) && (pstrParserInstanceType->u32ParsedLength == 0U))
+                if((pstrParserInstanceType->u32ElementDepth == 0U) && (pstrParserInstanceType->u32ParsedLength == 0U))
                 {
                     pstrParserInstanceType->objenumDirectiveTypeType  = csDeclarationMarkup;
                 }
@@ -5238,15 +9540,32 @@ static void LwXMLP_vLoadDirectiveToBuffer(LwXMLP_strXMLParseInstanceType *pstrPa
 {
    const INT8U                 *pu8CurrentXMLCharacter;
          INT8U                 *pu8WorkingBuffer;
-         INT32U                 u32DirectiveLength = 0U;
+         INT32U                 u32DirectiveLength;
          INT32U                 u32BufferIndex;
          INT32U                 u32CheckingDataAmount;
+         strDirectiveScannerType *pstrDirectiveScannerType;
 
+    pstrDirectiveScannerType = &pstrParserInstanceType->objstrDirectiveScannerType;
+    if(pstrDirectiveScannerType->objenumDirectiveTypeType != pstrParserInstanceType->objenumDirectiveTypeType)
+    {/* the directive header was incomplete last time, so the saved state doesn't belong to this directive type */
+        pstrDirectiveScannerType->u32ScanOffset            = 0U;
+        pstrDirectiveScannerType->bFoundQuot               = STD_FALSE;
+        pstrDirectiveScannerType->bCommentInprogress       = STD_FALSE;
+        pstrDirectiveScannerType->objenumDirectiveTypeType = pstrParserInstanceType->objenumDirectiveTypeType;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    /* the bytes loaded by the previous calls are still in the working buffer, so resume after them */
+    u32DirectiveLength                           = pstrDirectiveScannerType->u32LoadedLength;
     pstrParserInstanceType->bEndOfDirectiveFound = STD_FALSE;
-    pu8WorkingBuffer                             = pstrParserInstanceType->u8XMLworkingBuffer;
-    pu8CurrentXMLCharacter                       = pstrParserInstanceType->pu8LastParserLocation;
+    pu8WorkingBuffer                             = &pstrParserInstanceType->u8XMLworkingBuffer[u32DirectiveLength];
+    pu8CurrentXMLCharacter                       = LwXMLP_pu8GetReadyCharacter(pstrParserInstanceType, u32DirectiveLength);
     u32CheckingDataAmount                        = LwXMLP_u32GetReadyData(pstrParserInstanceType);
-    for(u32BufferIndex = 0U;\
+    for(u32BufferIndex = u32DirectiveLength;\
         (u32BufferIndex < u32CheckingDataAmount) && \
         (pstrParserInstanceType->bEndOfDirectiveFound == STD_FALSE) &&\
         (u32BufferIndex < MAX_WORKING_BUFFER_SIZE);\
@@ -5332,30 +9651,34 @@ static void LwXMLP_vLoadDirectiveToBuffer(LwXMLP_strXMLParseInstanceType *pstrPa
 #endif
         pu8WorkingBuffer++;
         pu8CurrentXMLCharacter++;
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_OFF)
         if(pstrParserInstanceType->pu8CircularBufferEnd == pu8CurrentXMLCharacter)
         {
-            pu8CurrentXMLCharacter = pstrParserInstanceType->u8XMLCircularBuffer;
+            pu8CurrentXMLCharacter = pstrParserInstanceType->pu8CircularBufferStart;
         }
         else
         {
             /* nothing to do here */
         }
+#endif
     }
     if(pstrParserInstanceType->bEndOfDirectiveFound == STD_TRUE)
     {
-        pu8WorkingBuffer++;
-        *pu8WorkingBuffer = NULL_ASCII_CHARACTER;
+        pstrParserInstanceType->u8XMLworkingBuffer[pstrParserInstanceType->u32DirectiveLength] = NULL_ASCII_CHARACTER;
         LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Found Directive %s", pstrParserInstanceType->u8XMLworkingBuffer);
+        LwXMLP_vResetDirectiveScanner(pstrParserInstanceType);
     }
     else if((u32BufferIndex == MAX_CIRCULAR_BUFFER_SIZE) || (u32BufferIndex == MAX_WORKING_BUFFER_SIZE))
     {
         pstrParserInstanceType->objenumErrorType = csLargeDirectiveProperty;
         LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Can't load the Directive into the buffer");
+        LwXMLP_vResetDirectiveScanner(pstrParserInstanceType);
     }
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
-    else if(pstrParserInstanceType->bSecondLevelBufferEnabled == STD_TRUE)
+    else if(pstrParserInstanceType->u8InputSourceDepth > 0U)
     {
         pstrParserInstanceType->objenumErrorType = csIncompleteEntityContent;
+        LwXMLP_vResetDirectiveScanner(pstrParserInstanceType);
     }
 #endif
     else
@@ -5363,17 +9686,44 @@ static void LwXMLP_vLoadDirectiveToBuffer(LwXMLP_strXMLParseInstanceType *pstrPa
         /*
          * may be the rest of directive will be received later
          */
+        pstrDirectiveScannerType->u32LoadedLength = u32DirectiveLength;
     }
 }
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vResetDirectiveScanner                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vResetDirectiveScanner(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   This API clears the saved state of the directive scanner, so the next directive will be loaded and
+                checked from its first byte
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+
+RETURN VALUE:   None
+
+Note        :
+
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vResetDirectiveScanner(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+{
+    pstrParserInstanceType->objstrDirectiveScannerType.u32LoadedLength          = 0U;
+    pstrParserInstanceType->objstrDirectiveScannerType.u32ScanOffset            = 0U;
+    pstrParserInstanceType->objstrDirectiveScannerType.u8LastQuotType           = 0U;
+    pstrParserInstanceType->objstrDirectiveScannerType.bFoundQuot               = STD_FALSE;
+    pstrParserInstanceType->objstrDirectiveScannerType.bCommentInprogress       = STD_FALSE;
+    pstrParserInstanceType->objstrDirectiveScannerType.objenumDirectiveTypeType = csCommentMarkup; /* state is empty */
+}
 /*
- * assumption that the directive is in the working buffer totally or partially
+ * assumption that the directive is in the working buffer totally or partially, the scanning is resumed from the
+ * state saved by the previous call, so the bytes before the saved offset are not checked again
  */
 static BOOLEAN LwXMLP_bReachEndOfDirective(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 {
-          BOOLEAN  bEndOfDirectiveFound = STD_FALSE, bFoundQuot = STD_FALSE, bCommentInprogress = STD_FALSE;
+          BOOLEAN  bEndOfDirectiveFound = STD_FALSE, bFoundQuot, bCommentInprogress;
           INT32U   u32FooterLength, u32BufferIndex,u32ExpectCloser = 0;
           INT8U   *pu8WorkingBuffer;
-          INT8U    u8LastQuotType = 0U;
+          INT8U    u8LastQuotType;
+          strDirectiveScannerType *pstrDirectiveScannerType;
     static const INT8S   *pcs8FooterString;
     static const INT8S cs8DeclarationFooterString[]           = "?>";
     static const INT8S cs8PIFooterString[]                    = "?>";
@@ -5414,8 +9764,12 @@ static BOOLEAN LwXMLP_bReachEndOfDirective(LwXMLP_strXMLParseInstanceType *pstrP
             pcs8FooterString = cs8RegularFooterString;
             break;
     }
-    pu8WorkingBuffer = pstrParserInstanceType->u8XMLworkingBuffer;
-    u32BufferIndex = 0U;
+    pstrDirectiveScannerType = &pstrParserInstanceType->objstrDirectiveScannerType;
+    bFoundQuot               = pstrDirectiveScannerType->bFoundQuot;
+    bCommentInprogress       = pstrDirectiveScannerType->bCommentInprogress;
+    u8LastQuotType           = pstrDirectiveScannerType->u8LastQuotType;
+    u32BufferIndex           = pstrDirectiveScannerType->u32ScanOffset;
+    pu8WorkingBuffer         = &pstrParserInstanceType->u8XMLworkingBuffer[u32BufferIndex];
     while(u32BufferIndex < pstrParserInstanceType->u32DirectiveLength)
     {
         if((pu8WorkingBuffer[0] ==(INT8U)pcs8FooterString[0]) && (bFoundQuot == STD_FALSE))
@@ -5510,6 +9864,10 @@ static BOOLEAN LwXMLP_bReachEndOfDirective(LwXMLP_strXMLParseInstanceType *pstrP
         pu8WorkingBuffer++;
         u32BufferIndex++;
     }
+    pstrDirectiveScannerType->bFoundQuot         = bFoundQuot;
+    pstrDirectiveScannerType->bCommentInprogress = bCommentInprogress;
+    pstrDirectiveScannerType->u8LastQuotType     = u8LastQuotType;
+    pstrDirectiveScannerType->u32ScanOffset      = u32BufferIndex;
 
     return bEndOfDirectiveFound;
 }
@@ -5549,6 +9907,8 @@ static void LwXMLP_vParsePI(LwXMLP_strXMLParseInstanceType *pstrParserInstanceTy
     pu8WorkingBuffer = pstrParserInstanceType->u8XMLworkingBuffer;
     pstrParserInstanceType->pu8ParsedPITarget                         = STD_NULL;
     pstrParserInstanceType->pu8ParsedPIContent                        = STD_NULL;
+    pstrParserInstanceType->u32ParsedPITargetLength                   = 0U;
+    pstrParserInstanceType->u32ParsedPIContentLength                  = 0U;
     pu8WorkingBuffer[0U]                                               = NULL_ASCII_CHARACTER; /* Clear < */
     pu8WorkingBuffer[1U]                                               = NULL_ASCII_CHARACTER; /* Clear ? */
     pu8WorkingBuffer[pstrParserInstanceType->u32DirectiveLength - 2U] = NULL_ASCII_CHARACTER; /* Clear ? */
@@ -5571,6 +9931,9 @@ static void LwXMLP_vParsePI(LwXMLP_strXMLParseInstanceType *pstrParserInstanceTy
                  if(u32CharacterLength > 0U)
                  {
                      pstrParserInstanceType->pu8ParsedPITarget  = &pu8WorkingBuffer[u32PICharacterIndex];
+                     /* assume that the target extends to the end of the PI */
+                     pstrParserInstanceType->u32ParsedPITargetLength = \
+                             (pstrParserInstanceType->u32DirectiveLength - 2U) - u32PICharacterIndex;
                      objenumParsePIState                        = csCheckPIName;
                  }
                  else
@@ -5585,6 +9948,10 @@ static void LwXMLP_vParsePI(LwXMLP_strXMLParseInstanceType *pstrParserInstanceTy
                       /* reach end of the name */
                      pu8WorkingBuffer[u32PICharacterIndex]      = NULL_ASCII_CHARACTER;
                      pstrParserInstanceType->pu8ParsedPIContent = &pu8WorkingBuffer[u32PICharacterIndex + 1U];
+                     pstrParserInstanceType->u32ParsedPITargetLength  = \
+                             (INT32U)(&pu8WorkingBuffer[u32PICharacterIndex] - pstrParserInstanceType->pu8ParsedPITarget);
+                     pstrParserInstanceType->u32ParsedPIContentLength = \
+                             (pstrParserInstanceType->u32DirectiveLength - 2U) - (u32PICharacterIndex + 1U);
                      /* replace ? with NULL to terminate PI Content */
                      pu8WorkingBuffer[pstrParserInstanceType->u32DirectiveLength - 2U] = NULL_ASCII_CHARACTER;
                      u32CharacterLength                                                = 1U;
@@ -5635,7 +10002,9 @@ static void LwXMLP_vParsePI(LwXMLP_strXMLParseInstanceType *pstrParserInstanceTy
     }
     else if(pstrParserInstanceType->pu8ParsedPIContent != STD_NULL)
     {
-        LwXMLP_vNormalizeEndOfLine(pstrParserInstanceType->pu8ParsedPIContent);
+        pstrParserInstanceType->u32ParsedPIContentLength = \
+                LwXMLP_u32NormalizeEndOfLine(pstrParserInstanceType->pu8ParsedPIContent, \
+                                             pstrParserInstanceType->u32ParsedPIContentLength);
     }
     else
     {
@@ -5648,7 +10017,7 @@ static void LwXMLP_vParsePI(LwXMLP_strXMLParseInstanceType *pstrParserInstanceTy
      */
     if(pstrParserInstanceType->pu8ParsedPITarget != STD_NULL)
     {
-        if(strlen((INT8S const *)pstrParserInstanceType->pu8ParsedPITarget) == 3U)
+        if(pstrParserInstanceType->u32ParsedPITargetLength == 3U)
         {
             /*
              * save and convert to lower case the first character
@@ -5718,6 +10087,7 @@ static void LwXMLP_vCheckWellFormedCDATA(LwXMLP_strXMLParseInstanceType *pstrPar
     pstrParserInstanceType->pu8ParsedDataBuffer = pu8WorkingBuffer;
     u32CheckingDataAmount = pstrParserInstanceType->u32DirectiveLength;
     u32CheckingDataAmount -= 12U;
+    pstrParserInstanceType->u32ParsedDataLength = u32CheckingDataAmount;
     u32CharacterLength     = 0;
     u32CheckedLength       = 0;
     /* escape <![CDATA[   */
@@ -6050,10 +10420,12 @@ static void LwXMLP_vCheckWellFormedEntity(LwXMLP_strXMLParseInstanceType *pstrPa
         csGEDeclaration,
         csPEDeclaration
     }enumDeclarationTypeType;
-    BOOLEAN                   bChecMandatoryWhiteSpace = STD_FALSE, bEntityAlreadydefined = STD_FALSE;
-    INT8U                     *pu8Entity, u8AttributeEndCharacter = 0U, *pu8EntityValue, *pu8EntityName, u8EntityIndex;
+    BOOLEAN                   bChecMandatoryWhiteSpace = STD_FALSE;
+    INT8U                     *pu8Entity, u8AttributeEndCharacter = 0U, *pu8EntityValue, *pu8EntityName;
     INT8U          const      *pu8EntityEnd;
-    INT32U                     u32CurrentEntityLength = 0U;
+    INT16S                     s16EntityIndex;
+    INT32U                     u32EntitySlot;
+    strEntityType             *pstrEntityType;
     enumCheckElementStateType objenumCheckEntityStateType = csCheckEntityWhiteSpace;
     enumDeclarationTypeType   objenumDeclarationTypeType = csUnkownDeclaration;
 
@@ -6064,8 +10436,17 @@ static void LwXMLP_vCheckWellFormedEntity(LwXMLP_strXMLParseInstanceType *pstrPa
     pu8EntityName                                         = pu8Entity; /* Initial value */
     /* will escape <!ENTITY  > from checking in the for loop */
     pstrParserInstanceType->u32Length  = 0U;
-    /* Assume parsed entity */
-    pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].bParsedEntity = STD_TRUE;
+    /* the declaration is collected in the first free entity */
+    if(pstrParserInstanceType->pstrDTDTablesType->u16AvaliableEntities == MAX_ENTITIES)
+    {
+        pstrParserInstanceType->objenumErrorType = csLargeEntityCountProperty;
+        LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Can't load the entity");
+    }
+    else
+    {
+        /* Assume parsed entity */
+        pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[pstrParserInstanceType->pstrDTDTablesType->u16AvaliableEntities].bParsedEntity = STD_TRUE;
+    }
     for(;((pu8Entity != pu8EntityEnd) && (pstrParserInstanceType->objenumErrorType == csNoError)); )
     {
         switch(objenumCheckEntityStateType)
@@ -6104,30 +10485,19 @@ static void LwXMLP_vCheckWellFormedEntity(LwXMLP_strXMLParseInstanceType *pstrPa
                      objenumCheckEntityStateType = csCheckAttributeName;
                      objenumDeclarationTypeType  = csPEDeclaration;
                      bChecMandatoryWhiteSpace    = STD_TRUE;
-                     pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].objenumReferenceTypeType = csParamterEntity;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[pstrParserInstanceType->pstrDTDTablesType->u16AvaliableEntities].objenumReferenceTypeType = csParamterEntity;
                  }
                  else
                  {
                      pstrParserInstanceType->objenumErrorType = LwXMLP_enumValidateName(pu8Entity, &pstrParserInstanceType->pu8StartOfName, &pstrParserInstanceType->u32Length);
                      if(pstrParserInstanceType->objenumErrorType == csNoError)
                      {
-                         pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].objenumReferenceTypeType = csEntityReference;
-                         if(strlen((INT8S const *)pstrParserInstanceType->pu8StartOfName) > MAX_ENTITY_NAME_LENGTH)/* include Ampersand and the semicolumn */
-                         {
-                             pstrParserInstanceType->objenumErrorType = csLargeEntityNameProperty;
-                             LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Can't load the XML Tag into the buffer");
-                         }
-                         else if(pstrParserInstanceType->u8AvaliableEntities == MAX_ENTITIES)
-                         {
-                             pstrParserInstanceType->objenumErrorType = csLargeEntityCountProperty;
-                             LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Can't load the XML Tag into the buffer");
-                         }
-                         else if(pstrParserInstanceType->u32Length > 0U)
+                         pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[pstrParserInstanceType->pstrDTDTablesType->u16AvaliableEntities].objenumReferenceTypeType = csEntityReference;
+                         if(pstrParserInstanceType->u32Length > 0U)
                          {
                              objenumCheckEntityStateType = csCheckEntityDefination;
                              objenumDeclarationTypeType  = csGEDeclaration;
                              pu8EntityName                = pu8Entity;
-                             u32CurrentEntityLength       = 0;
                          }
                          else
                          {
@@ -6145,10 +10515,8 @@ static void LwXMLP_vCheckWellFormedEntity(LwXMLP_strXMLParseInstanceType *pstrPa
                      *pu8Entity                  = NULL_ASCII_CHARACTER;
                      pu8EntityValue              = &pu8Entity[1U];
                      pstrParserInstanceType->u32Length          = 1U; /* update character length */
-                     bEntityAlreadydefined       = STD_FALSE;
-                     u32CurrentEntityLength      = 0U;
                      objenumCheckEntityStateType = csCheckAttributeValueEndQuot;
-                     pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].objenumEntityStoreTypeType = csInternalStorage;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[pstrParserInstanceType->pstrDTDTablesType->u16AvaliableEntities].objenumEntityStoreTypeType = csInternalStorage;
                  }
                  else if(LwXMLP_bIsWhiteSpace(pu8Entity) == STD_TRUE)
                  {
@@ -6159,7 +10527,7 @@ static void LwXMLP_vCheckWellFormedEntity(LwXMLP_strXMLParseInstanceType *pstrPa
                      pstrParserInstanceType->objenumErrorType = LwXMLP_enumValidateExternalID(pu8Entity, &pstrParserInstanceType->u32Length, STD_FALSE);
                      if(pstrParserInstanceType->objenumErrorType == csNoError)
                      {
-                         pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].objenumEntityStoreTypeType = csExternalStorage;
+                         pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[pstrParserInstanceType->pstrDTDTablesType->u16AvaliableEntities].objenumEntityStoreTypeType = csExternalStorage;
                          if(pstrParserInstanceType->u32Length > 0U)
                          {
                              if(objenumDeclarationTypeType == csGEDeclaration)
@@ -6170,15 +10538,26 @@ static void LwXMLP_vCheckWellFormedEntity(LwXMLP_strXMLParseInstanceType *pstrPa
                              else /* csPEDeclaration */
                              {
                                  objenumCheckEntityStateType = csCheckDone;
-                                 (void)strncpy((INT8S *)&pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityName[0],\
-                                                                 (INT8S const *)pu8EntityName,\
-                                                                 MAX_ENTITY_NAME_LENGTH);
-                                 pu8EntityName = &pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityName[0];
-                                 pu8EntityName[strlen((INT8S const *)pu8EntityName)] = NULL_ASCII_CHARACTER;
-                                 pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityNameLength = \
-                                         (INT8U)strlen((INT8S const *)pu8EntityName);
-                                 pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityValueLength = 0U;
-                                 pstrParserInstanceType->u8AvaliableEntities++;
+                                 s16EntityIndex = LwXMLP_s16FindEntity(pstrParserInstanceType, \
+                                                                       pu8EntityName, \
+                                                                       strlen((INT8S const *)pu8EntityName), \
+                                                                       csParamterEntity, \
+                                                                       &u32EntitySlot);
+                                 if(s16EntityIndex >= 0)
+                                 {
+                                     /* the first declaration is binding */
+                                 }
+                                 else if(LwXMLP_bStoreEntity(pstrParserInstanceType, \
+                                                             pu8EntityName, \
+                                                             (INT8U const *)"") == STD_TRUE)
+                                 {
+                                     LwXMLP_vCommitEntity(pstrParserInstanceType, u32EntitySlot);
+                                 }
+                                 else
+                                 {
+                                     pstrParserInstanceType->objenumErrorType = csLargeEntityNameProperty;
+                                     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Can't load the entity name");
+                                 }
                              }
                          }
                          else
@@ -6222,7 +10601,7 @@ static void LwXMLP_vCheckWellFormedEntity(LwXMLP_strXMLParseInstanceType *pstrPa
                      pstrParserInstanceType->u32Length          = strlen("NDATA");
                      objenumCheckEntityStateType = csCheckNDATAName;
                      bChecMandatoryWhiteSpace    = STD_TRUE;
-                     pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].bParsedEntity = STD_FALSE;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[pstrParserInstanceType->pstrDTDTablesType->u16AvaliableEntities].bParsedEntity = STD_FALSE;
                  }
                  else if(strncmp((INT8S const *)pu8Entity, "ndata", strlen("ndata")) == 0) /* check mixed content */
                  {
@@ -6305,62 +10684,38 @@ static void LwXMLP_vCheckWellFormedEntity(LwXMLP_strXMLParseInstanceType *pstrPa
                  if(*pu8Entity == u8AttributeEndCharacter)
                  {
                      pstrParserInstanceType->u32Length = 1U; /* update character length */
-                     if(u32CurrentEntityLength < MAX_ENTITY_VALUE_LENGTH)
+                     *pu8Entity        = NULL_ASCII_CHARACTER;
+                     s16EntityIndex    = LwXMLP_s16FindEntity(pstrParserInstanceType, \
+                                                              pu8EntityName, \
+                                                              strlen((INT8S const *)pu8EntityName), \
+                                                              pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[pstrParserInstanceType->pstrDTDTablesType->u16AvaliableEntities].objenumReferenceTypeType, \
+                                                              &u32EntitySlot);
+                     if(s16EntityIndex >= 0)
                      {
-                         *pu8Entity         = NULL_ASCII_CHARACTER;
-                         (void)strncpy((INT8S *)&pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityName[0],\
-                                 (INT8S const *)pu8EntityName,\
-                                 MAX_ENTITY_NAME_LENGTH);
-                         pu8EntityName = &pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityName[0];
-                         pu8EntityName[strlen((INT8S const *)pu8EntityName)] = NULL_ASCII_CHARACTER;
-                         for(u8EntityIndex = 0; u8EntityIndex < pstrParserInstanceType->u8AvaliableEntities; ++u8EntityIndex)
-                         {
-                             if((strncmp((INT8S const *)pu8EntityName, \
-                                (INT8S const *)pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityName, \
-                                MAX_ENTITY_NAME_LENGTH) == 0) && \
-                                (pstrParserInstanceType->objstrEntityType[u8EntityIndex].objenumReferenceTypeType == \
-                              pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].objenumReferenceTypeType))
-                             {
-                                 bEntityAlreadydefined = STD_TRUE;
-                                 break;
-                             }
-                         }
-                         if(bEntityAlreadydefined == STD_FALSE)
+                         /* the first declaration is binding */
+                     }
+                     else if(LwXMLP_bStoreEntity(pstrParserInstanceType, pu8EntityName, pu8EntityValue) == STD_TRUE)
+                     {
+                         pstrEntityType = &pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[pstrParserInstanceType->pstrDTDTablesType->u16AvaliableEntities];
+                         if(pstrEntityType->u32EntityValueLength > 0U)
                          {
-                             pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityNameLength = (INT8U)strlen((INT8S const *)pu8EntityName);
-                             (void)strncpy((INT8S *)&pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityValue[0],\
-                                     (INT8S const *)pu8EntityValue,\
-                                     MAX_ENTITY_VALUE_LENGTH);
-                             pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityValueLength = \
-                                     (INT8U)strlen((INT8S const *)pu8EntityValue);
-                             if(pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityValueLength > 0U)
-                             {
-                                 LwXMLP_vNormalizeEndOfLine(pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityValue);
-                                 pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityValueLength = \
-                                         (INT8U)strlen((INT8S const *)pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityValue);
-                                 pu8EntityValue = &pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityValue[0];
-                                 /* The actual replacement text that is included as described above must contain
-                                  * the replacement text of any parameter entities referred to, and must contain
-                                  * the character referred to, in place of any character references in the literal
-                                  * entity value; however, general-entity references must be left as-is,
-                                  * unexpanded
-                                  */
-                                 pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(\
-                                                                            pstrParserInstanceType,\
-                                                                            pu8EntityValue,\
-                                                                            strlen((INT8S const *)pu8EntityValue),\
-                                                                            UPDATE_CHARACTER_REFERENCE | UPDATE_PARAMETER_REFERENCE);
-                                 pstrParserInstanceType->objstrEntityType[pstrParserInstanceType->u8AvaliableEntities].u8EntityValueLength = \
-                                         (INT8U)strlen((INT8S const *)pu8EntityValue);
-
-                             }
-                             else
-                             {
-                                 /*
-                                  * Nothing to do
-                                  */
-                             }
-                             ++pstrParserInstanceType->u8AvaliableEntities;
+                             pu8EntityValue                       = pstrEntityType->pu8EntityValue;
+                             pstrEntityType->u32EntityValueLength = LwXMLP_u32NormalizeEndOfLine(pu8EntityValue, \
+                                                                                                 pstrEntityType->u32EntityValueLength);
+                             /* The actual replacement text that is included as described above must contain
+                              * the replacement text of any parameter entities referred to, and must contain
+                              * the character referred to, in place of any character references in the literal
+                              * entity value; however, general-entity references must be left as-is,
+                              * unexpanded
+                              */
+                             pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(\
+                                                                        pstrParserInstanceType,\
+                                                                        pu8EntityValue,\
+                                                                        &pstrEntityType->u32EntityValueLength,\
+                                                                        0U,\
+                                                                        MAX_ENTITY_ARENA_SIZE - \
+                                                                        (INT32U)(pu8EntityValue - pstrParserInstanceType->pstrDTDTablesType->u8EntityArena),\
+                                                                        UPDATE_CHARACTER_REFERENCE | UPDATE_PARAMETER_REFERENCE);
                          }
                          else
                          {
@@ -6368,13 +10723,14 @@ static void LwXMLP_vCheckWellFormedEntity(LwXMLP_strXMLParseInstanceType *pstrPa
                               * Nothing to do
                               */
                          }
-                         objenumCheckEntityStateType = csCheckDone;
+                         LwXMLP_vCommitEntity(pstrParserInstanceType, u32EntitySlot);
                      }
                      else
                      {
                          pstrParserInstanceType->objenumErrorType = csLargeEntityValueProperty;
-                         LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Can't load the XML Tag into the buffer");
+                         LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Can't load the entity value");
                      }
+                     objenumCheckEntityStateType = csCheckDone;
                  }
                  else if(*pu8Entity == PERCENT_ASCII_CHARACTER)
                  {
@@ -6390,7 +10746,9 @@ static void LwXMLP_vCheckWellFormedEntity(LwXMLP_strXMLParseInstanceType *pstrPa
                      }
                      else/* valid Name character */
                      {
-                         u32CurrentEntityLength += pstrParserInstanceType->u32Length; /* increase the length of the entity value */
+                         /*
+                          * Nothing to do
+                          */
                      }
                  }
                  break;
@@ -7081,10 +11439,10 @@ static void LwXMLP_vValidateAttributeList(LwXMLP_strXMLParseInstanceType *pstrPa
     }enumCheckAttributeStateType;
     BOOLEAN               bChecMandatoryWhiteSpace = STD_FALSE, bValueIsEmpty = STD_FALSE;
     INT8U                *pu8AttributeList, u8AttributeEndCharacter = 0U, *pu8TempAttributeValue;
-    INT8U                 u8NumberOfBrackets = 0U, u8EntityReferenceUpdateTrials, u8LastReferencesCountFound = 0U, u8ReferenceIndex;
-    INT8U                 u8EntityIndex;
-    INT8U   const        *pu8ElementName, *pu8EntityValue;
+    INT8U                 u8NumberOfBrackets = 0U;
+    INT8U   const        *pu8ElementName;
     INT8U   const        *pu8AttributeListEnd;
+    strAttributeListType *pstrAttributeListType;
     enumCheckAttributeStateType objenumCheckAttributeStateType = csCheckElementName;
 
     pu8AttributeList                                             = &pstrParserInstanceType->u8XMLworkingBuffer[9];
@@ -7118,7 +11476,7 @@ static void LwXMLP_vValidateAttributeList(LwXMLP_strXMLParseInstanceType *pstrPa
                      {
                          pstrParserInstanceType->objenumErrorType = csLargeElementNameProperty;
                      }
-                     else if(pstrParserInstanceType->u8AvaliableAttibuteListCount > (MAX_ATTRIBUTES_LIST - 1U))
+                     else if(pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount > (MAX_ATTRIBUTES_LIST - 1U))
                      {
                          pstrParserInstanceType->objenumErrorType = csLargeNumberOfAttributeList;
                      }
@@ -7154,12 +11512,9 @@ static void LwXMLP_vValidateAttributeList(LwXMLP_strXMLParseInstanceType *pstrPa
                          objenumCheckAttributeStateType = csCheckAttributeType;
                          if(pstrParserInstanceType->u32Length < MAX_ATTRIBUTES_NAME_LENGTH)
                          {
-                            if(pstrParserInstanceType->u8AvaliableAttibuteListCount < (MAX_ATTRIBUTES_LIST - 1U))
+                            if(pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount < (MAX_ATTRIBUTES_LIST - 1U))
                              {
-                                 (void)strncpy((INT8S *)pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].u8ElementName, \
-                                         (INT8S const *)pu8ElementName, \
-                                         MAX_ELEMENT_NAME_LENGTH);
-                                 (void)strncpy((INT8S *)pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].u8AttributeName, \
+                                 (void)strncpy((INT8S *)pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].u8AttributeName, \
                                          (INT8S const *)pstrParserInstanceType->pu8StartOfName, \
                                          MAX_ATTRIBUTES_NAME_LENGTH);
                              }
@@ -7190,20 +11545,20 @@ static void LwXMLP_vValidateAttributeList(LwXMLP_strXMLParseInstanceType *pstrPa
                  {
                      pstrParserInstanceType->u32Length             = strlen("CDATA");
                      objenumCheckAttributeStateType = csCheckDefaultDecleration;
-                     pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csCDATAType;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csCDATAType;
                      bChecMandatoryWhiteSpace       = STD_TRUE;
                  }
                  else if(strncmp((INT8S const *)pu8AttributeList, "IDREFS", strlen("IDREFS")) == 0)
                  {
                      pstrParserInstanceType->u32Length             = strlen("IDREFS");
                      objenumCheckAttributeStateType = csCheckDefaultDecleration;
-                     pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csIFREFSType;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csIFREFSType;
                      bChecMandatoryWhiteSpace       = STD_TRUE;
                  }
                  else if(strncmp((INT8S const *)pu8AttributeList, "IDREF", strlen("IDREF")) == 0)
                  {
                      pstrParserInstanceType->u32Length             = strlen("IDREF");
-                     pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csIFREFType;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csIFREFType;
                      objenumCheckAttributeStateType = csCheckDefaultDecleration;
                      bChecMandatoryWhiteSpace       = STD_TRUE;
                  }
@@ -7211,47 +11566,47 @@ static void LwXMLP_vValidateAttributeList(LwXMLP_strXMLParseInstanceType *pstrPa
                  {
                      pstrParserInstanceType->u32Length             = strlen("ID");
                      objenumCheckAttributeStateType = csCheckDefaultDecleration;
-                     pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csIDType;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csIDType;
                      bChecMandatoryWhiteSpace       = STD_TRUE;
                  }
                  else if(strncmp((INT8S const *)pu8AttributeList, "ENTITY", strlen("ENTITY")) == 0)
                  {
                      pstrParserInstanceType->u32Length             = strlen("ENTITY");
                      objenumCheckAttributeStateType = csCheckDefaultDecleration;
-                     pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csENTITYType;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csENTITYType;
                      bChecMandatoryWhiteSpace       = STD_TRUE;
                  }
                  else if(strncmp((INT8S const *)pu8AttributeList, "ENTITIES", strlen("ENTITIES")) == 0)
                  {
                      pstrParserInstanceType->u32Length             = strlen("ENTITIES");
                      objenumCheckAttributeStateType = csCheckDefaultDecleration;
-                     pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csENTITIESType;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csENTITIESType;
                      bChecMandatoryWhiteSpace       = STD_TRUE;
                  }
                  else if(strncmp((INT8S const *)pu8AttributeList, "NMTOKENS", strlen("NMTOKENS")) == 0)
                  {
                      pstrParserInstanceType->u32Length             = strlen("NMTOKENS");
                      objenumCheckAttributeStateType = csCheckDefaultDecleration;
-                     pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csNMTOKENSType;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csNMTOKENSType;
                      bChecMandatoryWhiteSpace       = STD_TRUE;
                  }
                  else if(strncmp((INT8S const *)pu8AttributeList, "NMTOKEN", strlen("NMTOKEN")) == 0)
                  {
                      pstrParserInstanceType->u32Length             = strlen("NMTOKEN");
                      objenumCheckAttributeStateType = csCheckDefaultDecleration;
-                     pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csNMTOKENType;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csNMTOKENType;
                      bChecMandatoryWhiteSpace       = STD_TRUE;
                  }
                  else if(strncmp((INT8S const *)pu8AttributeList, "NOTATION", strlen("NOTATION")) == 0)
                  {
                      pstrParserInstanceType->u32Length = strlen("NOTATION");
                      objenumCheckAttributeStateType = csCheckNotation;
-                     pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csNOTATIONType;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csNOTATIONType;
                      bChecMandatoryWhiteSpace       = STD_TRUE;
                  }
                  else if(*pu8AttributeList == OPEN_ROUND_BRACKET_ASCII_CHARACTER)
                  {
-                     pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csEnumertaedValueListType;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttibuteTypeType = csEnumertaedValueListType;
                      pstrParserInstanceType->objenumErrorType = LwXMLP_enumValidateEnumeration(pu8AttributeList, &pstrParserInstanceType->u32Length);
                      if(pstrParserInstanceType->objenumErrorType == csNoError)
                      {
@@ -7342,20 +11697,20 @@ static void LwXMLP_vValidateAttributeList(LwXMLP_strXMLParseInstanceType *pstrPa
                  {
                      pstrParserInstanceType->u32Length = strlen("#REQUIRED");
                      objenumCheckAttributeStateType = csCheckAttributeName;
-                     pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].objenumAttributeBehaviourType = csRequired;
-                     pstrParserInstanceType->u8AvaliableAttibuteListCount++;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttributeBehaviourType = csRequired;
+                     LwXMLP_vCommitAttributeDeclaration(pstrParserInstanceType, pu8ElementName);
                  }
                  else if(strncmp((INT8S const *)pu8AttributeList, "#IMPLIED", strlen("#IMPLIED")) == 0)
                  {
                      pstrParserInstanceType->u32Length = strlen("#IMPLIED");
                      objenumCheckAttributeStateType = csCheckAttributeName;
-                     pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].objenumAttributeBehaviourType = csImplied;
-                     pstrParserInstanceType->u8AvaliableAttibuteListCount++;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttributeBehaviourType = csImplied;
+                     LwXMLP_vCommitAttributeDeclaration(pstrParserInstanceType, pu8ElementName);
                  }
                  else if(strncmp((INT8S const *)pu8AttributeList, "#FIXED", strlen("#FIXED")) == 0)
                  {
                      pstrParserInstanceType->u32Length             = strlen("#FIXED");
-                     pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].objenumAttributeBehaviourType = csFixed;
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttributeBehaviourType = csFixed;
                      objenumCheckAttributeStateType = csCheckAttributeValueStartQuot;
                      bChecMandatoryWhiteSpace       = STD_TRUE;
                  }
@@ -7366,6 +11721,7 @@ static void LwXMLP_vValidateAttributeList(LwXMLP_strXMLParseInstanceType *pstrPa
                      pu8TempAttributeValue          = &pu8AttributeList[1U];
                      *pu8AttributeList              = NULL_ASCII_CHARACTER;
                      pstrParserInstanceType->u32Length             = 1U; /* update character length */
+                     pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount].objenumAttributeBehaviourType = csDefaultValue;
                      objenumCheckAttributeStateType = csCheckAttributeValueEndQuot;
                  }
                  else
@@ -7409,78 +11765,58 @@ static void LwXMLP_vValidateAttributeList(LwXMLP_strXMLParseInstanceType *pstrPa
                      if(*pu8AttributeList == u8AttributeEndCharacter)
                      {
                          *pu8AttributeList = NULL_ASCII_CHARACTER;
-                         (void)strncpy((INT8S *)pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].u8AttributeValue, \
+                         pstrAttributeListType = &pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount];
+                         (void)strncpy((INT8S *)pstrAttributeListType->u8AttributeValue, \
                                  (INT8S const *)pu8TempAttributeValue, \
                                  MAX_ATTRIBUTES_VALUE_LENGTH);
-                         pu8TempAttributeValue = pstrParserInstanceType->objstrAttributeListType[pstrParserInstanceType->u8AvaliableAttibuteListCount].u8AttributeValue;
-                         for(u8EntityReferenceUpdateTrials = 0; \
-                             (u8EntityReferenceUpdateTrials < MAX_ENTITY_RESOLVING_DEPTH) && \
-                             (pstrParserInstanceType->objenumErrorType == csNoError); \
-                             ++u8EntityReferenceUpdateTrials)
+                         pu8TempAttributeValue                          = pstrAttributeListType->u8AttributeValue;
+                         /* the default value is measured once, then its length follows the expansion and the normalization */
+                         pstrAttributeListType->u32AttributeValueLength = strlen((INT8S const *)pu8TempAttributeValue);
+                         /* the default value is normalized once here instead of every start TAG which takes it */
+#if(ENABLE_ATTRIBUTE_Normalization == STD_ON)
+#if(ENABLE_EOL_NORMALIZATION == STD_ON)
+                         pstrAttributeListType->u32AttributeValueLength = LwXMLP_u32NormalizeEndOfLine(pu8TempAttributeValue, \
+                                                                                                       pstrAttributeListType->u32AttributeValueLength);
+#endif
+                         LwXMLP_vReplaceAttributeWhiteSpace(pu8TempAttributeValue, pstrAttributeListType->u32AttributeValueLength);
+                         pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(pstrParserInstanceType, \
+                                                                                                     pu8TempAttributeValue,\
+                                                                                                     &pstrAttributeListType->u32AttributeValueLength,\
+                                                                                                     0U,\
+                                                                                                     MAX_ATTRIBUTES_VALUE_LENGTH + 1U,\
+                                                                                                     UPDATE_ENTITY_REFERENCE | \
+                                                                                                     UPDATE_CHARACTER_REFERENCE | \
+                                                                                                     NORMALIZE_ATTRIBUTE_VALUE);
+                         if(pstrParserInstanceType->objenumErrorType == csNoError)
                          {
-                             pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(pstrParserInstanceType, \
-                                                                                                         pu8TempAttributeValue,\
-                                                                                                         strlen((INT8S const *)pu8TempAttributeValue),\
-                                                                                                         UPDATE_ENTITY_REFERENCE);
-                             if((pstrParserInstanceType->u8FoundReference > 0U) &&\
-                                (pstrParserInstanceType->objenumErrorType == csNoError))
-                             {
-                                 u8LastReferencesCountFound = pstrParserInstanceType->u8FoundReference;
-                             }
-                             else
-                             {
-                                 break;
-                             }
+                             pstrAttributeListType->u32AttributeValueLength = \
+                                     LwXMLP_u32NormalizeAttributeValue(pu8TempAttributeValue, \
+                                                                       pstrAttributeListType->u32AttributeValueLength, \
+                                                                       pstrAttributeListType->objenumAttibuteTypeType);
                          }
-                         if((u8LastReferencesCountFound > 0U) && (pstrParserInstanceType->objenumErrorType == csNoError))
+                         else
                          {
-                             for(u8ReferenceIndex = 0U; \
-                                 (u8ReferenceIndex < u8LastReferencesCountFound) && \
-                                 (pstrParserInstanceType->objenumErrorType == csNoError); \
-                                 ++u8ReferenceIndex)
-                             {
-                                 if(pstrParserInstanceType->objstrFoundReferenceType[u8ReferenceIndex].objenumReferenceTypeType == csEntityReference)
-                                 {   /* check that the found reference had been checked before if it is began in one entity and end in another */
-                                     /* Rule 4.3.2 */
-                                     u8EntityIndex  = pstrParserInstanceType->objstrFoundReferenceType[u8ReferenceIndex].u8EntityIndex;
-                                     pu8EntityValue = pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityValue;
-                                     if(pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityValueLength > 0U)
-                                     {
-                                         /* check if the still have unresolved entity, it may referee to itself */
-                                         if(pstrParserInstanceType->u8FoundReference > 0U)
-                                         {
-                                             if(strstr((INT8S const *)pu8TempAttributeValue, (INT8S const *)pu8EntityValue) != STD_NULL)
-                                             {
-                                                 pstrParserInstanceType->objenumErrorType = csEntityRefereToItself;
-                                             }
-                                             else
-                                             {
-                                                 pstrParserInstanceType->objenumErrorType = csLargeResolvingTrialsProperty;
-                                             }
-                                         }
-                                         else
-                                         {
-                                             break;
-                                         }
-                                     }
-                                     else
-                                     {
-                                         /*
-                                          * Nothing to do
-                                          */
-                                     }
-                                 }
-                                 else
-                                 {
-                                     /*
-                                      * Nothing to do
-                                      */
-                                 }
-                             }
+                             /*
+                              * Nothing to do
+                              */
+                         }
+#else
+                         pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(pstrParserInstanceType, \
+                                                                                                     pu8TempAttributeValue,\
+                                                                                                     &pstrAttributeListType->u32AttributeValueLength,\
+                                                                                                     0U,\
+                                                                                                     MAX_ATTRIBUTES_VALUE_LENGTH + 1U,\
+                                                                                                     UPDATE_ENTITY_REFERENCE);
+#endif
+                         if(pstrParserInstanceType->objenumErrorType == csNoError)
+                         {
+                             LwXMLP_vCommitAttributeDeclaration(pstrParserInstanceType, pu8ElementName);
                          }
-                         else /* there is no more references */
+                         else
                          {
-                             /*TODO: erro */
+                             /*
+                              * Nothing to do
+                              */
                          }
                          objenumCheckAttributeStateType = csCheckAttributeName;
                          bChecMandatoryWhiteSpace       = STD_TRUE;
@@ -8456,112 +12792,602 @@ static void LwXMLP_vCheckWellFormedDecl(LwXMLP_strXMLParseInstanceType *pstrPars
                 /*
                  * Nothing to do
                  */
-                 break;
+                 break;
+        }
+    }
+    /* validation part, such that the state machine shall terminate on specific states, otherwise, it shall be error */
+    if(pstrParserInstanceType->objenumErrorType  == csNoError)
+    {
+        switch(objenumCheckCommentStateType)
+        {
+            case csCheckEquality:
+                 pstrParserInstanceType->objenumErrorType = csMissingAttributeValue;
+                 LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "an attribute value is missing");
+                 break;
+            case csCheckAttributeValueStartQuot:
+            case csCheckAttributeValueEndQuot:
+                 pstrParserInstanceType->objenumErrorType = csMissingQuote;
+                 LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "an attribute value is missing its quote");
+                 break;
+                 /* valid exit states */
+            case csAttributeName:
+            default:
+                /*
+                 * Nothing to do
+                 */
+                 break;
+        }
+    }
+}
+#if(ENABLE_COMMENT_WELL_FORM_CHECK == STD_ON)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_srParseComment                                        <LwXMLP_CORE>
+
+SYNTAX:         StdReturnType LwXMLP_srParseComment(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   this API will validate the comment not to contain -- or invalid XML character beside it will point to
+                start of the comment location and terminate the comment by NULL
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+
+
+RETURN VALUE:   E_NOT_OK: if parsing the comment is failed
+                E_OK    : if parsing the comment is succeeded
+
+Note        :   The API will fail to load the buffer in the following cases:
+                - double -- are found inside the comment
+
+Note        :   This API assume that the directive is comment is exist in the working buffer <!--  -->
+
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vCheckWellFormedComment(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+{
+    INT8U  *pu8WorkingBuffer;
+    INT32U u32CommentCharacterIndex, u32CharacterLength;
+    BOOLEAN bFoundHyphenCharacter = STD_FALSE;
+
+    pu8WorkingBuffer                                             = pstrParserInstanceType->u8XMLworkingBuffer;
+    pu8WorkingBuffer[pstrParserInstanceType->u32DirectiveLength] = NULL_ASCII_CHARACTER;
+    /* will escape <!--  --> from checking in the for loop */
+    for(u32CommentCharacterIndex = 4U; \
+        ((u32CommentCharacterIndex < (pstrParserInstanceType->u32DirectiveLength - 2U)) &&\
+        (pstrParserInstanceType->objenumErrorType == csNoError));\
+        u32CommentCharacterIndex += u32CharacterLength)
+    {
+        if(pu8WorkingBuffer[u32CommentCharacterIndex] == HYPHEN_ASCII_CHARACTER)
+        {
+            if(bFoundHyphenCharacter == STD_TRUE)/* if the previous character was hyphen */
+            {
+                pstrParserInstanceType->objenumErrorType = csDoubleHyphenInComment;
+
+            }
+            else
+            {
+                bFoundHyphenCharacter = STD_TRUE;
+            }
+        }
+        else
+        {
+            bFoundHyphenCharacter = STD_FALSE;
+        }
+        u32CharacterLength = LwXMLP_u8ValidCharacter(&pu8WorkingBuffer[u32CommentCharacterIndex]);
+        if(u32CharacterLength == 0U)
+        {
+            pstrParserInstanceType->objenumErrorType = csInvalidXMLCharacter;
+            LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid XML character");
+        }
+        else
+        {
+            /*
+             * Nothing to do
+             */
+        }
+    }
+}
+#endif
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_bNewAttribute                                        <LwXMLP_CORE>
+
+SYNTAX:         BOOLEAN LwXMLP_bNewAttribute(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   Check if the attribute at index s16AttributeCounts isn't repeated in the current TAG by looking its name
+                hash up in the open addressing table s16AttributeHashTable, the names are compared only if their hashes
+                are equal, and if it is a new attribute it claims the empty slot which ends the probing
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+
+RETURN VALUE:   STD_TRUE : if the attribute name isn't found in the previous attributes of the TAG
+                STD_FALSE: if the attribute name is repeated
+
+Note        :   the slots which aren't claimed by an attribute of the current TAG are considered empty, so the table
+                doesn't need clearing, and it always has an empty slot since it has double the maximum attributes
+END DESCRIPTION *******************************************************************************************************/
+static BOOLEAN LwXMLP_bNewAttribute(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+{
+    BOOLEAN bNewAttribute = STD_TRUE, bEmptySlotFound = STD_FALSE;
+    INT16S  s16NewAttributeIndex, s16AttributeIndex;
+    INT32U  u32NewAttributeHash, u32Slot;
+
+    s16NewAttributeIndex = pstrParserInstanceType->s16AttributeCounts;
+    u32NewAttributeHash  = pstrParserInstanceType->u32AttributeHashArray[s16NewAttributeIndex];
+    u32Slot              = u32NewAttributeHash % (INT32U)ATTRIBUTE_HASH_TABLE_SIZE;
+    while((bNewAttribute == STD_TRUE) && (bEmptySlotFound == STD_FALSE))
+    {
+        s16AttributeIndex = pstrParserInstanceType->s16AttributeHashTable[u32Slot];
+        if((s16AttributeIndex < 0) || (s16AttributeIndex >= s16NewAttributeIndex) || \
+           ((INT32U)pstrParserInstanceType->s16AttributeSlotArray[s16AttributeIndex] != u32Slot))
+        {
+            bEmptySlotFound = STD_TRUE;
+        }
+        else if((pstrParserInstanceType->u32AttributeHashArray[s16AttributeIndex] == u32NewAttributeHash) && \
+                (pstrParserInstanceType->u32AttributeNameLengthArray[s16AttributeIndex] == \
+                 pstrParserInstanceType->u32AttributeNameLengthArray[s16NewAttributeIndex]) && \
+                (memcmp(pstrParserInstanceType->pu8AttributeNameArray[s16AttributeIndex], \
+                        pstrParserInstanceType->pu8AttributeNameArray[s16NewAttributeIndex], \
+                        pstrParserInstanceType->u32AttributeNameLengthArray[s16NewAttributeIndex]) == 0))
+        {
+            bNewAttribute = STD_FALSE;
+        }
+        else
+        {
+            u32Slot++;
+            if(u32Slot == (INT32U)ATTRIBUTE_HASH_TABLE_SIZE)
+            {
+                u32Slot = 0U;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+        }
+    }
+    if(bNewAttribute == STD_TRUE)
+    {
+        pstrParserInstanceType->s16AttributeHashTable[u32Slot]              = s16NewAttributeIndex;
+        pstrParserInstanceType->s16AttributeSlotArray[s16NewAttributeIndex] = (INT16S)u32Slot;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+
+    return bNewAttribute;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_u32HashBytes                                        <LwXMLP_CORE>
+
+SYNTAX:         INT32U LwXMLP_u32HashBytes(INT32U u32Hash, INT8U const *pu8Bytes, INT32U u32Length)
+
+DESCRIPTION :   Continue the FNV-1a hash of a name by the given bytes, so the name can be hashed while it is tokenized
+                character by character
+
+PARAMETER1  :   u32Hash   : the hash of the previous bytes of the name, or NAME_HASH_OFFSET_BASIS at the name start
+PARAMETER2  :   pu8Bytes  : pointer to the bytes to be hashed
+PARAMETER3  :   u32Length : the number of bytes to be hashed
+
+RETURN VALUE:   The hash of the name including the given bytes
+
+Note        :
+END DESCRIPTION *******************************************************************************************************/
+static INT32U LwXMLP_u32HashBytes(INT32U u32Hash, INT8U const *pu8Bytes, INT32U u32Length)
+{
+    INT32U u32Index;
+
+    for(u32Index = 0U; u32Index < u32Length; u32Index++)
+    {
+        u32Hash = (u32Hash ^ (INT32U)pu8Bytes[u32Index]) * NAME_HASH_PRIME;
+    }
+
+    return u32Hash;
+}
+#if(ENABLE_NAME_INTERNING == STD_ON)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_s16FindInternedName                                        <LwXMLP_CORE>
+
+SYNTAX:         INT16S LwXMLP_s16FindInternedName(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                  INT8U                          const *pu8Name, \
+                                                  INT32U                                u32NameHash, \
+                                                  INT32U                               *pu32Slot)
+
+DESCRIPTION :   Look the name up in the open addressing table s16NameIdHashTable by its hash, the names are compared
+                only if their hashes are equal
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   pu8Name                : the name string with NULL terminator
+PARAMETER3  :   u32NameHash            : the hash of the name
+PARAMETER4  :   pu32Slot               : the slot which ends the probing, it is the empty slot which the name shall
+                                         claim if it isn't found
+
+RETURN VALUE:   the index of the name in objstrInternedNameArray, or -1 if it isn't found
+
+Note        :   the table always has an empty slot since it has double the maximum names
+END DESCRIPTION *******************************************************************************************************/
+static INT16S LwXMLP_s16FindInternedName(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                         INT8U                          const *pu8Name, \
+                                         INT32U                                u32NameHash, \
+                                         INT32U                               *pu32Slot)
+{
+    INT16S  s16FoundIndex = -1, s16NameIndex;
+    BOOLEAN bEmptySlotFound = STD_FALSE;
+    INT32U  u32Slot;
+
+    u32Slot = u32NameHash % NAME_ID_HASH_TABLE_SIZE;
+    while((s16FoundIndex < 0) && (bEmptySlotFound == STD_FALSE))
+    {
+        s16NameIndex = pstrParserInstanceType->s16NameIdHashTable[u32Slot];
+        if(s16NameIndex < 0)
+        {
+            bEmptySlotFound = STD_TRUE;
+        }
+        else if((pstrParserInstanceType->objstrInternedNameArray[s16NameIndex].u32NameHash == u32NameHash) && \
+                (strcmp((INT8S const *)pstrParserInstanceType->objstrInternedNameArray[s16NameIndex].pu8Name, \
+                        (INT8S const *)pu8Name) == 0))
+        {
+            s16FoundIndex = s16NameIndex;
+        }
+        else
+        {
+            u32Slot++;
+            if(u32Slot == NAME_ID_HASH_TABLE_SIZE)
+            {
+                u32Slot = 0U;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
         }
     }
-    /* validation part, such that the state machine shall terminate on specific states, otherwise, it shall be error */
-    if(pstrParserInstanceType->objenumErrorType  == csNoError)
+    *pu32Slot = u32Slot;
+
+    return s16FoundIndex;
+}
+#endif
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_s16FindEntity                                        <LwXMLP_CORE>
+
+SYNTAX:         INT16S LwXMLP_s16FindEntity(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                            INT8U                          const *pu8EntityName, \
+                                            INT32U                                u32EntityNameLength, \
+                                            LwXMLP_enumReferenceTypeType          objenumReferenceTypeType, \
+                                            INT32U                               *pu32Slot)
+
+DESCRIPTION :   Look the entity up in the open addressing table s16EntityHashTable by the hash of its name, the names
+                are compared only if their hashes, lengths and reference types are equal
+
+PARAMETER1  :   pstrParserInstanceType   : pointer to the XML instance
+PARAMETER2  :   pu8EntityName            : the entity name, it needn't be NULL terminated
+PARAMETER3  :   u32EntityNameLength      : the length of the entity name
+PARAMETER4  :   objenumReferenceTypeType : general entity or parameter entity
+PARAMETER5  :   pu32Slot                 : the slot which ends the probing, it is the empty slot which the entity
+                                           shall claim if it isn't found
+
+RETURN VALUE:   the index of the entity in objstrEntityType, or -1 if it isn't found
+
+Note        :   the table always has an empty slot since it has double the maximum entities
+END DESCRIPTION *******************************************************************************************************/
+static INT16S LwXMLP_s16FindEntity(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                   INT8U                          const *pu8EntityName, \
+                                   INT32U                                u32EntityNameLength, \
+                                   LwXMLP_enumReferenceTypeType          objenumReferenceTypeType, \
+                                   INT32U                               *pu32Slot)
+{
+    INT16S               s16FoundIndex = -1, s16EntityIndex;
+    BOOLEAN              bEmptySlotFound = STD_FALSE;
+    INT32U               u32EntityNameHash, u32Slot;
+    strEntityType const *pstrEntityType;
+
+    u32EntityNameHash = LwXMLP_u32HashBytes(NAME_HASH_OFFSET_BASIS, pu8EntityName, u32EntityNameLength);
+    u32Slot           = u32EntityNameHash % ENTITY_HASH_TABLE_SIZE;
+    while((s16FoundIndex < 0) && (bEmptySlotFound == STD_FALSE))
     {
-        switch(objenumCheckCommentStateType)
+        s16EntityIndex = pstrParserInstanceType->pstrDTDTablesType->s16EntityHashTable[u32Slot];
+        if(s16EntityIndex < 0)
         {
-            case csCheckEquality:
-                 pstrParserInstanceType->objenumErrorType = csMissingAttributeValue;
-                 LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "an attribute value is missing");
-                 break;
-            case csCheckAttributeValueStartQuot:
-            case csCheckAttributeValueEndQuot:
-                 pstrParserInstanceType->objenumErrorType = csMissingQuote;
-                 LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "an attribute value is missing its quote");
-                 break;
-                 /* valid exit states */
-            case csAttributeName:
-            default:
-                /*
-                 * Nothing to do
-                 */
-                 break;
+            bEmptySlotFound = STD_TRUE;
+        }
+        else
+        {
+            pstrEntityType = &pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[s16EntityIndex];
+            if((pstrEntityType->u32EntityNameHash == u32EntityNameHash) && \
+               (pstrEntityType->u32EntityNameLength == u32EntityNameLength) && \
+               (pstrEntityType->objenumReferenceTypeType == objenumReferenceTypeType) && \
+               (memcmp(pstrEntityType->pu8EntityName, pu8EntityName, u32EntityNameLength) == 0))
+            {
+                s16FoundIndex = s16EntityIndex;
+            }
+            else
+            {
+                u32Slot++;
+                if(u32Slot == ENTITY_HASH_TABLE_SIZE)
+                {
+                    u32Slot = 0U;
+                }
+                else
+                {
+                    /*
+                     * Nothing to do
+                     */
+                }
+            }
         }
     }
+    *pu32Slot = u32Slot;
+
+    return s16FoundIndex;
 }
-#if(ENABLE_COMMENT_WELL_FORM_CHECK == STD_ON)
 /* START FUNCTION DESCRIPTION ******************************************************************************************
-LwXMLP_srParseComment                                        <LwXMLP_CORE>
+LwXMLP_bStoreEntity                                        <LwXMLP_CORE>
 
-SYNTAX:         StdReturnType LwXMLP_srParseComment(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+SYNTAX:         BOOLEAN LwXMLP_bStoreEntity(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                            INT8U                    const *pu8EntityName, \
+                                            INT8U                    const *pu8EntityValue)
 
-DESCRIPTION :   this API will validate the comment not to contain -- or invalid XML character beside it will point to
-                start of the comment location and terminate the comment by NULL
+DESCRIPTION :   Copy the name and the literal value of the entity under declaration into the free part of the entity
+                arena, the entity isn't visible to the look up until it is committed by LwXMLP_vCommitEntity
 
 PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   pu8EntityName          : the entity name with NULL terminator
+PARAMETER3  :   pu8EntityValue         : the literal entity value with NULL terminator
 
+RETURN VALUE:   STD_TRUE if the entity is stored, STD_FALSE if the arena is full
 
-RETURN VALUE:   E_NOT_OK: if parsing the comment is failed
-                E_OK    : if parsing the comment is succeeded
+Note        :   the value is expanded in place after it is stored and the expansion can double it at most, so room
+                for the doubled value is checked here but only the final value is taken by LwXMLP_vCommitEntity
+END DESCRIPTION *******************************************************************************************************/
+static BOOLEAN LwXMLP_bStoreEntity(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                   INT8U                    const *pu8EntityName, \
+                                   INT8U                    const *pu8EntityValue)
+{
+    BOOLEAN        bEntityStored = STD_FALSE;
+    INT32U         u32EntityNameLength, u32EntityValueLength;
+    strEntityType *pstrEntityType;
+
+    pstrEntityType       = &pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[pstrParserInstanceType->pstrDTDTablesType->u16AvaliableEntities];
+    u32EntityNameLength  = strlen((INT8S const *)pu8EntityName);
+    u32EntityValueLength = strlen((INT8S const *)pu8EntityValue);
+    if((MAX_ENTITY_ARENA_SIZE - pstrParserInstanceType->pstrDTDTablesType->u32EntityArenaLength) >= \
+       (u32EntityNameLength + (2U * u32EntityValueLength) + 3U))
+    {
+        pstrEntityType->pu8EntityName        = &pstrParserInstanceType->pstrDTDTablesType->u8EntityArena[pstrParserInstanceType->pstrDTDTablesType->u32EntityArenaLength];
+        pstrEntityType->u32EntityNameLength  = u32EntityNameLength;
+        pstrEntityType->u32EntityNameHash    = LwXMLP_u32HashBytes(NAME_HASH_OFFSET_BASIS, pu8EntityName, u32EntityNameLength);
+        (void)memcpy(pstrEntityType->pu8EntityName, pu8EntityName, u32EntityNameLength);
+        pstrEntityType->pu8EntityName[u32EntityNameLength] = NULL_ASCII_CHARACTER;
+        pstrEntityType->pu8EntityValue       = &pstrEntityType->pu8EntityName[u32EntityNameLength + 1U];
+        pstrEntityType->u32EntityValueLength = u32EntityValueLength;
+        (void)memcpy(pstrEntityType->pu8EntityValue, pu8EntityValue, u32EntityValueLength);
+        pstrEntityType->pu8EntityValue[u32EntityValueLength] = NULL_ASCII_CHARACTER;
+        bEntityStored = STD_TRUE;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
 
-Note        :   The API will fail to load the buffer in the following cases:
-                - double -- are found inside the comment
+    return bEntityStored;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vCommitEntity                                        <LwXMLP_CORE>
 
-Note        :   This API assume that the directive is comment is exist in the working buffer <!--  -->
+SYNTAX:         void LwXMLP_vCommitEntity(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, INT32U u32Slot)
+
+DESCRIPTION :   Take the arena bytes of the stored entity and make it visible to the look up
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   u32Slot                : the empty slot returned by LwXMLP_s16FindEntity for the entity
+
+RETURN VALUE:   None
 
+Note        :
 END DESCRIPTION *******************************************************************************************************/
-static void LwXMLP_vCheckWellFormedComment(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+static void LwXMLP_vCommitEntity(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, INT32U u32Slot)
 {
-    INT8U  *pu8WorkingBuffer;
-    INT32U u32CommentCharacterIndex, u32CharacterLength;
-    BOOLEAN bFoundHyphenCharacter = STD_FALSE;
+    strEntityType const *pstrEntityType;
 
-    pu8WorkingBuffer                                             = pstrParserInstanceType->u8XMLworkingBuffer;
-    pu8WorkingBuffer[pstrParserInstanceType->u32DirectiveLength] = NULL_ASCII_CHARACTER;
-    /* will escape <!--  --> from checking in the for loop */
-    for(u32CommentCharacterIndex = 4U; \
-        ((u32CommentCharacterIndex < (pstrParserInstanceType->u32DirectiveLength - 2U)) &&\
-        (pstrParserInstanceType->objenumErrorType == csNoError));\
-        u32CommentCharacterIndex += u32CharacterLength)
+    pstrEntityType = &pstrParserInstanceType->pstrDTDTablesType->objstrEntityType[pstrParserInstanceType->pstrDTDTablesType->u16AvaliableEntities];
+    pstrParserInstanceType->pstrDTDTablesType->u32EntityArenaLength += pstrEntityType->u32EntityNameLength + pstrEntityType->u32EntityValueLength + 2U;
+    pstrParserInstanceType->pstrDTDTablesType->s16EntityHashTable[u32Slot] = (INT16S)pstrParserInstanceType->pstrDTDTablesType->u16AvaliableEntities;
+    pstrParserInstanceType->pstrDTDTablesType->u16AvaliableEntities++;
+}
+#endif
+#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_s16FindAttributeListElement                                        <LwXMLP_CORE>
+
+SYNTAX:         INT16S LwXMLP_s16FindAttributeListElement(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                          INT8U                          const *pu8ElementName, \
+                                                          INT32U                                u32ElementNameHash, \
+                                                          INT32U                               *pu32Slot)
+
+DESCRIPTION :   Look the element up in the open addressing table s16AttributeListHashTable by the hash of its name, the
+                names are compared only if their hashes are equal
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   pu8ElementName         : the element name with NULL terminator
+PARAMETER3  :   u32ElementNameHash     : the hash of the element name
+PARAMETER4  :   pu32Slot               : the slot which ends the probing, it is the empty slot which the element shall
+                                         claim if it isn't found
+
+RETURN VALUE:   the index of the element in objstrAttributeListElementType, or -1 if the element has no attribute list
+                declarations
+
+Note        :   the table always has an empty slot since it has double the maximum elements
+END DESCRIPTION *******************************************************************************************************/
+static INT16S LwXMLP_s16FindAttributeListElement(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                 INT8U                          const *pu8ElementName, \
+                                                 INT32U                                u32ElementNameHash, \
+                                                 INT32U                               *pu32Slot)
+{
+    INT16S  s16FoundIndex = -1, s16ElementIndex;
+    BOOLEAN bEmptySlotFound = STD_FALSE;
+    INT32U  u32Slot;
+
+    u32Slot = u32ElementNameHash % ATTRIBUTE_LIST_HASH_TABLE_SIZE;
+    while((s16FoundIndex < 0) && (bEmptySlotFound == STD_FALSE))
     {
-        if(pu8WorkingBuffer[u32CommentCharacterIndex] == HYPHEN_ASCII_CHARACTER)
+        s16ElementIndex = pstrParserInstanceType->pstrDTDTablesType->s16AttributeListHashTable[u32Slot];
+        if(s16ElementIndex < 0)
         {
-            if(bFoundHyphenCharacter == STD_TRUE)/* if the previous character was hyphen */
+            bEmptySlotFound = STD_TRUE;
+        }
+        else if((pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListElementType[s16ElementIndex].u32ElementNameHash == u32ElementNameHash) && \
+                (strcmp((INT8S const *)pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListElementType[s16ElementIndex].u8ElementName, \
+                        (INT8S const *)pu8ElementName) == 0))
+        {
+            s16FoundIndex = s16ElementIndex;
+        }
+        else
+        {
+            u32Slot++;
+            if(u32Slot == ATTRIBUTE_LIST_HASH_TABLE_SIZE)
             {
-                pstrParserInstanceType->objenumErrorType = csDoubleHyphenInComment;
-
+                u32Slot = 0U;
             }
             else
             {
-                bFoundHyphenCharacter = STD_TRUE;
+                /*
+                 * Nothing to do
+                 */
             }
         }
+    }
+    *pu32Slot = u32Slot;
+
+    return s16FoundIndex;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_s16FindAttributeDeclaration                                        <LwXMLP_CORE>
+
+SYNTAX:         INT16S LwXMLP_s16FindAttributeDeclaration(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                          INT16S                                s16ElementIndex, \
+                                                          INT8U                          const *pu8AttributeName, \
+                                                          INT32U                                u32AttributeNameLength, \
+                                                          INT32U                                u32AttributeNameHash)
+
+DESCRIPTION :   Look the attribute up in the declarations list of the element, the names are compared only if their
+                hashes and lengths are equal
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   s16ElementIndex        : the index of the element in objstrAttributeListElementType
+PARAMETER3  :   pu8AttributeName       : the attribute name
+PARAMETER4  :   u32AttributeNameLength : the length of the attribute name
+PARAMETER5  :   u32AttributeNameHash   : the hash of the attribute name
+
+RETURN VALUE:   the index of the declaration in objstrAttributeListType, or -1 if the attribute isn't declared for
+                the element
+
+Note        :
+END DESCRIPTION *******************************************************************************************************/
+static INT16S LwXMLP_s16FindAttributeDeclaration(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                 INT16S                                s16ElementIndex, \
+                                                 INT8U                          const *pu8AttributeName, \
+                                                 INT32U                                u32AttributeNameLength, \
+                                                 INT32U                                u32AttributeNameHash)
+{
+    INT16S                      s16DeclarationIndex;
+    strAttributeListType const *pstrAttributeListType;
+
+    s16DeclarationIndex = pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListElementType[s16ElementIndex].s16FirstAttribute;
+    while(s16DeclarationIndex >= 0)
+    {
+        pstrAttributeListType = &pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[s16DeclarationIndex];
+        if((pstrAttributeListType->u32AttributeNameHash == u32AttributeNameHash) && \
+           (pstrAttributeListType->u32AttributeNameLength == u32AttributeNameLength) && \
+           (memcmp(pstrAttributeListType->u8AttributeName, pu8AttributeName, u32AttributeNameLength) == 0))
+        {
+            break;
+        }
         else
         {
-            bFoundHyphenCharacter = STD_FALSE;
+            s16DeclarationIndex = pstrAttributeListType->s16NextAttribute;
         }
-        u32CharacterLength = LwXMLP_u8ValidCharacter(&pu8WorkingBuffer[u32CommentCharacterIndex]);
-        if(u32CharacterLength == 0U)
+    }
+
+    return s16DeclarationIndex;
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vCommitAttributeDeclaration                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vCommitAttributeDeclaration(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                        INT8U                    const *pu8ElementName)
+
+DESCRIPTION :   Link the completely parsed attribute declaration at index u8AvaliableAttibuteListCount to the list of
+                its element, the element is added to the index if it is its first declaration
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+PARAMETER2  :   pu8ElementName         : the element name with NULL terminator
+
+RETURN VALUE:   None
+
+Note        :   if the attribute is already declared for the element, the first declaration is binding and the new
+                one is dropped
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vCommitAttributeDeclaration(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                               INT8U                    const *pu8ElementName)
+{
+    BOOLEAN                      bNewDeclaration = STD_TRUE;
+    INT16S                       s16ElementIndex, s16DeclarationIndex;
+    INT32U                       u32ElementNameHash, u32Slot;
+    strAttributeListType        *pstrAttributeListType;
+    strAttributeListElementType *pstrAttributeListElementType;
+
+    s16DeclarationIndex   = (INT16S)pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount;
+    pstrAttributeListType = &pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[s16DeclarationIndex];
+    pstrAttributeListType->u32AttributeNameLength = strlen((INT8S const *)pstrAttributeListType->u8AttributeName);
+    pstrAttributeListType->u32AttributeNameHash   = LwXMLP_u32HashBytes(NAME_HASH_OFFSET_BASIS, \
+                                                                        pstrAttributeListType->u8AttributeName, \
+                                                                        pstrAttributeListType->u32AttributeNameLength);
+    pstrAttributeListType->s16NextAttribute     = -1;
+    u32ElementNameHash = LwXMLP_u32HashBytes(NAME_HASH_OFFSET_BASIS, pu8ElementName, strlen((INT8S const *)pu8ElementName));
+    s16ElementIndex    = LwXMLP_s16FindAttributeListElement(pstrParserInstanceType, pu8ElementName, u32ElementNameHash, &u32Slot);
+    if(s16ElementIndex < 0)
+    {
+        /* the elements can't be more than the declarations, so there is always a free entry */
+        s16ElementIndex              = (INT16S)pstrParserInstanceType->pstrDTDTablesType->u8AttributeListElementCount;
+        pstrAttributeListElementType = &pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListElementType[s16ElementIndex];
+        (void)strncpy((INT8S *)pstrAttributeListElementType->u8ElementName, \
+                      (INT8S const *)pu8ElementName, \
+                      MAX_ELEMENT_NAME_LENGTH + 1U);
+        pstrAttributeListElementType->u32ElementNameHash      = u32ElementNameHash;
+        pstrAttributeListElementType->s16FirstAttribute       = s16DeclarationIndex;
+        pstrAttributeListElementType->u8DefaultAttributeCount = 0U;
+        pstrParserInstanceType->pstrDTDTablesType->s16AttributeListHashTable[u32Slot] = s16ElementIndex;
+        pstrParserInstanceType->pstrDTDTablesType->u8AttributeListElementCount++;
+    }
+    else
+    {
+        pstrAttributeListElementType = &pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListElementType[s16ElementIndex];
+        if(LwXMLP_s16FindAttributeDeclaration(pstrParserInstanceType, \
+                                              s16ElementIndex, \
+                                              pstrAttributeListType->u8AttributeName, \
+                                              pstrAttributeListType->u32AttributeNameLength, \
+                                              pstrAttributeListType->u32AttributeNameHash) < 0)
         {
-            pstrParserInstanceType->objenumErrorType = csInvalidXMLCharacter;
-            LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Invalid XML character");
+            pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[pstrAttributeListElementType->s16LastAttribute].s16NextAttribute = \
+                    s16DeclarationIndex;
         }
         else
         {
-            /*
-             * Nothing to do
-             */
+            bNewDeclaration = STD_FALSE;
         }
     }
-}
-#endif
-static BOOLEAN LwXMLP_bNewAttribute(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
-                                           INT8U                          const *pu8NewAttributeString)
-{
-    BOOLEAN bNewAttribute = STD_TRUE;
-    INT16S  s16AttributeIndex;
-
-    for(s16AttributeIndex = 0; s16AttributeIndex < pstrParserInstanceType->s16AttributeCounts; s16AttributeIndex++)
+    if(bNewDeclaration == STD_TRUE)
     {
-        if(strcmp((INT8S const *)pstrParserInstanceType->pu8AttributeNameArray[s16AttributeIndex], \
-                  (INT8S const *)pu8NewAttributeString) == 0)
+        pstrAttributeListElementType->s16LastAttribute = s16DeclarationIndex;
+        if((pstrAttributeListType->objenumAttributeBehaviourType == csFixed) || \
+           (pstrAttributeListType->objenumAttributeBehaviourType == csDefaultValue))
         {
-            bNewAttribute = STD_FALSE;
-            break;
+            pstrAttributeListElementType->u8DefaultAttributeCount++;
         }
         else
         {
@@ -8569,25 +13395,132 @@ static BOOLEAN LwXMLP_bNewAttribute(LwXMLP_strXMLParseInstanceType const *pstrPa
              * Nothing to do
              */
         }
+        pstrParserInstanceType->pstrDTDTablesType->u8AvaliableAttibuteListCount++;
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vAddDefaultAttributes                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vAddDefaultAttributes(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   Append the attributes which have a default or a fixed value in the attribute list declarations of the
+                element and are missing from its start TAG, so they are reported as if they were written in the TAG
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+
+RETURN VALUE:   None
+
+Note        :   the added attributes point to the normalized default values in objstrAttributeListType, and the
+                element which has no default values costs only one look up
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vAddDefaultAttributes(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+{
+    INT16S                      s16ElementIndex, s16DeclarationIndex, s16NewAttributeIndex;
+    INT32U                      u32Slot;
+    strAttributeListType       *pstrAttributeListType;
+
+    s16ElementIndex = LwXMLP_s16FindAttributeListElement(pstrParserInstanceType, \
+                                                         pstrParserInstanceType->pu8ElementName, \
+                                                         pstrParserInstanceType->u32ElementNameHash, \
+                                                         &u32Slot);
+    if((s16ElementIndex >= 0) && \
+       (pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListElementType[s16ElementIndex].u8DefaultAttributeCount > 0U))
+    {
+        s16DeclarationIndex = pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListElementType[s16ElementIndex].s16FirstAttribute;
+        while((s16DeclarationIndex >= 0) && (pstrParserInstanceType->objenumErrorType == csNoError))
+        {
+            pstrAttributeListType = &pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[s16DeclarationIndex];
+            if((pstrAttributeListType->objenumAttributeBehaviourType == csFixed) || \
+               (pstrAttributeListType->objenumAttributeBehaviourType == csDefaultValue))
+            {
+                s16NewAttributeIndex = pstrParserInstanceType->s16AttributeCounts;
+                if(s16NewAttributeIndex < MAX_NUMBER_OF_ATTRIBUTES)
+                {
+                    pstrParserInstanceType->pu8AttributeNameArray[s16NewAttributeIndex]        = pstrAttributeListType->u8AttributeName;
+                    pstrParserInstanceType->pu8AttributeValueArray[s16NewAttributeIndex]       = pstrAttributeListType->u8AttributeValue;
+                    pstrParserInstanceType->u32AttributeHashArray[s16NewAttributeIndex]        = pstrAttributeListType->u32AttributeNameHash;
+                    pstrParserInstanceType->u32AttributeNameLengthArray[s16NewAttributeIndex]  = pstrAttributeListType->u32AttributeNameLength;
+                    pstrParserInstanceType->u32AttributeValueLengthArray[s16NewAttributeIndex] = pstrAttributeListType->u32AttributeValueLength;
+                    /* the attribute which is written in the TAG overrides the default value */
+                    if(LwXMLP_bNewAttribute(pstrParserInstanceType) == STD_TRUE)
+                    {
+                        pstrParserInstanceType->s16AttributeCounts++;
+                    }
+                    else
+                    {
+                        /*
+                         * Nothing to do
+                         */
+                    }
+                }
+                else
+                {
+                    pstrParserInstanceType->objenumErrorType = csLargeNumberOfAttributes;
+                }
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+            s16DeclarationIndex = pstrAttributeListType->s16NextAttribute;
+        }
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
     }
-    return bNewAttribute;
 }
+#endif
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vUpdatePathWithStartTag                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vUpdatePathWithStartTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   Push the current element to the element stack, its name is appended to the path buffer after a
+                separator, so the path buffer is the storage of the stack names and the joined path at the same time
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+
+RETURN VALUE:   None
+
+Note        :   the error (csFailedToAddElementToPath) will be set if the path buffer has no room for the name
+END DESCRIPTION *******************************************************************************************************/
 static void LwXMLP_vUpdatePathWithStartTag(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 {
-    INT32U u32CurrentTagLength;
+    strElementEntryType *pstrElementEntryType;
+    INT32U               u32NameOffset, u32NameLength;
 
     LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, \
                     "Updating Path with TAG: %s", \
                     pstrParserInstanceType->pu8ElementName);
-    u32CurrentTagLength  = strlen((INT8S const*)pstrParserInstanceType->pu8ElementName);
-    if((pstrParserInstanceType->u32PathLength + u32CurrentTagLength) < MAX_XML_PATH_LENGTH)
+    u32NameLength = pstrParserInstanceType->u32ElementNameLength;
+    u32NameOffset = pstrParserInstanceType->u32PathLength;
+    if(u32NameOffset != 0U)
+    {
+        u32NameOffset++; /* Increase the path length due to \ */
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
+    }
+    if(((u32NameOffset + u32NameLength) < MAX_XML_PATH_LENGTH) && \
+       (pstrParserInstanceType->u32ElementDepth < MAX_ELEMENT_DEPTH))
     {
-        if(pstrParserInstanceType->u32PathLength != 0U)
+        if(u32NameOffset != 0U)
         {
-            LwXMLP_vCopy((INT8U *)&pstrParserInstanceType->u8XMLPathBuffer[pstrParserInstanceType->u32PathLength], \
-                         (INT8U const*)"\\", \
-                         sizeof("\\"));
-            pstrParserInstanceType->u32PathLength++; /* Increase the path length due to \ */
+            pstrParserInstanceType->u8XMLPathBuffer[u32NameOffset - 1U] = BACK_SLASH_ASCII_CHARACTER;
         }
         else
         {
@@ -8595,11 +13528,16 @@ static void LwXMLP_vUpdatePathWithStartTag(LwXMLP_strXMLParseInstanceType *pstrP
              * Nothing to do
              */
         }
-        LwXMLP_vCopy((INT8U *)&pstrParserInstanceType->u8XMLPathBuffer[pstrParserInstanceType->u32PathLength], \
+        LwXMLP_vCopy(&pstrParserInstanceType->u8XMLPathBuffer[u32NameOffset], \
                      (INT8U const *)pstrParserInstanceType->pu8ElementName,\
-                     u32CurrentTagLength);
-        pstrParserInstanceType->u32PathLength += u32CurrentTagLength;
-        pstrParserInstanceType->u8XMLPathBuffer[pstrParserInstanceType->u32PathLength] = 0U;
+                     u32NameLength);
+        pstrParserInstanceType->u32PathLength                  = u32NameOffset + u32NameLength;
+        pstrParserInstanceType->u8XMLPathBuffer[pstrParserInstanceType->u32PathLength] = NULL_ASCII_CHARACTER;
+        pstrElementEntryType                                   = &pstrParserInstanceType->objstrElementStack[pstrParserInstanceType->u32ElementDepth];
+        pstrElementEntryType->u32NameOffset                    = u32NameOffset;
+        pstrElementEntryType->u32NameLength                    = u32NameLength;
+        pstrElementEntryType->u32NameHash                      = pstrParserInstanceType->u32ElementNameHash;
+        pstrParserInstanceType->u32ElementDepth++;
         LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "New Path is: %s", pstrParserInstanceType->u8XMLPathBuffer);
     }
     else
@@ -8607,101 +13545,106 @@ static void LwXMLP_vUpdatePathWithStartTag(LwXMLP_strXMLParseInstanceType *pstrP
         pstrParserInstanceType->objenumErrorType = csFailedToAddElementToPath;
         LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Failed to add new TAG to the path");
     }
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-    if(pstrParserInstanceType->bSecondLevelBufferEnabled == STD_TRUE)
-    {
-        if((pstrParserInstanceType->u32SecondLevelPathLength + u32CurrentTagLength) < MAX_XML_PATH_LENGTH)
-        {
-            if(pstrParserInstanceType->u32SecondLevelPathLength != 0U)
-            {
-                LwXMLP_vCopy((INT8U *)&pstrParserInstanceType->u8SecondLevelPathBuffer[pstrParserInstanceType->u32SecondLevelPathLength], \
-                             (INT8U const*)"\\", \
-                             sizeof("\\"));
-                pstrParserInstanceType->u32SecondLevelPathLength++; /* increase the path length due to \ */
-            }
-            else
-            {
-                /*
-                 * Nothing to do
-                 */
-            }
-            LwXMLP_vCopy((INT8U *)&pstrParserInstanceType->u8SecondLevelPathBuffer[pstrParserInstanceType->u32SecondLevelPathLength], \
-                         (INT8U const *)pstrParserInstanceType->pu8ElementName,\
-                         u32CurrentTagLength);
-            pstrParserInstanceType->u32SecondLevelPathLength += u32CurrentTagLength;
-            pstrParserInstanceType->u8SecondLevelPathBuffer[pstrParserInstanceType->u32SecondLevelPathLength] = 0U;
-            LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "New Path is: %s", pstrParserInstanceType->u8SecondLevelPathBuffer);
-        }
-        else
-        {
-            pstrParserInstanceType->objenumErrorType = csFailedToAddElementToPath;
-            LwXMLP_mVerbose(VERBOSE_MESSAGE_ON|VERBOSE_LEVEL_DEBUGGING, "Failed to add new TAG to the path");
-        }
-    }
-#endif
 }
 /*
  * This method has two assumptions
  * the pu8Buffer contain a UTF-8 Data
- * it is a string with NULL terminator
+ * the length of the string is given, so the string doesn't need its NULL terminator
  * this is a complete XML structure so it should have the complete end of line presentation like \r\n
  */
 /* Normalize all line breaks before parsing, by translating both the two-character sequence #xD #xA and
      * any #xD that is not followed by #xA to a single #xA character.
 */
 /*
- * the method will normalize the content of the working buffer
+ * the method will normalize the content of the working buffer and return the normalized length
  */
 #if(ENABLE_EOL_NORMALIZATION == STD_ON)
-static void LwXMLP_vNormalizeEndOfLine(INT8U *pu8StringBuffer)
+static INT32U LwXMLP_u32NormalizeEndOfLine(INT8U *pu8StringBuffer, INT32U u32StringLength)
 {
-    INT32U  u32WorkingBufferIndex, u32MoveWorkingBufferIndex;
+    INT8U  *pu8ReadCharacter, *pu8WriteCharacter, *pu8StringEnd;
 
-    for(u32WorkingBufferIndex = 0U; \
-        (pu8StringBuffer[u32WorkingBufferIndex] != NULL_ASCII_CHARACTER);\
-        ++u32WorkingBufferIndex)
+    /* the strings without carriage return are skipped by the vectorized search of the C library */
+    pu8ReadCharacter = (INT8U *)memchr(pu8StringBuffer, CARRIAGE_RETURN_ASCII_CHARACTER, u32StringLength);
+    if(pu8ReadCharacter != STD_NULL)
     {
-        if(pu8StringBuffer[u32WorkingBufferIndex] == CARRIAGE_RETURN_ASCII_CHARACTER) /* 0x0D  \r*/
-        {   /* Is the next character is LINE_FEED_ASCII_CHARACTER? */
-            if(pu8StringBuffer[u32WorkingBufferIndex + 1U] == LINE_FEED_ASCII_CHARACTER)
+        /* compact the rest of the string in one pass, the write side never passes the read side */
+        pu8StringEnd      = &pu8StringBuffer[u32StringLength];
+        pu8WriteCharacter = pu8ReadCharacter;
+        while(pu8ReadCharacter < pu8StringEnd)
+        {
+            if(*pu8ReadCharacter == CARRIAGE_RETURN_ASCII_CHARACTER) /* 0x0D  \r*/
             {
-                /* Now move all the buffer */
-                for(u32MoveWorkingBufferIndex = u32WorkingBufferIndex; \
-                (pu8StringBuffer[u32MoveWorkingBufferIndex] != NULL_ASCII_CHARACTER); \
-                    ++u32MoveWorkingBufferIndex)
+                *pu8WriteCharacter = LINE_FEED_ASCII_CHARACTER;
+                /* Is the next character is LINE_FEED_ASCII_CHARACTER? so it is dropped */
+                if((&pu8ReadCharacter[1U] < pu8StringEnd) && (pu8ReadCharacter[1U] == LINE_FEED_ASCII_CHARACTER))
                 {
-                    pu8StringBuffer[u32MoveWorkingBufferIndex] = pu8StringBuffer[u32MoveWorkingBufferIndex + 1U];
+                    pu8ReadCharacter++;
+                }
+                else
+                {
+                    /*
+                     * Nothing to do
+                     */
                 }
             }
             else
             {
-                //pu8StringBuffer[u32WorkingBufferIndex] = LINE_FEED_ASCII_CHARACTER;
+                /* leave any other character including LINE_FEED_ASCII_CHARACTER */
+                *pu8WriteCharacter = *pu8ReadCharacter;
             }
+            pu8WriteCharacter++;
+            pu8ReadCharacter++;
         }
-        else
-        {
-           /* leave any other character including LINE_FEED_ASCII_CHARACTER */
-        }
+        /* the terminator is kept for the APIs which return the string without its length */
+        *pu8WriteCharacter = NULL_ASCII_CHARACTER;
+        u32StringLength    = (INT32U)(pu8WriteCharacter - pu8StringBuffer);
+    }
+    else
+    {
+        /*
+         * Nothing to do
+         */
     }
+
+    return u32StringLength;
 }
 #endif
 #if(ENABLE_ATTRIBUTE_Normalization == STD_ON)
 static void LwXMLP_vNormalizeAttributes(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 {
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
-    INT8U const *pu8EntityValue;
-    INT8U  u8LastReferencesCountFound = 0U, u8ReferenceIndex, u8EntityIndex, u8EntityReferenceUpdateTrials;
-    INT8U *pu8AttributeName;
+    INT8U *pu8AttributeName, *pu8AttributeValue;
     INT16S  s16AdjustedAttributeIndex;
-    INT32U  u32ReferenceUpdateMask, u32AttributeLength, u32AdjustedLength, u32CurrentTagLength;
+    INT32U  u32AttributeLength, u32AdjustedLength, u32AttributeOffset;
+#endif
+#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
+    INT16S  s16ElementIndex, s16DeclarationIndex;
+    INT32U  u32Slot;
 #endif
-    INT8U   u8LastCharacter = 0U;
-    INT8U  *pu8AttributeValue;
     INT16S  s16Attributeindex;
-    INT8U   u8AtributeListIndex;
-    enumAttibuteTypeType objenumAttibuteTypeType = csCDATAType;
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+    INT32U  u32CurrentTagLength;
+    INT32U  u32TagBufferSize;
+#endif
+    enumAttibuteTypeType objenumAttibuteTypeType;
+
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
     u32CurrentTagLength = pstrParserInstanceType->u32CurrentTagLength;
+    if(pstrParserInstanceType->pu8TagBuffer == pstrParserInstanceType->u8XMLworkingBuffer)
+    {
+        u32TagBufferSize = MAX_WORKING_BUFFER_SIZE;
+    }
+    else
+    {/* the TAGs which are tokenized in place don't carry references, so the values can't grow */
+        u32TagBufferSize = u32CurrentTagLength;
+    }
+#endif
+#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
+    /* the declarations of the element are looked up once for all its attributes */
+    s16ElementIndex = LwXMLP_s16FindAttributeListElement(pstrParserInstanceType, \
+                                                         pstrParserInstanceType->pu8ElementName, \
+                                                         pstrParserInstanceType->u32ElementNameHash, \
+                                                         &u32Slot);
 #endif
     for(s16Attributeindex = 0;
         (s16Attributeindex < pstrParserInstanceType->s16AttributeCounts) &&
@@ -8710,246 +13653,82 @@ static void LwXMLP_vNormalizeAttributes(LwXMLP_strXMLParseInstanceType *pstrPars
     {
         /* round one,Normalize end of line first */
 #if(ENABLE_EOL_NORMALIZATION == STD_ON)
-        LwXMLP_vNormalizeEndOfLine(pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex]);
+        pstrParserInstanceType->u32AttributeValueLengthArray[s16Attributeindex] = \
+                LwXMLP_u32NormalizeEndOfLine(pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex], \
+                                             pstrParserInstanceType->u32AttributeValueLengthArray[s16Attributeindex]);
 #endif
+        LwXMLP_vReplaceAttributeWhiteSpace(pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex], \
+                                           pstrParserInstanceType->u32AttributeValueLengthArray[s16Attributeindex]);
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
-        for(u8EntityReferenceUpdateTrials = 0U; \
-            (u8EntityReferenceUpdateTrials < MAX_ENTITY_RESOLVING_DEPTH) && \
-            (pstrParserInstanceType->objenumErrorType == csNoError); ++u8EntityReferenceUpdateTrials)
-        {
-            if(u8EntityReferenceUpdateTrials == 0U)
-            {
-                u32ReferenceUpdateMask = UPDATE_ENTITY_REFERENCE | DONT_DEREF_AS_GENERAL_ENTITY;
-            }
-            else
-            {
-                u32ReferenceUpdateMask = UPDATE_ENTITY_REFERENCE | UPDATE_CHARACTER_REFERENCE | DONT_DEREF_AS_GENERAL_ENTITY;
-            }
-
-            u32AttributeLength = strlen((INT8S const *)pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex]);
-            pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(pstrParserInstanceType, \
-                                                                                        pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex],\
-                                                                                        u32CurrentTagLength,\
-                                                                                        u32ReferenceUpdateMask);
-            /* check entity value for direct < reference */
-            if(pstrParserInstanceType->u8FoundReference > 0U)
-            {
-                for(u8ReferenceIndex = 0; \
-                    (u8ReferenceIndex < pstrParserInstanceType->u8FoundReference) && \
-                    (pstrParserInstanceType->objenumErrorType == csNoError); \
-                    ++u8ReferenceIndex)
-                {
-                    if(pstrParserInstanceType->objstrFoundReferenceType[u8ReferenceIndex].objenumReferenceTypeType == csEntityReference)
-                    {
-                        u8EntityIndex  = pstrParserInstanceType->objstrFoundReferenceType[u8ReferenceIndex].u8EntityIndex;
-                        pstrParserInstanceType->objenumErrorType = LwXMLP_enumValidateAttributeValue(pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityValue);
-                    }
-                    else
-                    {
-                        /*
-                         * Nothing to do
-                         */
-                    }
-                }
-                if(u32AttributeLength < strlen((INT8S const *)pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex]))
-                {/* Check if the attribute value is increased, so we need to adjust the rest of attributes pointers name and value */
-                    u32AdjustedLength = strlen((INT8S const *)pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex]) - u32AttributeLength;
-                    for(s16AdjustedAttributeIndex = (s16Attributeindex + 1);
-                        (s16AdjustedAttributeIndex < pstrParserInstanceType->s16AttributeCounts);\
-                         ++s16AdjustedAttributeIndex)
-                    {
-                        pu8AttributeValue = pstrParserInstanceType->pu8AttributeValueArray[s16AdjustedAttributeIndex];
-                        pstrParserInstanceType->pu8AttributeValueArray[s16AdjustedAttributeIndex] = \
-                                &pu8AttributeValue[u32AdjustedLength];
-                        pu8AttributeName = pstrParserInstanceType->pu8AttributeNameArray[s16AdjustedAttributeIndex];
-                        pstrParserInstanceType->pu8AttributeNameArray[s16AdjustedAttributeIndex] = \
-                                &pu8AttributeName[u32AdjustedLength];
-                    }
-                    u32CurrentTagLength += u32AdjustedLength;
-                }
-                else
-                {
-                    pu8AttributeValue = pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex];
-                    u32AdjustedLength = u32AttributeLength - strlen((INT8S const *)pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex]);
-                    LwXMLP_vMoveBlockRight(&pu8AttributeValue[strlen((INT8S const *)pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex])],\
-                                            u32AdjustedLength,\
-                                            u32CurrentTagLength);
-                }
-            }
-            else
-            {
-                /*
-                 * Nothing to do
-                 */
-            }
-            if(pstrParserInstanceType->u8FoundReference > 0U)
-            {
-                u8LastReferencesCountFound = pstrParserInstanceType->u8FoundReference;
-            }
-            else
-            {
-                break;
-            }
-        }
-        if((u8LastReferencesCountFound > 0U) && (pstrParserInstanceType->objenumErrorType == csNoError))
-        {
-            for(u8ReferenceIndex = 0U; \
-                (u8ReferenceIndex < u8LastReferencesCountFound) && \
-                (pstrParserInstanceType->objenumErrorType == csNoError); \
-                ++u8ReferenceIndex)
+        /* the references are replaced in one pass, the nested ones through the stack of the expansion, so the
+         * replaced characters aren't taken as references again */
+        u32AttributeLength = pstrParserInstanceType->u32AttributeValueLengthArray[s16Attributeindex];
+        /* the rest of the TAG is moved with the attribute value */
+        u32AttributeOffset = (INT32U)(pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex] - pstrParserInstanceType->pu8TagBuffer);
+        pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(pstrParserInstanceType, \
+                                                                                    pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex],\
+                                                                                    &pstrParserInstanceType->u32AttributeValueLengthArray[s16Attributeindex],\
+                                                                                    u32CurrentTagLength - u32AttributeOffset,\
+                                                                                    u32TagBufferSize - u32AttributeOffset,\
+                                                                                    UPDATE_ENTITY_REFERENCE | \
+                                                                                    UPDATE_CHARACTER_REFERENCE | \
+                                                                                    NORMALIZE_ATTRIBUTE_VALUE);
+        u32AdjustedLength = pstrParserInstanceType->u32AttributeValueLengthArray[s16Attributeindex];
+        if(u32AttributeLength != u32AdjustedLength)
+        {/* the attribute value is changed, so we need to adjust the rest of attributes pointers name and value */
+            for(s16AdjustedAttributeIndex = (s16Attributeindex + 1);
+                (s16AdjustedAttributeIndex < pstrParserInstanceType->s16AttributeCounts);\
+                 ++s16AdjustedAttributeIndex)
             {
-                if(pstrParserInstanceType->objstrFoundReferenceType[u8ReferenceIndex].objenumReferenceTypeType == csEntityReference)
-                {   /* check that the found reference had been checked before if it is began in one entity and end in another */
-                    /* Rule 4.3.2 */
-                    u8EntityIndex  = pstrParserInstanceType->objstrFoundReferenceType[u8ReferenceIndex].u8EntityIndex;
-                    pu8EntityValue = pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityValue;
-                    if(pstrParserInstanceType->objstrEntityType[u8EntityIndex].u8EntityValueLength > 0U)
-                    {
-                        /* Check if the still have unresolved entity, it may referee to itself */
-                        if(pstrParserInstanceType->u8FoundReference > 0U)
-                        {
-                            if(strstr((INT8S const *)pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex],\
-                                      (INT8S const *)pu8EntityValue) != STD_NULL)
-                            {
-                                pstrParserInstanceType->objenumErrorType = csEntityRefereToItself;
-                            }
-                            else
-                            {
-                                pstrParserInstanceType->objenumErrorType = csLargeResolvingTrialsProperty;
-                            }
-                        }
-                        else
-                        {
-                            /*
-                             * Nothing to do
-                             */
-                        }
-                    }
-                    else
-                    {
-                        /*
-                         * Nothing to do
-                         */
-                    }
-                }
-                else if((pstrParserInstanceType->objstrFoundReferenceType[u8ReferenceIndex].objenumReferenceTypeType == csCharacterEntityReference) &&
-                        (u8EntityReferenceUpdateTrials > 1U))
-                {
-                    pstrParserInstanceType->objenumErrorType = csPartialCharacterReference;
-                }
-                else
-                {
-                    /*
-                     * Nothing to do
-                     */
-                }
+                pu8AttributeValue = pstrParserInstanceType->pu8AttributeValueArray[s16AdjustedAttributeIndex];
+                pstrParserInstanceType->pu8AttributeValueArray[s16AdjustedAttributeIndex] = \
+                        &pu8AttributeValue[u32AdjustedLength] - u32AttributeLength;
+                pu8AttributeName = pstrParserInstanceType->pu8AttributeNameArray[s16AdjustedAttributeIndex];
+                pstrParserInstanceType->pu8AttributeNameArray[s16AdjustedAttributeIndex] = \
+                        &pu8AttributeName[u32AdjustedLength] - u32AttributeLength;
             }
+            u32CurrentTagLength = (u32CurrentTagLength + u32AdjustedLength) - u32AttributeLength;
         }
-        else /* there is no more references */
+        else
         {
-            /*TODO: erro */
+            /*
+             * Nothing to do
+             */
         }
 #endif
         if(pstrParserInstanceType->objenumErrorType == csNoError)
         {
-            /* round two, Replace any  (#x20, #xD, #xA, #x9) by (#x20U)*/
-            pu8AttributeValue = pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex];
-            while(*pu8AttributeValue != NULL_ASCII_CHARACTER)
-            {
-                if((*pu8AttributeValue == HTAB_ASCII_CHARACTER)|| \
-                   (*pu8AttributeValue == LINE_FEED_ASCII_CHARACTER)|| \
-                   (*pu8AttributeValue == CARRIAGE_RETURN_ASCII_CHARACTER))
-                {
-                    *pu8AttributeValue = SPACE_ASCII_CHARACTER;
-                }
-                ++pu8AttributeValue;
-            }
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-            pstrParserInstanceType->objenumErrorType = \
-                    LwXMLP_enumUpdateEntityReference(pstrParserInstanceType, \
-                            pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex],
-                            u32CurrentTagLength,\
-                            UPDATE_CHARACTER_REFERENCE);
-#endif
-            for(u8AtributeListIndex = 0; u8AtributeListIndex < MAX_ATTRIBUTES_LIST; ++u8AtributeListIndex)
-            {
-                if(strncmp((INT8S const *)pstrParserInstanceType->pu8AttributeNameArray[s16Attributeindex], \
-                           (INT8S const *)pstrParserInstanceType->objstrAttributeListType[u8AtributeListIndex].u8AttributeName, \
-                           MAX_ATTRIBUTES_NAME_LENGTH) == 0)
-                {
-                    objenumAttibuteTypeType = pstrParserInstanceType->objstrAttributeListType[u8AtributeListIndex].objenumAttibuteTypeType;
-                    break;
-                }
-            }
-            if(objenumAttibuteTypeType != csCDATAType)
+            objenumAttibuteTypeType = csCDATAType;
+#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
+            if(s16ElementIndex >= 0)
             {
-                /* round three, replacing sequences of space (#x20U) characters by a single space (#x20U)  */
-                pu8AttributeValue = pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex];
-                while(*pu8AttributeValue != NULL_ASCII_CHARACTER)
-                {
-                    if((u8LastCharacter == SPACE_ASCII_CHARACTER) && (*pu8AttributeValue == SPACE_ASCII_CHARACTER))
-                    {
-                        LwXMLP_vMoveStringBlockLeft(pu8AttributeValue, 1U);
-                        u8LastCharacter = *pu8AttributeValue;
-                    }
-                    else
-                    {
-                        u8LastCharacter = *pu8AttributeValue;
-                        ++pu8AttributeValue;
-                    }
-                }
-                /* round four, discarding any leading space (#x20U) characters*/
-                pu8AttributeValue = pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex];
-                while(*pu8AttributeValue == SPACE_ASCII_CHARACTER)
+                s16DeclarationIndex = LwXMLP_s16FindAttributeDeclaration(pstrParserInstanceType, \
+                                                                         s16ElementIndex, \
+                                                                         pstrParserInstanceType->pu8AttributeNameArray[s16Attributeindex], \
+                                                                         pstrParserInstanceType->u32AttributeNameLengthArray[s16Attributeindex], \
+                                                                         pstrParserInstanceType->u32AttributeHashArray[s16Attributeindex]);
+                if(s16DeclarationIndex >= 0)
                 {
-                   LwXMLP_vMoveStringBlockLeft(pu8AttributeValue, 1U);
+                    objenumAttibuteTypeType = pstrParserInstanceType->pstrDTDTablesType->objstrAttributeListType[s16DeclarationIndex].objenumAttibuteTypeType;
                 }
-                /* round five, discarding any trailing space (#x20U) characters*/
-                pu8AttributeValue = pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex];
-                pu8AttributeValue = &pu8AttributeValue[strlen((INT8S const *)pu8AttributeValue) - 1U];
-                while(*pu8AttributeValue == SPACE_ASCII_CHARACTER)
+                else
                 {
-                    *pu8AttributeValue = NULL_ASCII_CHARACTER;
-                    pu8AttributeValue--;
+                    /*
+                     * Nothing to do
+                     */
                 }
             }
             else
             {
                 /*
-                 * Do nothing
+                 * Nothing to do
                  */
             }
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-            for(u8EntityReferenceUpdateTrials = 0U; \
-                (u8EntityReferenceUpdateTrials < MAX_ENTITY_RESOLVING_DEPTH) && \
-                (pstrParserInstanceType->objenumErrorType == csNoError); ++u8EntityReferenceUpdateTrials)
-            {
-                pstrParserInstanceType->objenumErrorType = LwXMLP_enumUpdateEntityReference(pstrParserInstanceType, \
-                                                                                            pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex],\
-                                                                                            u32CurrentTagLength,\
-                                                                                            UPDATE_CHARACTER_REFERENCE | UPDATE_ENTITY_REFERENCE);
-                if((pstrParserInstanceType->objenumErrorType == csMissingSemicolon) && (u8EntityReferenceUpdateTrials > 0U))
-                { /* may be & appears after second round, so it shouldn't consider an error */
-                    pstrParserInstanceType->objenumErrorType = csNoError;
-                }
-                else
-                {
-                    /*
-                     * Nothing to do
-                     */
-                }
-                if(pstrParserInstanceType->u8FoundReference == 0U)/* No Entity is found */
-                {
-                    break;
-                }
-                else
-                {
-                    /*
-                     * Nothing to do
-                     */
-                }
-            }
 #endif
+            pstrParserInstanceType->u32AttributeValueLengthArray[s16Attributeindex] = \
+                    LwXMLP_u32NormalizeAttributeValue(pstrParserInstanceType->pu8AttributeValueArray[s16Attributeindex], \
+                                                      pstrParserInstanceType->u32AttributeValueLengthArray[s16Attributeindex], \
+                                                      objenumAttibuteTypeType);
         }
         else
         {
@@ -8959,17 +13738,87 @@ static void LwXMLP_vNormalizeAttributes(LwXMLP_strXMLParseInstanceType *pstrPars
         }
     }
 }
-#if((ENABLE_ENTITY_SUPPORT == STD_ON) && (ENABLE_ATTRIBUTE_Normalization == STD_ON))
-static LwXMLP_enumErrorType LwXMLP_enumValidateAttributeValue(INT8U const *pu8AttributeValue)
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vReplaceAttributeWhiteSpace                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vReplaceAttributeWhiteSpace(INT8U  *pu8AttributeValue, \
+                                                        INT32U  u32AttributeLength)
+
+DESCRIPTION :   Replace the white space characters (#xD, #xA, #x9) of the attribute value by space (#x20)
+
+PARAMETER1  :   pu8AttributeValue  : the attribute value
+PARAMETER2  :   u32AttributeLength : the length of the attribute value
+
+RETURN VALUE:   None
+
+Note        :   it is called before the references are replaced, so the white space characters which are given by
+                character references are kept
+END DESCRIPTION *******************************************************************************************************/
+static void LwXMLP_vReplaceAttributeWhiteSpace(INT8U  *pu8AttributeValue, \
+                                               INT32U  u32AttributeLength)
 {
-    LwXMLP_enumErrorType objenumErrorType = csNoError;
+    INT32U u32ReadIndex;
 
-    for(;*pu8AttributeValue != NULL_ASCII_CHARACTER;)
+    /* round two, Replace any  (#x20, #xD, #xA, #x9) by (#x20U)*/
+    for(u32ReadIndex = 0U; u32ReadIndex < u32AttributeLength; ++u32ReadIndex)
     {
-        if(*pu8AttributeValue == LESS_THAN_ASCII_CHARACTER)
+        if((pu8AttributeValue[u32ReadIndex] == HTAB_ASCII_CHARACTER)|| \
+           (pu8AttributeValue[u32ReadIndex] == LINE_FEED_ASCII_CHARACTER)|| \
+           (pu8AttributeValue[u32ReadIndex] == CARRIAGE_RETURN_ASCII_CHARACTER))
         {
-            objenumErrorType = csInvalidDirectReference;
-            break;
+            pu8AttributeValue[u32ReadIndex] = SPACE_ASCII_CHARACTER;
+        }
+    }
+}
+/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_u32NormalizeAttributeValue                                        <LwXMLP_CORE>
+
+SYNTAX:         INT32U LwXMLP_u32NormalizeAttributeValue(INT8U                *pu8AttributeValue, \
+                                                         INT32U                u32AttributeLength, \
+                                                         enumAttibuteTypeType  objenumAttibuteTypeType)
+
+DESCRIPTION :   Normalize the attribute value after its references are replaced, if the attribute isn't declared
+                as CDATA the sequences of spaces are replaced by a single space and the leading and the trailing
+                spaces are discarded
+
+PARAMETER1  :   pu8AttributeValue       : the attribute value with NULL terminator
+PARAMETER2  :   u32AttributeLength      : the length of the attribute value
+PARAMETER3  :   objenumAttibuteTypeType : the declared type of the attribute, or csCDATAType if it isn't declared
+
+RETURN VALUE:   the length of the normalized attribute value
+
+Note        :   it is used for the attributes of the start TAG and for the default values of the attribute list
+                declarations
+END DESCRIPTION *******************************************************************************************************/
+static INT32U LwXMLP_u32NormalizeAttributeValue(INT8U                *pu8AttributeValue, \
+                                                INT32U                u32AttributeLength, \
+                                                enumAttibuteTypeType  objenumAttibuteTypeType)
+{
+    INT32U u32ReadIndex, u32WriteIndex = 0U;
+
+    if(objenumAttibuteTypeType != csCDATAType)
+    {
+        /* rounds three and four, the sequences of space (#x20U) characters are replaced by a single space (#x20U)
+         * and the leading spaces are discarded while the value is compacted in one pass */
+        for(u32ReadIndex = 0U; u32ReadIndex < u32AttributeLength; ++u32ReadIndex)
+        {
+            if((pu8AttributeValue[u32ReadIndex] != SPACE_ASCII_CHARACTER) || \
+               ((u32WriteIndex > 0U) && (pu8AttributeValue[u32WriteIndex - 1U] != SPACE_ASCII_CHARACTER)))
+            {
+                pu8AttributeValue[u32WriteIndex] = pu8AttributeValue[u32ReadIndex];
+                u32WriteIndex++;
+            }
+            else
+            {
+                /*
+                 * Nothing to do
+                 */
+            }
+        }
+        /* round five, discarding any trailing space (#x20U) characters, the value can't end by more than one */
+        if((u32WriteIndex > 0U) && (pu8AttributeValue[u32WriteIndex - 1U] == SPACE_ASCII_CHARACTER))
+        {
+            u32WriteIndex--;
         }
         else
         {
@@ -8977,12 +13826,18 @@ static LwXMLP_enumErrorType LwXMLP_enumValidateAttributeValue(INT8U const *pu8At
              * Nothing to do
              */
         }
-        pu8AttributeValue++;
+        pu8AttributeValue[u32WriteIndex] = NULL_ASCII_CHARACTER;
+        u32AttributeLength               = u32WriteIndex;
+    }
+    else
+    {
+        /*
+         * Do nothing
+         */
     }
 
-    return objenumErrorType;
+    return u32AttributeLength;
 }
-#endif
 static void LwXMLP_vMoveStringBlockLeft(INT8U *pu8StringBlockAddress, INT32U u32MoveLength)
 {
     INT8U  const *pu8StringEnd = pu8StringBlockAddress;
@@ -9029,7 +13884,7 @@ static BOOLEAN LwXMLP_bXMLPathIsEmpty(LwXMLP_strXMLParseInstanceType const *pstr
 {
     BOOLEAN bIsEndOfXML;
 
-    if(pstrParserInstanceType->u8XMLPathBuffer[0] == NULL_ASCII_CHARACTER)
+    if(pstrParserInstanceType->u32ElementDepth == 0U)
     {
         bIsEndOfXML = STD_TRUE;
     }
@@ -9039,100 +13894,69 @@ static BOOLEAN LwXMLP_bXMLPathIsEmpty(LwXMLP_strXMLParseInstanceType const *pstr
     }
 
     return bIsEndOfXML;
-}
+}/* START FUNCTION DESCRIPTION ******************************************************************************************
+LwXMLP_vRemoveTagfromPath                                        <LwXMLP_CORE>
+
+SYNTAX:         void LwXMLP_vRemoveTagfromPath(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
+
+DESCRIPTION :   Pop the current element from the element stack if it matches the top of the stack, the match is
+                checked by the name hash and the name length first and then by one comparison of the name bytes, and
+                the path is shortened by terminating it at the separator before the popped name
+
+PARAMETER1  :   pstrParserInstanceType : pointer to the XML instance
+
+RETURN VALUE:   None
+
+Note        :   the error (csWrongNesting) will be set if the element doesn't match the top of the stack, or if it is
+                opened outside the entity value which is currently parsed
+END DESCRIPTION *******************************************************************************************************/
 static void LwXMLP_vRemoveTagfromPath(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType)
 {
-    INT8U         *pu8SlashLocation;
-    INT32U         u32TempPathLength;
-    INT8U         *pu8TempPath;
+    strElementEntryType const *pstrElementEntryType;
+    INT32U                     u32MinimumDepth = 0U;
 
-    pu8SlashLocation  = STD_NULL;
-    u32TempPathLength = pstrParserInstanceType->u32PathLength;
-    pu8TempPath       = &pstrParserInstanceType->u8XMLPathBuffer[u32TempPathLength];
-    while(u32TempPathLength != 0U)
-    {
-        if(*pu8TempPath == BACK_SLASH_ASCII_CHARACTER)
-        {
-            pu8SlashLocation                      = pu8TempPath;
-            pstrParserInstanceType->u32PathLength = u32TempPathLength;
-            break;
-        }
-        pu8TempPath--;
-        u32TempPathLength--;
-    }
-    if(pu8SlashLocation == STD_NULL)
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+    if(pstrParserInstanceType->u8InputSourceDepth > 0U)
     {
-        if(strcmp((INT8S const*)pstrParserInstanceType->u8XMLPathBuffer, \
-                (INT8S const*)pstrParserInstanceType->pu8ElementName) == 0)
-        {
-            *(pstrParserInstanceType->u8XMLPathBuffer) = NULL_ASCII_CHARACTER;
-            pstrParserInstanceType->u32PathLength      = 0U;
-        }
-        else /* trying to remove unexist TAG */
-        {
-            pstrParserInstanceType->objenumErrorType = csWrongNesting;
-        }
+        u32MinimumDepth = pstrParserInstanceType->objstrInputSourceType[pstrParserInstanceType->u8InputSourceDepth - 1U].u32BaseDepth;
     }
     else
     {
-        if(strcmp((INT8S const*)(&pu8SlashLocation[1U]), \
-                  (INT8S const*)pstrParserInstanceType->pu8ElementName) == 0)
-        {
-            *pu8SlashLocation = NULL_ASCII_CHARACTER;
-            pstrParserInstanceType->u32PathLength = u32TempPathLength;
-        }
-        else /* trying to remove unexist TAG */
-        {
-            pstrParserInstanceType->objenumErrorType = csWrongNesting;
-        }
+        /*
+         * Nothing to do
+         */
     }
-#if(ENABLE_ENTITY_SUPPORT == STD_ON)
-    if(pstrParserInstanceType->bSecondLevelBufferEnabled == STD_TRUE)
-    {
-        pu8SlashLocation  = STD_NULL;
-        u32TempPathLength = pstrParserInstanceType->u32SecondLevelPathLength;
-        pu8TempPath       = &pstrParserInstanceType->u8SecondLevelPathBuffer[u32TempPathLength];
-        while(u32TempPathLength != 0U)
-        {
-            if(*pu8TempPath == BACK_SLASH_ASCII_CHARACTER)
-            {
-                pu8SlashLocation = pu8TempPath;
-                pstrParserInstanceType->u32SecondLevelPathLength = u32TempPathLength;
-                break;
-            }
-            pu8TempPath--;
-            u32TempPathLength--;
-        }
-        if(pu8SlashLocation == STD_NULL)
-        {
-            if(strcmp((INT8S const*)pstrParserInstanceType->u8SecondLevelPathBuffer, \
-                    (INT8S const*)pstrParserInstanceType->pu8ElementName) == 0)
-            {
-                *(pstrParserInstanceType->u8SecondLevelPathBuffer) = NULL_ASCII_CHARACTER;
-                pstrParserInstanceType->u32SecondLevelPathLength   = 0U;
+#endif
+    if(pstrParserInstanceType->u32ElementDepth > u32MinimumDepth)
+    {
+        pstrElementEntryType = &pstrParserInstanceType->objstrElementStack[pstrParserInstanceType->u32ElementDepth - 1U];
+        if((pstrElementEntryType->u32NameHash == pstrParserInstanceType->u32ElementNameHash) && \
+           (pstrElementEntryType->u32NameLength == pstrParserInstanceType->u32ElementNameLength) && \
+           (memcmp(&pstrParserInstanceType->u8XMLPathBuffer[pstrElementEntryType->u32NameOffset], \
+                   pstrParserInstanceType->pu8ElementName, \
+                   pstrElementEntryType->u32NameLength) == 0))
+        {
+            if(pstrElementEntryType->u32NameOffset != 0U)
+            {   /* terminate the path at the separator */
+                pstrParserInstanceType->u32PathLength = pstrElementEntryType->u32NameOffset - 1U;
             }
-            else /* trying to remove unexist TAG */
+            else
             {
-                pstrParserInstanceType->objenumErrorType = csWrongNesting;
+                pstrParserInstanceType->u32PathLength = 0U;
             }
+            pstrParserInstanceType->u8XMLPathBuffer[pstrParserInstanceType->u32PathLength] = NULL_ASCII_CHARACTER;
+            pstrParserInstanceType->u32ElementDepth--;
         }
-        else
+        else /* trying to remove unexist TAG */
         {
-            if(strcmp((INT8S const*)(&pu8SlashLocation[1U]), \
-                      (INT8S const*)pstrParserInstanceType->pu8ElementName) == 0)
-            {
-                *pu8SlashLocation = NULL_ASCII_CHARACTER;
-                pstrParserInstanceType->u32SecondLevelPathLength = u32TempPathLength;
-            }
-            else /* trying to remove unexist TAG */
-            {
-                pstrParserInstanceType->objenumErrorType = csWrongNesting;
-            }
+            pstrParserInstanceType->objenumErrorType = csWrongNesting;
         }
     }
-#endif
-}
-/*
+    else /* trying to remove unexist TAG */
+    {
+        pstrParserInstanceType->objenumErrorType = csWrongNesting;
+    }
+}/*
 ********************************************************************************************************************
 *                                                      MODULE END
 ********************************************************************************************************************
@@ -314,7 +314,7 @@ static StdReturnType LwXMLP_srUTF16LEToUTF8(const INT8U  *pu8InputBuffer, \
           INT32S         s32Bits;
 
           memset(pu8OutputBuffer, 0x00, *pu32OutputBufferLength);
-    if((*pu32InputBufferLength) > 5U) /* Guarantee that the incoming buffer contain complete character */
+    if((*pu32InputBufferLength) > 1U) /* Guarantee that the incoming buffer contain a complete code unit */
     {
         if((*pu32InputBufferLength % 2U) == 1U)
         {
@@ -336,6 +336,16 @@ static StdReturnType LwXMLP_srUTF16LEToUTF8(const INT8U  *pu8InputBuffer, \
 #endif
             if((u32TempCharacter & 0xFC00U) == 0xD800U)
             {
+                if((u32CheckedLength + 1U) >= ((*pu32InputBufferLength)/2U))
+                {/* the low surrogate isn't received yet, so the pair is left for the next portion */
+                    break;
+                }
+                else
+                {
+                    /*
+                     * Nothing to do
+                     */
+                }
 #if(ENDIAN_TYPE == LITTLE_ENDIAN)
                 u32SurrogatePair = *pu8TempBuffer;
                 pu8TempBuffer++;
@@ -354,6 +364,7 @@ static StdReturnType LwXMLP_srUTF16LEToUTF8(const INT8U  *pu8InputBuffer, \
                     u32TempCharacter <<= 10U;
                     u32TempCharacter |= u32SurrogatePair & 0x03FFU;
                     u32TempCharacter += 0x10000U;
+                    u32CheckedLength++; /* the low surrogate */
                 }
                 else
                 {
@@ -441,11 +452,11 @@ static StdReturnType LwXMLP_srUTF16BEToUTF8(const INT8U  *pu8InputBuffer, \
           StdReturnType  srEncodingStatus = E_OK;
           BOOLEAN        bReachEncodingEnd = STD_FALSE;
     const INT8U         *pu8TempInputBuffer = pu8InputBuffer;
-          INT32U         u32UTF8LowerWord, u32UTF8UpperWord;
+          INT32U         u32UTF8LowerWord, u32UTF8UpperWord, u32CodeUnits;
           INT32S         s32Bits = 0;
           INT32U         u32AvaliableOutputLength = *pu32OutputBufferLength, u32AvaliableInputLength;
 
-    if(((*pu32InputBufferLength) > 2U) && (*pu32OutputBufferLength > 0U))/* Guarantee that the incoming buffer contain complete character */
+    if(((*pu32InputBufferLength) > 1U) && (*pu32OutputBufferLength > 0U))/* Guarantee that the incoming buffer contain a complete code unit */
     {
 
         if((*pu32InputBufferLength % 2U) == 1U)
@@ -474,8 +485,19 @@ static StdReturnType LwXMLP_srUTF16BEToUTF8(const INT8U  *pu8InputBuffer, \
                 u32UTF8LowerWord = *pu8TempInputBuffer;
                 pu8TempInputBuffer++;
 #endif
+            u32CodeUnits = 1U;
             if((u32UTF8LowerWord & 0xFC00U) == 0xD800U)
             {
+                if(u32AvaliableInputLength < 2U)
+                {/* the low surrogate isn't received yet, so the pair is left for the next portion */
+                    break;
+                }
+                else
+                {
+                    /*
+                     * Nothing to do
+                     */
+                }
 #if(ENDIAN_TYPE == LITTLE_ENDIAN)
                 u32UTF8UpperWord = *pu8TempInputBuffer;
                 pu8TempInputBuffer++;
@@ -495,6 +517,7 @@ static StdReturnType LwXMLP_srUTF16BEToUTF8(const INT8U  *pu8InputBuffer, \
                     u32UTF8LowerWord <<= 10;
                     u32UTF8LowerWord |= u32UTF8UpperWord & 0x03FFU;
                     u32UTF8LowerWord += 0x10000U;
+                    u32CodeUnits      = 2U;
                 }
                 else
                 {
@@ -566,7 +589,7 @@ static StdReturnType LwXMLP_srUTF16BEToUTF8(const INT8U  *pu8InputBuffer, \
             }
             if(bReachEncodingEnd == STD_FALSE)
             {
-                u32AvaliableInputLength--;
+                u32AvaliableInputLength -= u32CodeUnits;
             }
             else
             {
@@ -65,7 +65,25 @@
 ************************************************************************************************************************
 ********************************************************************************************************************
 */
-
+#define ATTRIBUTE_HASH_TABLE_SIZE          (2 * MAX_NUMBER_OF_ATTRIBUTES) /*!< The number of slots of the attribute
+                                                                               names hash table, it is kept at least
+                                                                               half empty so the probing is short */
+#define MAX_ELEMENT_DEPTH                  (MAX_XML_PATH_LENGTH / 2U)     /*!< The maximum number of the open elements,
+                                                                               every element takes one character and
+                                                                               one separator at least of the path */
+#define ENTITY_HASH_TABLE_SIZE             (2U * MAX_ENTITIES)            /*!< The number of slots of the entities
+                                                                               hash table */
+#define NAME_ID_HASH_TABLE_SIZE            (2U * MAX_INTERNED_NAMES)      /*!< The number of slots of the names IDs
+                                                                               hash table */
+#define ATTRIBUTE_LIST_HASH_TABLE_SIZE     (2U * MAX_ATTRIBUTES_LIST)     /*!< The number of slots of the hash table of
+                                                                               the elements which have attribute list
+                                                                               declarations */
+#if((ENABLE_ENTITY_SUPPORT == STD_ON) || (ENABLE_DTD_WELL_FORM_CHECK == STD_ON))
+    #define ENABLE_DTD_TABLES              STD_ON                         /*!< The entities or the attribute list
+                                                                               declarations are kept in DTD tables */
+#else
+    #define ENABLE_DTD_TABLES              STD_OFF                        /*!< There is no DTD tables */
+#endif
 
 /*
  ==================================================================================================================
@@ -199,20 +217,23 @@ typedef enum
 {
     csImplied,                                  /*!< IMPLIED attribute Declaration */
     csRequired,                                 /*!< REQUIRED attribute Declaration */
-    csFixed                                     /*!< FIXED attribute Declaration */
+    csFixed,                                    /*!< FIXED attribute Declaration */
+    csDefaultValue                              /*!< attribute Declaration with a default value only */
 }enumDefaultDeclarationTypeType;
 /*! \struct strEntityType
-    \brief it the structure which hold the entities
+    \brief it the structure which hold the entities, the name and the value strings are kept in the entity arena
     @var strEntityType::bParsedEntity
     Member 'bParsedEntity' it is STD_TRUE if the entity is parsed entity and STD_FALSE otherwise
-    @var strEntityType::u8EntityValue
-    Member 'u8EntityValue' it is an array contain the entity value
-    @var strEntityType::u8EntityName
-    Member 'u8EntityName' it is an array contain the entity name
-    @var strEntityType::u8EntityNameLength
-    Member 'u8EntityNameLength' it contains the length of the entity name string
-    @var strEntityType::u8EntityValueLength
-    Member 'u8EntityValueLength'it contains the length of the entity vlaue string
+    @var strEntityType::pu8EntityValue
+    Member 'pu8EntityValue' it points to the entity value in the entity arena
+    @var strEntityType::pu8EntityName
+    Member 'pu8EntityName' it points to the entity name in the entity arena
+    @var strEntityType::u32EntityNameLength
+    Member 'u32EntityNameLength' it contains the length of the entity name string
+    @var strEntityType::u32EntityValueLength
+    Member 'u32EntityValueLength'it contains the length of the entity vlaue string
+    @var strEntityType::u32EntityNameHash
+    Member 'u32EntityNameHash' it contains the hash of the entity name
     @var strEntityType::objenumReferenceTypeType
     Member 'objenumReferenceTypeType' it is an enum to indicate the entity type
     @var strEntityType::objenumEntityStoreTypeType
@@ -221,33 +242,41 @@ typedef enum
 typedef struct
 {
     BOOLEAN                        bParsedEntity;
-    INT8U                          u8EntityValue[MAX_ENTITY_VALUE_LENGTH];
-    INT8U                          u8EntityName[MAX_ENTITY_NAME_LENGTH];
-    INT8U                          u8EntityNameLength;
-    INT8U                          u8EntityValueLength;
+    INT8U                         *pu8EntityValue;
+    INT8U                         *pu8EntityName;
+    INT32U                         u32EntityNameLength;
+    INT32U                         u32EntityValueLength;
+    INT32U                         u32EntityNameHash;
     LwXMLP_enumReferenceTypeType   objenumReferenceTypeType;
     LwXMLP_enumEntityStoreTypeType objenumEntityStoreTypeType;
 }strEntityType;
 /*! \struct LwXML_strFoundReferenceType
     \brief it the structure which hold the found entity index and the corresponding type
-    @var LwXML_strFoundReferenceType::u8EntityIndex
-    Member 'u8EntityIndex' it hold the found entity index in the global array of data structure of entity list
+    @var LwXML_strFoundReferenceType::u16EntityIndex
+    Member 'u16EntityIndex' it hold the found entity index in the global array of data structure of entity list
     @var LwXML_strFoundReferenceType::objenumReferenceTypeType
     Member 'objenumReferenceTypeType' it hold the type of the found entity
 */
 typedef struct
 {
-    INT8U                        u8EntityIndex;
+    INT16U                       u16EntityIndex;
     LwXMLP_enumReferenceTypeType objenumReferenceTypeType;
 }LwXML_strFoundReferenceType;
 /*! \struct strAttributeListType
     \brief it the structure which hold the attributes name/behavior per element
     @var strAttributeListType::u8AttributeName
     Member 'u8AttributeName' array contain the name of the attribute
-    @var strAttributeListType::u8ElementName
-    Member 'u8ElementName' array contain the name of the element
     @var strAttributeListType::u8AttributeValue
-    Member 'u8AttributeValue' array contain the value of the attibute
+    Member 'u8AttributeValue' array contain the normalized default value of the attibute
+    @var strAttributeListType::u32AttributeNameHash
+    Member 'u32AttributeNameHash' the hash of the attribute name
+    @var strAttributeListType::u32AttributeNameLength
+    Member 'u32AttributeNameLength' the length of the attribute name
+    @var strAttributeListType::u32AttributeValueLength
+    Member 'u32AttributeValueLength' the length of the normalized default value of the attribute
+    @var strAttributeListType::s16NextAttribute
+    Member 's16NextAttribute' the index of the next attribute declaration of the same element, or -1 if it is the
+    last one
     @var strAttributeListType::objenumAttibuteTypeType
     Member 'objenumAttibuteTypeType' enum indicate the type of the attribute
     @var strAttributeListType::objenumAttributeBehaviourType
@@ -256,11 +285,90 @@ typedef struct
 typedef struct
 {
     INT8U                      u8AttributeName[MAX_ATTRIBUTES_NAME_LENGTH];
-    INT8U                      u8ElementName[MAX_ELEMENT_NAME_LENGTH];
     INT8U                      u8AttributeValue[MAX_ATTRIBUTES_VALUE_LENGTH];
+    INT32U                     u32AttributeNameHash;
+    INT32U                     u32AttributeNameLength;
+    INT32U                     u32AttributeValueLength;
+    INT16S                     s16NextAttribute;
     enumAttibuteTypeType       objenumAttibuteTypeType;
     enumDefaultDeclarationTypeType objenumAttributeBehaviourType;
 }strAttributeListType;
+/*! \struct strAttributeListElementType
+    \brief it the structure which indexes the attribute list declarations of one element
+    @var strAttributeListElementType::u8ElementName
+    Member 'u8ElementName' array contain the name of the element
+    @var strAttributeListElementType::u32ElementNameHash
+    Member 'u32ElementNameHash' the hash of the element name
+    @var strAttributeListElementType::s16FirstAttribute
+    Member 's16FirstAttribute' the index of the first attribute declaration of the element in objstrAttributeListType
+    @var strAttributeListElementType::s16LastAttribute
+    Member 's16LastAttribute' the index of the last attribute declaration of the element, the next declaration is
+    linked after it
+    @var strAttributeListElementType::u8DefaultAttributeCount
+    Member 'u8DefaultAttributeCount' the number of the attribute declarations of the element which have a default or
+    a fixed value, so the start TAG which has none of them isn't checked for the missing attributes
+*/
+typedef struct
+{
+    INT8U                      u8ElementName[MAX_ELEMENT_NAME_LENGTH + 1U];
+    INT32U                     u32ElementNameHash;
+    INT16S                     s16FirstAttribute;
+    INT16S                     s16LastAttribute;
+    INT8U                      u8DefaultAttributeCount;
+}strAttributeListElementType;
+#if(ENABLE_DTD_TABLES == STD_ON)
+/*! \struct strDTDTablesType
+    \brief it the structure which hold the entities and the attribute list declarations of a DTD, it is shared by the
+           instances and the DTD cache entries which refer to the same declarations, so it isn't modified while it is
+           shared and an instance takes its own copy before adding a declaration
+    @var strDTDTablesType::u16ReferenceCount
+    Member 'u16ReferenceCount' the number of the instances and the DTD cache entries which refer to the tables, the
+    tables are free when it is zero
+    @var strDTDTablesType::objstrEntityType
+    Member 'objstrEntityType' it is array of data structure which contain all the found entity references in DTD
+    @var strDTDTablesType::u16AvaliableEntities
+    Member 'u16AvaliableEntities' it contains the avaliable number of entities that found while parsing the DTD
+    @var strDTDTablesType::u8EntityArena
+    Member 'u8EntityArena' it is an array which the names and the values of the entities are packed in one after
+    another, so every entity takes only the length of its strings
+    @var strDTDTablesType::u32EntityArenaLength
+    Member 'u32EntityArenaLength' it contains the number of the used bytes of u8EntityArena
+    @var strDTDTablesType::s16EntityHashTable
+    Member 's16EntityHashTable' open addressing hash table of objstrEntityType which is keyed by the entity name,
+    every slot holds an entity index or -1 if it is empty
+    @var strDTDTablesType::objstrAttributeListType
+    Member 'objstrAttributeListType' it array of data structure contain the parsed attribute information gotten from
+    the DTD
+    @var strDTDTablesType::u8AvaliableAttibuteListCount
+    Member 'u8AvaliableAttibuteListCount' it reflect the available number of attribute gotten from the DTD
+    @var strDTDTablesType::objstrAttributeListElementType
+    Member 'objstrAttributeListElementType' array of the elements which have attribute list declarations, every
+    element links its own declarations in objstrAttributeListType
+    @var strDTDTablesType::u8AttributeListElementCount
+    Member 'u8AttributeListElementCount' the number of the used entries of objstrAttributeListElementType
+    @var strDTDTablesType::s16AttributeListHashTable
+    Member 's16AttributeListHashTable' open addressing hash table of objstrAttributeListElementType which is keyed by
+    the element name, every slot holds an element index or -1 if it is empty
+*/
+typedef struct
+{
+    INT16U                         u16ReferenceCount;
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+    strEntityType                  objstrEntityType[MAX_ENTITIES];
+    INT16U                         u16AvaliableEntities;
+    INT8U                          u8EntityArena[MAX_ENTITY_ARENA_SIZE];
+    INT32U                         u32EntityArenaLength;
+    INT16S                         s16EntityHashTable[ENTITY_HASH_TABLE_SIZE];
+#endif
+#if(ENABLE_DTD_WELL_FORM_CHECK == STD_ON)
+    strAttributeListType           objstrAttributeListType[MAX_ATTRIBUTES_LIST];
+    INT8U                          u8AvaliableAttibuteListCount;
+    strAttributeListElementType    objstrAttributeListElementType[MAX_ATTRIBUTES_LIST];
+    INT8U                          u8AttributeListElementCount;
+    INT16S                         s16AttributeListHashTable[ATTRIBUTE_LIST_HASH_TABLE_SIZE];
+#endif
+}strDTDTablesType;
+#endif
 /*! \struct strBOMDescriptorType
     \brief it the structure which hold the description of different encoding scheme
     @var strBOMDescriptorType::pu8EncodingBOM
@@ -277,6 +385,319 @@ typedef struct
           INT8U                        u8EncodingBOMLength;
           LwXMLP_enumEncodingTypeType  objenumEncodingTypeType;
 }strBOMDescriptorType;
+/*! \struct strDirectiveScannerType
+    \brief it the structure which hold the state of the directive scanner between the calls of the parser engine, so
+           every byte of a fragmented directive is copied and checked only once
+    @var strDirectiveScannerType::u32LoadedLength
+    Member 'u32LoadedLength' the number of directive bytes which are already copied into the working buffer
+    @var strDirectiveScannerType::u32ScanOffset
+    Member 'u32ScanOffset' the index of the next working buffer byte to be checked for the end of the directive
+    @var strDirectiveScannerType::u8LastQuotType
+    Member 'u8LastQuotType' the quotation character which opened the current literal
+    @var strDirectiveScannerType::bFoundQuot
+    Member 'bFoundQuot' it is STD_TRUE if the scanner is inside a literal
+    @var strDirectiveScannerType::bCommentInprogress
+    Member 'bCommentInprogress' it is STD_TRUE if the scanner is inside a comment
+    @var strDirectiveScannerType::objenumDirectiveTypeType
+    Member 'objenumDirectiveTypeType' the directive type which the saved state belongs to
+*/
+typedef struct
+{
+    INT32U                        u32LoadedLength;
+    INT32U                        u32ScanOffset;
+    INT8U                         u8LastQuotType;
+    BOOLEAN                       bFoundQuot;
+    BOOLEAN                       bCommentInprogress;
+    enumMarkupTypeType            objenumDirectiveTypeType;
+}strDirectiveScannerType;
+/*! \enum enumCheckTagStateType
+    \brief the states of the TAG tokenizer
+*/
+typedef enum
+{
+    csCheckTAGNameStart,                        /*!< Expecting the first character of the TAG name */
+    csCheckTAGName,                             /*!< Inside the TAG name */
+    csCheckAttributeNameStart,                  /*!< Expecting the first character of the attribute name */
+    csCheckAttributeName,                       /*!< Inside the attribute name */
+    csCheckEquality,                            /*!< Expecting = after the attribute name */
+    csCheckAttributeValueStartQuot,             /*!< Expecting the opening quote of the attribute value */
+    csCheckAttributeValueEndQuot                /*!< Inside the attribute value */
+}enumCheckTagStateType;
+/*! \struct strTagScannerType
+    \brief it the structure which hold the state of the TAG closer scanner between the calls of the parser engine, so
+           every byte of a fragmented TAG is copied and checked only once
+    @var strTagScannerType::pu8TagStart
+    Member 'pu8TagStart' the location of the '<' of the TAG which the saved state belongs to, STD_NULL if no state
+    is saved
+    @var strTagScannerType::u32ScanOffset
+    Member 'u32ScanOffset' the number of TAG bytes which are already copied into the working buffer and checked
+    @var strTagScannerType::u8QuotCharacter
+    Member 'u8QuotCharacter' the quotation character which opened the current attribute value
+    @var strTagScannerType::u8SecondCharacter
+    Member 'u8SecondCharacter' the second character of the TAG to detect the end TAG
+    @var strTagScannerType::u8LastCharacter
+    Member 'u8LastCharacter' the last checked character of the TAG to detect the empty TAG
+    @var strTagScannerType::bQuotIsFound
+    Member 'bQuotIsFound' it is STD_TRUE if the scanner is inside an attribute value
+    @var strTagScannerType::u32TokenOffset
+    Member 'u32TokenOffset' the index of the next working buffer character to be tokenized, 0 if the tokenizing isn't
+    started yet
+    @var strTagScannerType::objenumCheckTagStateType
+    Member 'objenumCheckTagStateType' the current state of the TAG tokenizer
+    @var strTagScannerType::objenumTagErrorType
+    Member 'objenumTagErrorType' the first error found by the TAG tokenizer, it is reported when the TAG is complete
+    @var strTagScannerType::u8AttributeEndCharacter
+    Member 'u8AttributeEndCharacter' the quotation character which shall close the current attribute value
+    @var strTagScannerType::bEnableWhiteSpaceChecking
+    Member 'bEnableWhiteSpaceChecking' it is STD_TRUE if a white space is mandatory before the next attribute
+    @var strTagScannerType::bEndTag
+    Member 'bEndTag' it is STD_TRUE if the TAG under tokenizing is an end TAG
+*/
+typedef struct
+{
+    INT8U                  const *pu8TagStart;
+    INT32U                        u32ScanOffset;
+    INT8U                         u8QuotCharacter;
+    INT8U                         u8SecondCharacter;
+    INT8U                         u8LastCharacter;
+    BOOLEAN                       bQuotIsFound;
+    INT32U                        u32TokenOffset;
+    enumCheckTagStateType         objenumCheckTagStateType;
+    LwXMLP_enumErrorType          objenumTagErrorType;
+    INT8U                         u8AttributeEndCharacter;
+    BOOLEAN                       bEnableWhiteSpaceChecking;
+    BOOLEAN                       bEndTag;
+}strTagScannerType;
+/*! \struct strElementEntryType
+    \brief it the structure which describe an open element in the element stack, the name itself is kept in the path
+           buffer
+    @var strElementEntryType::u32NameOffset
+    Member 'u32NameOffset' the offset of the element name in u8XMLPathBuffer
+    @var strElementEntryType::u32NameLength
+    Member 'u32NameLength' the length of the element name
+    @var strElementEntryType::u32NameHash
+    Member 'u32NameHash' the hash of the element name
+*/
+typedef struct
+{
+    INT32U                        u32NameOffset;
+    INT32U                        u32NameLength;
+    INT32U                        u32NameHash;
+}strElementEntryType;
+#if(ENABLE_NAME_INTERNING == STD_ON)
+/*! \struct strInternedNameType
+    \brief it the structure which describe a name which is given an ID by the upper layer
+    @var strInternedNameType::pu8Name
+    Member 'pu8Name' pointer to the name string of the upper layer, it isn't copied
+    @var strInternedNameType::u32NameHash
+    Member 'u32NameHash' the hash of the name
+    @var strInternedNameType::u32NameId
+    Member 'u32NameId' the ID which is returned for the name
+*/
+typedef struct
+{
+    INT8U                  const *pu8Name;
+    INT32U                        u32NameHash;
+    INT32U                        u32NameId;
+}strInternedNameType;
+#endif
+#if(ENABLE_FAST_TEXT_SCANNING == STD_ON)
+/*! \struct strTextLoaderType
+    \brief it the structure which hold the output side of the text loading, the text is copied, checked and its end of
+           lines are normalized in one forward pass over the linear segments of the circular buffer
+    @var strTextLoaderType::pu8Output
+    Member 'pu8Output' pointer to the start of the output buffer
+    @var strTextLoaderType::u32OutputLength
+    Member 'u32OutputLength' the number of bytes written to the output, it is the write cursor
+    @var strTextLoaderType::u32ValidationOffset
+    Member 'u32ValidationOffset' the output index of the first byte which needs the complete validation (non ASCII
+    character or closing bracket), it is valid only if TEXT_SCAN_VALIDATION_REQUIRED is set
+    @var strTextLoaderType::u8FoundFlags
+    Member 'u8FoundFlags' the TEXT_SCAN_XXX flags of the loaded text
+    @var strTextLoaderType::bCarriageReturnIsLast
+    Member 'bCarriageReturnIsLast' it is STD_TRUE if the last loaded byte is carriage return, so the line feed which
+    follows it in the next segment is dropped
+*/
+typedef struct
+{
+    INT8U                        *pu8Output;
+    INT32U                        u32OutputLength;
+    INT32U                        u32ValidationOffset;
+    INT8U                         u8FoundFlags;
+#if(ENABLE_EOL_NORMALIZATION == STD_ON)
+    BOOLEAN                       bCarriageReturnIsLast;
+#endif
+}strTextLoaderType;
+#endif
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+/*! \struct strReferenceExpansionType
+    \brief it the structure which hold the two sides of the reference expansion, the input is scanned once and the
+           output is written by a cursor which never goes back
+    @var strReferenceExpansionType::pu8Input
+    Member 'pu8Input' pointer to the string which its references are expanded
+    @var strReferenceExpansionType::pu8Output
+    Member 'pu8Output' pointer to the start of the output buffer, or STD_NULL if the expansion is only measured
+    @var strReferenceExpansionType::u32InputLength
+    Member 'u32InputLength' the number of the consumed bytes of the input including the terminator, if an error is
+    found it is the offset where the input is left unchanged
+    @var strReferenceExpansionType::u32OutputLength
+    Member 'u32OutputLength' the number of bytes written to the output, it is the write cursor
+    @var strReferenceExpansionType::u32LargestGrowth
+    Member 'u32LargestGrowth' the largest distance which the write cursor went ahead of the input cursor, it is the
+    distance which the input shall be moved by to be expanded in its own place
+    @var strReferenceExpansionType::u16ReplacedReferences
+    Member 'u16ReplacedReferences' the number of the references which are replaced by their values
+    @var strReferenceExpansionType::bMarkupIsFound
+    Member 'bMarkupIsFound' it is STD_TRUE if the expansion writes a less than character, i.e. the replacement text
+    contains markup
+    @var strReferenceExpansionType::pu32ProbedLength
+    Member 'pu32ProbedLength' the length which is probed by the expansion, or STD_NULL if the references are charged
+    to the budget of the instance
+*/
+typedef struct
+{
+    INT8U                  const *pu8Input;
+    INT8U                        *pu8Output;
+    INT32U                        u32InputLength;
+    INT32U                        u32OutputLength;
+    INT32U                        u32LargestGrowth;
+    INT16U                        u16ReplacedReferences;
+    BOOLEAN                       bMarkupIsFound;
+    INT32U                       *pu32ProbedLength;
+}strReferenceExpansionType;
+/*! \struct strInputSourceType
+    \brief it the structure which describe an entity value which is parsed in its place in the entity arena, it
+           holds the state of the including source to be resumed when the value is consumed
+    @var strInputSourceType::pu8ResumeLocation
+    Member 'pu8ResumeLocation' the parser location in the including source
+    @var strInputSourceType::pu8ResumeBufferEnd
+    Member 'pu8ResumeBufferEnd' the end of the including source, it is the end of the circular buffer for the document
+    @var strInputSourceType::u32ResumeFreeLocations
+    Member 'u32ResumeFreeLocations' the free locations of the circular buffer while the including source is parsed
+    @var strInputSourceType::u32ResumeParsedLength
+    Member 'u32ResumeParsedLength' the parsed length when the source is entered
+    @var strInputSourceType::u32ResumeLineNumber
+    Member 'u32ResumeLineNumber' the line number when the source is entered
+    @var strInputSourceType::u32ResumeCoulmnNumber
+    Member 'u32ResumeCoulmnNumber' the column number when the source is entered
+    @var strInputSourceType::u32ResumeReferenceLine
+    Member 'u32ResumeReferenceLine' the line of the last validated reference when the source is entered
+    @var strInputSourceType::u32ResumeReferenceColumn
+    Member 'u32ResumeReferenceColumn' the column of the last validated reference when the source is entered
+    @var strInputSourceType::u32BaseDepth
+    Member 'u32BaseDepth' the depth of the element stack when the source is entered, so the elements which are
+    opened inside the entity shall be closed inside it
+    @var strInputSourceType::s16EntityIndex
+    Member 's16EntityIndex' the entity which its value is parsed
+    @var strInputSourceType::bResumeSilentMode
+    Member 'bResumeSilentMode' the silent mode of the including source
+    @var strInputSourceType::bValueIsReplayed
+    Member 'bValueIsReplayed' it is STD_TRUE if the value is parsed again after it is validated silently, so its
+    references aren't charged again
+*/
+typedef struct
+{
+    INT8U                        *pu8ResumeLocation;
+    INT8U                        *pu8ResumeBufferEnd;
+    INT32U                        u32ResumeFreeLocations;
+    INT32U                        u32ResumeParsedLength;
+    INT32U                        u32ResumeLineNumber;
+    INT32U                        u32ResumeCoulmnNumber;
+    INT32U                        u32ResumeReferenceLine;
+    INT32U                        u32ResumeReferenceColumn;
+    INT32U                        u32BaseDepth;
+    INT16S                        s16EntityIndex;
+    BOOLEAN                       bResumeSilentMode;
+    BOOLEAN                       bValueIsReplayed;
+}strInputSourceType;
+#endif
+#if(ENABLE_DTD_CACHE == STD_ON)
+/*! \enum enumDTDCacheStateType
+    \brief the states of the instance while its internal DTD subset is looked up in the DTD cache
+*/
+typedef enum
+{
+    csDTDCacheIdle,                             /*!< The DTD cache isn't used for the current subset */
+    csDTDCacheScanning,                         /*!< The subset is scanned to find its end and compute its key */
+    csDTDCacheRecording                         /*!< The subset isn't cached, it is parsed and then stored */
+}enumDTDCacheStateType;
+/*! \enum enumDTDCacheEntryStateType
+    \brief the states of the entry of the DTD cache
+*/
+typedef enum
+{
+    csDTDCacheEntryFree,                        /*!< The entry doesn't hold a subset */
+    csDTDCacheEntryFilling,                     /*!< The subset of the entry is under parsing by an instance */
+    csDTDCacheEntryValid                        /*!< The entry holds the compiled tables of its subset */
+}enumDTDCacheEntryStateType;
+/*! \struct strCachedEntityType
+    \brief it the structure which hold an entity of a serialized DTD cache entry, the strings are located by their
+           offsets in the entity arena instead of pointers
+    @var strCachedEntityType::u32EntityNameOffset
+    Member 'u32EntityNameOffset' the offset of the entity name in the entity arena
+    @var strCachedEntityType::u32EntityValueOffset
+    Member 'u32EntityValueOffset' the offset of the entity value in the entity arena
+    @var strCachedEntityType::u32EntityNameLength
+    Member 'u32EntityNameLength' it contains the length of the entity name string
+    @var strCachedEntityType::u32EntityValueLength
+    Member 'u32EntityValueLength' it contains the length of the entity value string
+    @var strCachedEntityType::u32EntityNameHash
+    Member 'u32EntityNameHash' it contains the hash of the entity name
+    @var strCachedEntityType::objenumReferenceTypeType
+    Member 'objenumReferenceTypeType' it is an enum to indicate the entity type
+    @var strCachedEntityType::objenumEntityStoreTypeType
+    Member 'objenumEntityStoreTypeType' it is an enum contain the storage location of the entity internal/external
+    @var strCachedEntityType::bParsedEntity
+    Member 'bParsedEntity' it is STD_TRUE if the entity is parsed entity and STD_FALSE otherwise
+*/
+typedef struct
+{
+    INT32U                         u32EntityNameOffset;
+    INT32U                         u32EntityValueOffset;
+    INT32U                         u32EntityNameLength;
+    INT32U                         u32EntityValueLength;
+    INT32U                         u32EntityNameHash;
+    LwXMLP_enumReferenceTypeType   objenumReferenceTypeType;
+    LwXMLP_enumEntityStoreTypeType objenumEntityStoreTypeType;
+    BOOLEAN                        bParsedEntity;
+}strCachedEntityType;
+/*! \struct strDTDCacheEntryType
+    \brief it the structure which hold an internal DTD subset and the tables which are compiled from it
+    @var strDTDCacheEntryType::objenumDTDCacheEntryStateType
+    Member 'objenumDTDCacheEntryStateType' the state of the entry
+    @var strDTDCacheEntryType::u32SubsetHash
+    Member 'u32SubsetHash' the hash of the subset, it is the key of the entry
+    @var strDTDCacheEntryType::u32SubsetLength
+    Member 'u32SubsetLength' the length of the subset
+    @var strDTDCacheEntryType::u8Subset
+    Member 'u8Subset' the subset itself, it is compared with the subset of the document when the keys are matched
+    @var strDTDCacheEntryType::bFoundExternalEntity
+    Member 'bFoundExternalEntity' it is STD_TRUE if the subset refers to an external parameter entity
+    @var strDTDCacheEntryType::pstrDTDTablesType
+    Member 'pstrDTDTablesType' the tables which are compiled from the subset, the entry holds a reference to them
+*/
+typedef struct
+{
+    enumDTDCacheEntryStateType     objenumDTDCacheEntryStateType;
+    INT32U                         u32SubsetHash;
+    INT32U                         u32SubsetLength;
+    INT8U                          u8Subset[MAX_DTD_CACHE_SUBSET_LENGTH];
+    BOOLEAN                        bFoundExternalEntity;
+    strDTDTablesType              *pstrDTDTablesType;
+}strDTDCacheEntryType;
+/*! \struct strDTDCacheType
+    \brief it the structure which hold the compiled internal DTD subsets which are shared by all the instances
+    @var strDTDCacheType::objstrDTDCacheEntryType
+    Member 'objstrDTDCacheEntryType' the entries of the cache
+    @var strDTDCacheType::u8NextEntryIndex
+    Member 'u8NextEntryIndex' the entry which is replaced by the next subset which isn't found in the cache
+*/
+typedef struct
+{
+    strDTDCacheEntryType           objstrDTDCacheEntryType[MAX_DTD_CACHE_ENTRIES];
+    INT8U                          u8NextEntryIndex;
+}strDTDCacheType;
+#endif
 /*! \struct LwXMLP_strXMLParseInstanceType
     \brief the XML parser instance which shall be created/allocated when the parser is started and it will be used
            to post the XML document result
@@ -300,12 +721,29 @@ typedef struct
     Member 'pu8CircularBufferEnd' Pointer to the end of the circular buffer
     @var LwXMLP_strXMLParseInstanceType::pu8CircularBufferHead
     Member 'pu8CircularBufferEnd' Pointer to the start of the circular buffer
+    @var LwXMLP_strXMLParseInstanceType::pu8CircularBufferStart
+    Member 'pu8CircularBufferStart' Pointer to the first byte of the circular buffer, it is either u8XMLCircularBuffer
+    or the first of the two views of the memory file when ENABLE_VIRTUAL_RING_BUFFER is enabled
     @var LwXMLP_strXMLParseInstanceType::u8XMLPathBuffer
     Member 'pu8CircularBufferEnd' XML Path of the current element
     @var LwXMLP_strXMLParseInstanceType::pu8AttributeNameArray
     Member 'pu8AttributeNameArray' Array of pointer to the available attributes names string
     @var LwXMLP_strXMLParseInstanceType::pu8AttributeValueArray
     Member 'pu8AttributeValueArray' Array of pointer to the available attributes values string
+    @var LwXMLP_strXMLParseInstanceType::u32AttributeHashArray
+    Member 'u32AttributeHashArray' Array of the hash of the available attributes names
+    @var LwXMLP_strXMLParseInstanceType::u32AttributeNameLengthArray
+    Member 'u32AttributeNameLengthArray' Array of the length of the available attributes names
+    @var LwXMLP_strXMLParseInstanceType::u32AttributeValueLengthArray
+    Member 'u32AttributeValueLengthArray' Array of the length of the available attributes values, it follows the
+    value while it is normalized
+    @var LwXMLP_strXMLParseInstanceType::s16AttributeSlotArray
+    Member 's16AttributeSlotArray' Array of the slot of s16AttributeHashTable which is claimed by every available
+    attribute
+    @var LwXMLP_strXMLParseInstanceType::s16AttributeHashTable
+    Member 's16AttributeHashTable' open addressing hash table of the attributes names of the current TAG, every slot
+    holds an attribute index and it is used only if the slot is claimed back by this attribute in
+    s16AttributeSlotArray, so the table is never cleared between the TAGs
     @var LwXMLP_strXMLParseInstanceType::pu8ParsedDataBuffer
     Member 'pu8ParsedDataBuffer' pointer to the current parsed text data string
     @var LwXMLP_strXMLParseInstanceType::pu8ParsedPITarget
@@ -314,17 +752,51 @@ typedef struct
     Member 'pu8ParsedPIContent' pointer to the current parsed processing instruction Data string
     @var LwXMLP_strXMLParseInstanceType::pu8ParsedComments
     Member 'pu8ParsedComments' pointer to the current comment string
+    @var LwXMLP_strXMLParseInstanceType::u32ParsedDataLength
+    Member 'u32ParsedDataLength' the length of the current parsed text data string
+    @var LwXMLP_strXMLParseInstanceType::u32ParsedPITargetLength
+    Member 'u32ParsedPITargetLength' the length of the current parsed processing instruction target string
+    @var LwXMLP_strXMLParseInstanceType::u32ParsedPIContentLength
+    Member 'u32ParsedPIContentLength' the length of the current parsed processing instruction Data string
+    @var LwXMLP_strXMLParseInstanceType::u32ParsedCommentsLength
+    Member 'u32ParsedCommentsLength' the length of the current comment string
     @var LwXMLP_strXMLParseInstanceType::u8XMLCircularBuffer
     Member 'u8XMLCircularBuffer' array of bytes which contains an XML portion to be parsed by the LwXMLP
     @var LwXMLP_strXMLParseInstanceType::u8XMLworkingBuffer
     Member 'u8XMLworkingBuffer' array of bytes which contains an XML structure piece, such that the working buffer
     shall be greater than any XML structure like the XML text or XML TAG
+    @var LwXMLP_strXMLParseInstanceType::pu8TagBuffer
+    Member 'pu8TagBuffer' Pointer to the buffer which the current TAG is tokenized in, it is either the working buffer
+    or the location of the TAG in the circular buffer when ENABLE_IN_PLACE_TOKENIZATION is enabled
+    @var LwXMLP_strXMLParseInstanceType::u32TagCountedLength
+    Member 'u32TagCountedLength' the number of the TAG characters which are tokenized in their place and whose line
+    feeds are counted in u32TagLineNumber and u32TagCoulmnNumber
+    @var LwXMLP_strXMLParseInstanceType::u32TagLineNumber
+    Member 'u32TagLineNumber' the line number after the counted characters of the TAG which is tokenized in its place
+    @var LwXMLP_strXMLParseInstanceType::u32TagCoulmnNumber
+    Member 'u32TagCoulmnNumber' the coulmn number after the counted characters of the TAG which is tokenized in its
+    place
     @var LwXMLP_strXMLParseInstanceType::s16AttributeCounts
     Member 's16AttributeCounts' number of the current available attributes
     @var LwXMLP_strXMLParseInstanceType::u32FreeLocations
     Member 'u32FreeLocations' the number of free bytes in the circular buffer
     @var LwXMLP_strXMLParseInstanceType::u32PathLength
     Member 'u32PathLength' the number of bytes used by the current XML path
+    @var LwXMLP_strXMLParseInstanceType::objstrElementStack
+    Member 'objstrElementStack' the stack of the open elements, the top is matched against the end TAG
+    @var LwXMLP_strXMLParseInstanceType::u32ElementDepth
+    Member 'u32ElementDepth' the number of the open elements in objstrElementStack
+    @var LwXMLP_strXMLParseInstanceType::u32ElementNameHash
+    Member 'u32ElementNameHash' the hash of the current element name, it is computed while the TAG is tokenized
+    @var LwXMLP_strXMLParseInstanceType::u32ElementNameLength
+    Member 'u32ElementNameLength' the length of the current element name, it is computed while the TAG is tokenized
+    @var LwXMLP_strXMLParseInstanceType::objstrInternedNameArray
+    Member 'objstrInternedNameArray' the names which are given IDs by the upper layer
+    @var LwXMLP_strXMLParseInstanceType::u32InternedNameCount
+    Member 'u32InternedNameCount' the number of the used entries of objstrInternedNameArray
+    @var LwXMLP_strXMLParseInstanceType::s16NameIdHashTable
+    Member 's16NameIdHashTable' open addressing hash table of objstrInternedNameArray, every slot holds an index of the
+    array or -1 if it is empty
     @var LwXMLP_strXMLParseInstanceType::u32LineNumber
     Member 'u32LineNumber' the line number of the XML document under processing which will be used to get the error
     location if an error is encountered
@@ -362,32 +834,46 @@ typedef struct
     @var LwXMLP_strXMLParseInstanceType::u32NewLength
     Member 'u32NewLength' General variable will be used in a temp way instead of using auto variable which shall be
     passed to some function, because passing an auto variable to function will violate the MISRA rules
-    @var LwXMLP_strXMLParseInstanceType::u8SecondLevelPathBuffer
-    Member 'u8SecondLevelPathBuffer' it is expression to indicate the location of the nodes in an XML document when
-    event is fired during parsing XML portion inside the XML especially when the entity is XML element.
-    These path expressions look very much like the expressions you see when you work with a traditional computer
-    file system.
-    @var LwXMLP_strXMLParseInstanceType::u8SecondLevelBuffer
-    Member 'u8SecondLevelBuffer' it is an array contain part of XML file to be pasred in another domain rathar than the
-    main XML file
-    @var LwXMLP_strXMLParseInstanceType::u32SecondLevelPathLength
-    Member 'u32SecondLevelPathLength' it is present the string length of the second level path
+    @var LwXMLP_strXMLParseInstanceType::objstrInputSourceType
+    Member 'objstrInputSourceType' the stack of the entity values which are parsed in their place in the entity arena,
+    every entry holds the state of the source which includes the entity
+    @var LwXMLP_strXMLParseInstanceType::u8InputSourceDepth
+    Member 'u8InputSourceDepth' the number of the used entries of objstrInputSourceType, it is zero while the document
+    itself is parsed from the circular buffer
     @var LwXMLP_strXMLParseInstanceType::u32LastReferenceLine
-    Member 'u32LastReferenceLine' it holds the last xml file line which contain a reference
-    @var LwXMLP_strXMLParseInstanceType::objstrEntityType
-    Member 'objstrEntityType' it is array of data structure which contain all the found entity references in DTD
+    Member 'u32LastReferenceLine' it holds the line of the last text which its entity reference is validated
+    @var LwXMLP_strXMLParseInstanceType::u32LastReferenceColumn
+    Member 'u32LastReferenceColumn' it holds the column of the last text which its entity reference is validated
+    @var LwXMLP_strXMLParseInstanceType::u32ExpandedBytes
+    Member 'u32ExpandedBytes' it counts the bytes of the entity values which are scanned by the expansion of the
+    references or parsed as input sources, a value is counted every time it is scanned
+    @var LwXMLP_strXMLParseInstanceType::u32ExpandedReferences
+    Member 'u32ExpandedReferences' it counts the entity references which are charged to u32ExpandedBytes
+    @var LwXMLP_strXMLParseInstanceType::u32ReceivedBytes
+    Member 'u32ReceivedBytes' it counts the document bytes which are added to the circular buffer, it is the base of
+    the expansion ratio
+    @var LwXMLP_strXMLParseInstanceType::u32MaxExpandedBytes
+    Member 'u32MaxExpandedBytes' the budget of u32ExpandedBytes
+    @var LwXMLP_strXMLParseInstanceType::u32MaxExpansionRatio
+    Member 'u32MaxExpansionRatio' the maximum ratio between u32ExpandedBytes and u32ReceivedBytes, 0 disables it
+    @var LwXMLP_strXMLParseInstanceType::u8MaxExpansionDepth
+    Member 'u8MaxExpansionDepth' the maximum number of the nested entity values, it doesn't exceed
+    MAX_ENTITY_RESOLVING_DEPTH
     @var LwXMLP_strXMLParseInstanceType::objstrFoundReferenceType
     Member 'objstrFoundReferenceType' it is array of data structure which contain the found entity information which
     resolving the entity in the attribute value or in the text of the element
-    @var LwXMLP_strXMLParseInstanceType::u32SecondLevelReadyAmount
-    Member 'u32SecondLevelReadyAmount' it contains the length of XML portion which is available in the
-    u8SecondLevelPathBuffer
     @var LwXMLP_strXMLParseInstanceType::bParserSilentModeIsEnabled
     Member 'bParserSilentModeIsEnabled' it is STD_TRUE, it will force the parser to parse the XML without firing any
     events, just to valdiate the XML file for well-formedness
     @var LwXMLP_strXMLParseInstanceType::u8XMLEncodingBuffer
     Member 'u8XMLEncodingBuffer' it is buffer which contain the encoded XML portion in UTF-8, if the transcoding between
     the othe encoding like UTF16 to UTF8 is allowed by ENABLE_ENCODING
+    @var LwXMLP_strXMLParseInstanceType::u32StagedInputLength
+    Member 'u32StagedInputLength' the committed bytes at the start of u8XMLEncodingBuffer which wait to be transcoded
+    to the circular buffer, it is used by LwXMLP_pu8ReserveWrite and LwXMLP_vCommitWrite if the document isn't UTF-8
+    @var LwXMLP_strXMLParseInstanceType::u32ReservedLength
+    Member 'u32ReservedLength' the length of the region which is returned by the last LwXMLP_pu8ReserveWrite, the
+    committed length doesn't exceed it
     @var LwXMLP_strXMLParseInstanceType::bBOMIsChecked
     Member 'bBOMIsChecked' it is a flag to indicate if the BOM is check in the current XML is checked or not, if it was
     checked, it is value will be STD_TRUE
@@ -396,17 +882,24 @@ typedef struct
     reach, the value will be STD_TRUE
     @var LwXMLP_strXMLParseInstanceType::pu8ElementName
     Member 'pu8ElementName' it is a pointer to the current parsed element name
-    @var LwXMLP_strXMLParseInstanceType::u8AvaliableEntities
-    Member 'u8AvaliableEntities' it contains the avaliable number of entities that found while parsing the DTD
     @var LwXMLP_strXMLParseInstanceType::u32ParsedLength
     Member 'u32ParsedLength' it contains the length in bytes for parsed XML file
     @var LwXMLP_strXMLParseInstanceType::u32DirectiveLength
     Member 'u32DirectiveLength' it contains the string length of the current directive under parsing
-    @var LwXMLP_strXMLParseInstanceType::objstrAttributeListType
-    Member 'objstrAttributeListType' it array of data structure contain the parsed attribute information gotten from
-    the DTD
-    @var LwXMLP_strXMLParseInstanceType::u8AvaliableAttibuteListCount
-    Member 'u8AvaliableAttibuteListCount' it reflect the available number of attribute gotten from the DTD
+    @var LwXMLP_strXMLParseInstanceType::objstrDirectiveScannerType
+    Member 'objstrDirectiveScannerType' it holds the state of the directive under loading, to resume the loading from
+    the last checked byte when the rest of the directive is received
+    @var LwXMLP_strXMLParseInstanceType::objstrTagScannerType
+    Member 'objstrTagScannerType' it holds the state of the TAG under loading, to resume the loading from the last
+    checked byte when the rest of the TAG is received
+    @var LwXMLP_strXMLParseInstanceType::u32TagScannedBytes
+    Member 'u32TagScannedBytes' it counts the bytes checked by the TAG closer scanner, when it is compared with
+    u32TagLoadedBytes it gives the amount of the rescanning
+    @var LwXMLP_strXMLParseInstanceType::u32TagLoadedBytes
+    Member 'u32TagLoadedBytes' it counts the bytes of the completely loaded TAGs
+    @var LwXMLP_strXMLParseInstanceType::pstrDTDTablesType
+    Member 'pstrDTDTablesType' it points to the entities and the attribute list declarations of the DTD, they may be
+    shared with other instances and with the DTD cache
     @var LwXMLP_strXMLParseInstanceType::bFoundExternalEntity
     Member 'bFoundExternalEntity' if it was STD_TRUE, it means that the parser is detected the use of external entity
     in the DTD
@@ -417,42 +910,60 @@ typedef struct
     XML docuemnt
     @var LwXMLP_strXMLParseInstanceType::u8FoundReference
     Member 'u8FoundReference' It reflects the number of resolving level that made inside the attribute value/element text
-    @var LwXMLP_strXMLParseInstanceType::bSecondLevelBufferEnabled
-    Member 'bSecondLevelBufferEnabled' it reflect that second level buffer that used to parse the entity is in use
     @var LwXMLP_strXMLParseInstanceType::pu8ParsedNotaion
     Member 'pu8ParsedNotaion' it points to the buffer which hold the parsed notation
-    @var LwXMLP_strXMLParseInstanceType::pu8SavedLastParserLocation
-    Member 'pu8SavedLastParserLocation' it used to save the current location where parser will stop to jump to the next
-    level buffer, so when the second level parsing is complete, the parser will pop the save location
-    @var LwXMLP_strXMLParseInstanceType::pu8SavedCircularBufferEnd
-    Member 'pu8SavedCircularBufferEnd' it used to save the end of the main buffer to be retrieved when the parser go back
-    from the second level parsing
+    @var LwXMLP_strXMLParseInstanceType::objenumDTDCacheStateType
+    Member 'objenumDTDCacheStateType' the state of the lookup of the internal DTD subset in the DTD cache
+    @var LwXMLP_strXMLParseInstanceType::u32DTDCacheScanOffset
+    Member 'u32DTDCacheScanOffset' the number of the scanned bytes of the subset, to resume the scanning from the last
+    checked byte when the rest of the subset is received
+    @var LwXMLP_strXMLParseInstanceType::u32DTDCacheSubsetHash
+    Member 'u32DTDCacheSubsetHash' the hash of the scanned bytes of the subset
+    @var LwXMLP_strXMLParseInstanceType::u32DTDCacheMarkupOffset
+    Member 'u32DTDCacheMarkupOffset' the offset of the less than character of the markup declaration under scanning
+    @var LwXMLP_strXMLParseInstanceType::u8DTDCacheQuote
+    Member 'u8DTDCacheQuote' the quote of the literal under scanning inside the markup declaration, or zero
+    @var LwXMLP_strXMLParseInstanceType::bDTDCacheInsideMarkup
+    Member 'bDTDCacheInsideMarkup' it is STD_TRUE while a markup declaration of the subset is scanned
+    @var LwXMLP_strXMLParseInstanceType::u8DTDCacheEntryIndex
+    Member 'u8DTDCacheEntryIndex' the entry of the DTD cache which the subset is stored in after it is parsed
 */
 struct LwXMLP_strXMLParseInstanceType
 {
     /*
      * DTD fields
      */
-    strAttributeListType          objstrAttributeListType[MAX_ATTRIBUTES_LIST];
-    INT8U                         u8AvaliableAttibuteListCount;
+#if(ENABLE_DTD_TABLES == STD_ON)
+    strDTDTablesType             *pstrDTDTablesType;
+#endif
     BOOLEAN                       bFoundExternalEntity;
 #if(ENABLE_DTD_RECEIPTION == STD_ON)
     BOOLEAN                       bParsingDTDInProgress;
 #endif
     BOOLEAN                       bStandAloneDocument;
     INT8U                        *pu8ParsedNotaion;
+#if(ENABLE_DTD_CACHE == STD_ON)
+    enumDTDCacheStateType         objenumDTDCacheStateType;
+    INT32U                        u32DTDCacheScanOffset;
+    INT32U                        u32DTDCacheSubsetHash;
+    INT32U                        u32DTDCacheMarkupOffset;
+    INT8U                         u8DTDCacheQuote;
+    BOOLEAN                       bDTDCacheInsideMarkup;
+    INT8U                         u8DTDCacheEntryIndex;
+#endif
 #if(ENABLE_ENTITY_SUPPORT == STD_ON)
     INT8U                         u8FoundReference;
-    BOOLEAN                       bSecondLevelBufferEnabled;
-    INT8U                        *pu8SavedLastParserLocation;
-    INT8U                        *pu8SavedCircularBufferEnd;
-    INT8U                         u8SecondLevelBuffer[MAX_CIRCULAR_BUFFER_SIZE];
-    INT8U                         u8SecondLevelPathBuffer[MAX_XML_PATH_LENGTH];
-    INT32U                        u32SecondLevelPathLength;
+    strInputSourceType            objstrInputSourceType[MAX_ENTITY_RESOLVING_DEPTH];
+    INT8U                         u8InputSourceDepth;
     INT32U                        u32LastReferenceLine;
-    strEntityType                 objstrEntityType[MAX_ENTITIES];
+    INT32U                        u32LastReferenceColumn;
+    INT32U                        u32ExpandedBytes;
+    INT32U                        u32ExpandedReferences;
+    INT32U                        u32ReceivedBytes;
+    INT32U                        u32MaxExpandedBytes;
+    INT32U                        u32MaxExpansionRatio;
+    INT8U                         u8MaxExpansionDepth;
     LwXML_strFoundReferenceType   objstrFoundReferenceType[MAX_FOUND_REFERENCE];
-    INT32U                        u32SecondLevelReadyAmount;
     BOOLEAN                       bParserSilentModeIsEnabled;
 #endif
     /*
@@ -462,11 +973,16 @@ struct LwXMLP_strXMLParseInstanceType
     INT8U                        *pu8LastParserLocation;
     INT8U                        *pu8CircularBufferEnd;
     INT8U                        *pu8CircularBufferHead;
+    INT8U                        *pu8CircularBufferStart;
     INT32U                        u32FreeLocations;
+#if(ENABLE_VIRTUAL_RING_BUFFER == STD_OFF)
     INT8U                         u8XMLCircularBuffer[MAX_CIRCULAR_BUFFER_SIZE];
+#endif
 #if(ENABLE_ENCODING == STD_ON)
     INT8U                         u8XMLEncodingBuffer[MAX_CIRCULAR_BUFFER_SIZE];
+    INT32U                        u32StagedInputLength;
 #endif
+    INT32U                        u32ReservedLength;
     /*
      * XML Parsing result
      */
@@ -479,20 +995,49 @@ struct LwXMLP_strXMLParseInstanceType
     INT8U                         u8XMLPathBuffer[MAX_XML_PATH_LENGTH];
     INT8U                        *pu8AttributeNameArray[MAX_NUMBER_OF_ATTRIBUTES];
     INT8U                        *pu8AttributeValueArray[MAX_NUMBER_OF_ATTRIBUTES];
+    INT32U                        u32AttributeHashArray[MAX_NUMBER_OF_ATTRIBUTES];
+    INT32U                        u32AttributeNameLengthArray[MAX_NUMBER_OF_ATTRIBUTES];
+    INT32U                        u32AttributeValueLengthArray[MAX_NUMBER_OF_ATTRIBUTES];
+    INT16S                        s16AttributeSlotArray[MAX_NUMBER_OF_ATTRIBUTES];
+    INT16S                        s16AttributeHashTable[ATTRIBUTE_HASH_TABLE_SIZE];
     INT8U                        *pu8ElementName;
     INT8U                        *pu8ParsedDataBuffer;
     INT8U                        *pu8ParsedPITarget;
     INT8U                        *pu8ParsedPIContent;
     INT8U                        *pu8ParsedComments;
-    INT8U                         u8AvaliableEntities;
+    INT32U                        u32ParsedDataLength;
+    INT32U                        u32ParsedPITargetLength;
+    INT32U                        u32ParsedPIContentLength;
+    INT32U                        u32ParsedCommentsLength;
     INT8U                         u8XMLworkingBuffer[MAX_WORKING_BUFFER_SIZE];
+    INT8U                        *pu8TagBuffer;
+#if(ENABLE_IN_PLACE_TOKENIZATION == STD_ON)
+    INT32U                        u32TagCountedLength;
+    INT32U                        u32TagLineNumber;
+    INT32U                        u32TagCoulmnNumber;
+#endif
     INT16S                        s16AttributeCounts;
     INT32U                        u32PathLength;
+    strElementEntryType           objstrElementStack[MAX_ELEMENT_DEPTH];
+    INT32U                        u32ElementDepth;
+    INT32U                        u32ElementNameHash;
+    INT32U                        u32ElementNameLength;
+#if(ENABLE_NAME_INTERNING == STD_ON)
+    strInternedNameType           objstrInternedNameArray[MAX_INTERNED_NAMES];
+    INT32U                        u32InternedNameCount;
+    INT16S                        s16NameIdHashTable[NAME_ID_HASH_TABLE_SIZE];
+#endif
     INT32U                        u32ParsedLength;
     INT32U                        u32LineNumber;
     INT32U                        u32CoulmnNumber;
     INT32U                        u32CurrentTagLength;
     INT32U                        u32DirectiveLength;
+    strDirectiveScannerType       objstrDirectiveScannerType;
+    strTagScannerType             objstrTagScannerType;
+#if(ENABLE_PARSER_STATISTICS == STD_ON)
+    INT32U                        u32TagScannedBytes;
+    INT32U                        u32TagLoadedBytes;
+#endif
     enumTagTypeType               objenumTagTypeType;
     LwXLMP_psrFuncCallBackType    objpsrFuncCallBackType;
     LwXMLP_enumErrorType          objenumErrorType;
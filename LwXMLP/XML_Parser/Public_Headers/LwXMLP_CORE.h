@@ -76,6 +76,9 @@
 #define LwXMLP_MODULE_MINOR                0x00U            /*!< The LwXMLP module Minor version number*/
 #define LwXMLP_MODULE_CUSTOM               0x00U            /*!< The LwXMLP module Custom version number*/
 
+#define LwXMLP_UNKNOWN_NAME_ID             0xFFFFFFFFU      /*!< The ID of the names which aren't given an ID by
+                                                                 LwXMLP_srAddNameId */
+
 /*
 ********************************************************************************************************************
 ************************************************************************************************************************
@@ -164,19 +167,65 @@ INT8U                       *LwXMLP_pu8GetParsedText(LwXMLP_strXMLParseInstanceT
 INT8U                       *LwXMLP_pu8GetParsedNotation(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
 INT8U                       *LwXMLP_pu8GetElementName(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
 INT8U             const     *LwXMLP_pu8GetCurrentPath(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+INT32U                       LwXMLP_u32GetElementDepth(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
 INT8U                       *LwXMLP_pu8GetAttributeValue(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
                                                          INT16S                                s16AttributeIndex);
 INT8U                       *LwXMLP_pu8GetAttributeName(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
                                                         INT16S                                s16AttributeIndex);
+INT32U                       LwXMLP_u32GetAttributeNameHash(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                            INT16S                                s16AttributeIndex);
+INT32U                       LwXMLP_u32GetNameHash(INT8U const *pu8Name);
+LwXMLP_strXMLSpanType        LwXMLP_strGetParsedComment(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+LwXMLP_strXMLSpanType        LwXMLP_strGetParsedPIData(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+LwXMLP_strXMLSpanType        LwXMLP_strGetParsedPITarget(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+LwXMLP_strXMLSpanType        LwXMLP_strGetParsedText(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+LwXMLP_strXMLSpanType        LwXMLP_strGetElementName(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+LwXMLP_strXMLSpanType        LwXMLP_strGetCurrentPath(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+LwXMLP_strXMLSpanType        LwXMLP_strGetAttributeValue(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                         INT16S                                s16AttributeIndex);
+LwXMLP_strXMLSpanType        LwXMLP_strGetAttributeName(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                        INT16S                                s16AttributeIndex);
+#if(ENABLE_NAME_INTERNING == STD_ON)
+StdReturnType                LwXMLP_srAddNameId(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                const INT8U                          *pu8Name, \
+                                                      INT32U                          u32NameId);
+INT32U                       LwXMLP_u32GetElementId(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+INT32U                       LwXMLP_u32GetAttributeId(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType, \
+                                                      INT16S                                s16AttributeIndex);
+#endif
+#if(ENABLE_ENTITY_SUPPORT == STD_ON)
+StdReturnType                LwXMLP_srSetExpansionBudget(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                         INT32U                          u32MaxExpandedBytes, \
+                                                         INT32U                          u32MaxExpansionRatio, \
+                                                         INT8U                           u8MaxExpansionDepth);
+INT32U                       LwXMLP_u32GetExpandedBytes(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+INT32U                       LwXMLP_u32GetExpandedReferences(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+#endif
+#if(ENABLE_DTD_CACHE == STD_ON)
+INT32U                       LwXMLP_u32SerializeDTDCache(INT8U *pu8Buffer, INT32U u32BufferSize);
+StdReturnType                LwXMLP_srLoadDTDCache(INT8U const *pu8Buffer, INT32U u32BufferLength);
+#endif
 INT8S              const    *LwXMLP_ps8GetErrorString(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
 StdReturnType                LwXMLP_srCloseParser(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
 INT16S                       LwXMLP_s16GetAttributeCount(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
 INT32U                       LwXMLP_u32GetLineOfError(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
 INT32U                       LwXMLP_u32GetCoulmnOfError(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
 INT32U                       LwXMLP_u32GetFreeSpace(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+#if(ENABLE_PARSER_STATISTICS == STD_ON)
+INT32U                       LwXMLP_u32GetTagScannedBytes(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+INT32U                       LwXMLP_u32GetTagLoadedBytes(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
+#endif
 INT32U                       LwXMLP_u32AddXMLPortion(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType,\
                                                      const INT8U                          *pu8XMLPortionBuffer, \
                                                            INT32U                          u32RequiredAddPortionSize);
+INT8U                       *LwXMLP_pu8ReserveWrite(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                    INT32U                         *pu32ReservedLength);
+void                         LwXMLP_vCommitWrite(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                 INT32U                          u32WrittenLength);
+INT32U                       LwXMLP_u32AddXMLPortionV(      LwXMLP_strXMLParseInstanceType *pstrParserInstanceType, \
+                                                      const LwXMLP_strXMLSegmentType       *pstrXMLSegmentType, \
+                                                            INT32U                          u32SegmentCount, \
+                                                            INT32U                         *pu32AcceptedLength);
 LwXMLP_enumXMLEventTypes     LwXMLP_enumGetXMLEventType(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
 LwXMLP_enumParserStatusType  LwXMLP_enumXMLParserEngine(LwXMLP_strXMLParseInstanceType *pstrParserInstanceType);
 LwXMLP_enumErrorType         LwXMLP_enumGetError(LwXMLP_strXMLParseInstanceType const *pstrParserInstanceType);
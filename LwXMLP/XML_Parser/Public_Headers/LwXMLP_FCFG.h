@@ -113,8 +113,55 @@
     #define ENABLE_COMMENT_WELL_FORM_CHECK     STD_ON                 /*!< Enable/Disable well form for the COMMENT */
     #define ENABLE_DECL_WELL_FORM_CHECK        STD_ON                 /*!< Enable/Disable well form for the DECLARATION */
     #define ENABLE_CDATA_WELL_FORM_CHECK       STD_ON                 /*!< Enable/Disable well form for the CDATA */
-    #define MAX_ENTITY_VALUE_LENGTH            120U                   /*!< The maximum length of the entity value string,
-                                                                            it shouldn't exceed 255 */
+    #define ENABLE_FAST_TEXT_SCANNING          STD_ON                 /*!< Enable/Disable the word/vector based scanning
+                                                                           for the text content, it uses SSE2/AVX2 or NEON
+                                                                           when the compiler provides them otherwise a
+                                                                           portable 32-bit word scanning is used */
+    #define ENABLE_BUFFER_SCRUBBING            STD_OFF                /*!< Enable/Disable clearing the consumed characters
+                                                                           of the circular buffer and the whole working
+                                                                           buffer before loading the text, when it is
+                                                                           disabled only the handed out tokens are
+                                                                           terminated */
+    #define ENABLE_PARSER_STATISTICS           STD_ON                 /*!< Enable/Disable the counters of the scanned bytes
+                                                                           which can be read by the upper layer to measure
+                                                                           the scanning cost of the fragmented input */
+    #define ENABLE_NAME_INTERNING              STD_ON                 /*!< Enable/Disable the table of the element and
+                                                                           attribute names IDs which is seeded by the
+                                                                           upper layer, so the events can be dispatched
+                                                                           by an integer instead of a string */
+    #define ENABLE_VIRTUAL_RING_BUFFER         STD_OFF                /*!< Enable/Disable mapping the circular buffer twice
+                                                                           back to back by a memory file, so the ready
+                                                                           data is always contiguous and the scanners
+                                                                           don't wrap, MAX_CIRCULAR_BUFFER_SIZE shall be
+                                                                           a multiple of the page size, e.g. 8192U for
+                                                                           the 4 KB pages. It is left for the Linux hosts
+                                                                           to enable since it needs memfd_create() and
+                                                                           LwXMLP_srCloseParser to release the mapping */
+    #if(ENABLE_BUFFER_SCRUBBING == STD_OFF)
+        #define ENABLE_IN_PLACE_TOKENIZATION   STD_ON                 /*!< Enable/Disable tokenizing the TAGs in their place
+                                                                           in the circular buffer instead of copying them
+                                                                           to the working buffer, the TAGs which wrap the
+                                                                           circular buffer, come from an entity value or
+                                                                           carry a reference are still copied. When it is
+                                                                           enabled the element name and the attributes
+                                                                           of the reported TAG are in the circular buffer,
+                                                                           so the callback shall not call
+                                                                           LwXMLP_u32AddXMLPortion or the other input
+                                                                           APIs of the same instance */
+    #else
+        #define ENABLE_IN_PLACE_TOKENIZATION   STD_OFF                /*!< Must disable the in place tokenizing, the
+                                                                           scrubbing clears the TAG before its event */
+    #endif
+    #if((ENABLE_DTD_WELL_FORM_CHECK == STD_ON) && (ENABLE_ENTITY_SUPPORT == STD_ON))
+        #define ENABLE_DTD_CACHE               STD_ON                 /*!< Enable/Disable the cache of the compiled internal
+                                                                           DTD subsets, the documents which carry the same
+                                                                           subset take its entities and attribute lists
+                                                                           from the cache without parsing it */
+    #else
+        #define ENABLE_DTD_CACHE               STD_OFF                /*!< Must disable the DTD cache */
+    #endif
+    #define MAX_ENTITY_ARENA_SIZE              8192U                  /*!< The number of bytes which are shared by the names
+                                                                            and the values of all the entities */
     #define MAX_XML_PATH_LENGTH                500U                   /*!< The Maximum path length of the XML element */
     #define MAX_WORKING_BUFFER_SIZE            7000U                  /*!< Maximum number of characters in the working
                                                                            buffer */
@@ -127,20 +174,47 @@
     #define MAX_ATTRIBUTES_LIST                100U                    /*!< Maximum number of attribute list declaration */
     #define MAX_OPERATORS_COUNT                10U                    /*!< Maximum operator counts inside the element
                                                                            content (children)*/
-    #define MAX_ENTITY_NAME_LENGTH             30U                    /*!< The maximum length of the entity Name string
-                                                                            including the Ampersand and the Semicolon,
-                                                                            it shouldn't exceed 255*/
     #define MAX_ENTITIES                       102U                   /*!< The maximum number of entities, shouldn't
-                                                                           exceed 255*/
+                                                                           exceed 32767*/
     #define MAX_NUMBER_OF_ATTRIBUTES           40                     /*!< Maximum number of the supported attributes
                                                                            in the XML TAG*/
 
     #define MAX_ATTRIBUTES_NAME_LENGTH         30U                    /*!< Maximum number of characters per attribute
                                                                            name */
     #define MAX_ELEMENT_NAME_LENGTH            14U                    /*!< Maximum number of characters per element name */
+    #define MAX_INTERNED_NAMES                 32U                    /*!< Maximum number of the names which can be
+                                                                           given an ID by LwXMLP_srAddNameId */
     #define MAX_ATTRIBUTES_VALUE_LENGTH        100U                   /*!< Maximum number of characters per attribute
                                                                            value */
+    #define MAX_DTD_CACHE_ENTRIES              2U                     /*!< The number of the internal DTD subsets which
+                                                                           are kept by the DTD cache */
+    #define MAX_DTD_CACHE_SUBSET_LENGTH        2048U                  /*!< The maximum length of the internal DTD subset
+                                                                           which can be cached */
+    #if(ALLOCATION_TYPE == INTERNAL_STATIC_ALLOCATION)
+        #define MAX_CONCURRENT_XML_INSTANCES   TOTAL_STATIC_XML_INSTANCES /*!< All the static instances may be open at
+                                                                               the same time */
+    #else
+        #define MAX_CONCURRENT_XML_INSTANCES   8U                     /*!< The maximum number of the instances which are
+                                                                           open at the same time, it sizes the pool of
+                                                                           the DTD tables */
+    #endif
+    #if(ENABLE_DTD_CACHE == STD_ON)
+        #define MAX_DTD_TABLES                 (MAX_CONCURRENT_XML_INSTANCES + MAX_DTD_CACHE_ENTRIES) /*!< Every open
+                                                                           instance and every DTD cache entry may own
+                                                                           tables, so the pool doesn't run out */
+    #else
+        #define MAX_DTD_TABLES                 MAX_CONCURRENT_XML_INSTANCES /*!< Every open instance may own tables, so
+                                                                               the pool doesn't run out */
+    #endif
     #define MAX_ENTITY_RESOLVING_DEPTH         3U                     /*!< Maximum depth of resolving of the entity */
+    #define MAX_ENTITY_EXPANSION_BYTES         65536U                 /*!< The default budget of the entity value bytes
+                                                                           which can be scanned while the references of
+                                                                           one document are expanded */
+    #define MAX_ENTITY_EXPANSION_RATIO         16U                    /*!< The default maximum ratio between the expanded
+                                                                           bytes and the received document bytes, 0
+                                                                           disables the ratio check */
+    #define ENTITY_EXPANSION_RATIO_THRESHOLD   8192U                  /*!< The expanded bytes which are allowed before
+                                                                           the expansion ratio is checked */
     #define MAX_FOUND_REFERENCE                4U                     /*!< Maximum allowed found references during
                                                                            entity resolving */
 #elif(CONFIGURATION_TYPE == INTERMEDIATE_SIZE)
@@ -167,8 +241,55 @@
     #define ENABLE_COMMENT_WELL_FORM_CHECK     STD_OFF                /*!< Enable/Disable well form for the COMMENT */
     #define ENABLE_DECL_WELL_FORM_CHECK        STD_OFF                /*!< Enable/Disable well form for the DECLARATION */
     #define ENABLE_CDATA_WELL_FORM_CHECK       STD_OFF                /*!< Enable/Disable well form for the CDATA */
-    #define MAX_ENTITY_VALUE_LENGTH            120U                   /*!< The maximum length of the entity value string,
-                                                                            it shouldn't exceed 255 */
+    #define ENABLE_FAST_TEXT_SCANNING          STD_ON                 /*!< Enable/Disable the word/vector based scanning
+                                                                           for the text content, it uses SSE2/AVX2 or NEON
+                                                                           when the compiler provides them otherwise a
+                                                                           portable 32-bit word scanning is used */
+    #define ENABLE_BUFFER_SCRUBBING            STD_OFF                /*!< Enable/Disable clearing the consumed characters
+                                                                           of the circular buffer and the whole working
+                                                                           buffer before loading the text, when it is
+                                                                           disabled only the handed out tokens are
+                                                                           terminated */
+    #define ENABLE_PARSER_STATISTICS           STD_ON                 /*!< Enable/Disable the counters of the scanned bytes
+                                                                           which can be read by the upper layer to measure
+                                                                           the scanning cost of the fragmented input */
+    #define ENABLE_NAME_INTERNING              STD_ON                 /*!< Enable/Disable the table of the element and
+                                                                           attribute names IDs which is seeded by the
+                                                                           upper layer, so the events can be dispatched
+                                                                           by an integer instead of a string */
+    #define ENABLE_VIRTUAL_RING_BUFFER         STD_OFF                /*!< Enable/Disable mapping the circular buffer twice
+                                                                           back to back by a memory file, so the ready
+                                                                           data is always contiguous and the scanners
+                                                                           don't wrap, MAX_CIRCULAR_BUFFER_SIZE shall be
+                                                                           a multiple of the page size, e.g. 8192U for
+                                                                           the 4 KB pages. It is left for the Linux hosts
+                                                                           to enable since it needs memfd_create() and
+                                                                           LwXMLP_srCloseParser to release the mapping */
+    #if(ENABLE_BUFFER_SCRUBBING == STD_OFF)
+        #define ENABLE_IN_PLACE_TOKENIZATION   STD_OFF                /*!< Enable/Disable tokenizing the TAGs in their place
+                                                                           in the circular buffer instead of copying them
+                                                                           to the working buffer, the TAGs which wrap the
+                                                                           circular buffer, come from an entity value or
+                                                                           carry a reference are still copied. When it is
+                                                                           enabled the element name and the attributes
+                                                                           of the reported TAG are in the circular buffer,
+                                                                           so the callback shall not call
+                                                                           LwXMLP_u32AddXMLPortion or the other input
+                                                                           APIs of the same instance */
+    #else
+        #define ENABLE_IN_PLACE_TOKENIZATION   STD_OFF                /*!< Must disable the in place tokenizing, the
+                                                                           scrubbing clears the TAG before its event */
+    #endif
+    #if((ENABLE_DTD_WELL_FORM_CHECK == STD_ON) && (ENABLE_ENTITY_SUPPORT == STD_ON))
+        #define ENABLE_DTD_CACHE               STD_OFF                /*!< Enable/Disable the cache of the compiled internal
+                                                                           DTD subsets, the documents which carry the same
+                                                                           subset take its entities and attribute lists
+                                                                           from the cache without parsing it */
+    #else
+        #define ENABLE_DTD_CACHE               STD_OFF                /*!< Must disable the DTD cache */
+    #endif
+    #define MAX_ENTITY_ARENA_SIZE              2048U                  /*!< The number of bytes which are shared by the names
+                                                                            and the values of all the entities */
     #define MAX_XML_PATH_LENGTH                100U                   /*!< The Maximum path length of the XML element */
     #define MAX_WORKING_BUFFER_SIZE            100U                   /*!< Maximum number of characters in the working
                                                                            buffer */
@@ -180,20 +301,47 @@
     #define MAX_ATTRIBUTES_LIST                16U                    /*!< Maximum number of attribute list declaration */
     #define MAX_OPERATORS_COUNT                10U                    /*!< Maximum operator counts inside the element
                                                                            content (children)*/
-    #define MAX_ENTITY_NAME_LENGTH             30U                    /*!< The maximum length of the entity Name string
-                                                                            including the Ampersand and the Semicolon,
-                                                                            it shouldn't exceed 255*/
     #define MAX_ENTITIES                       102U                   /*!< The maximum number of entities, shouldn't
-                                                                           exceed 255*/
+                                                                           exceed 32767*/
     #define MAX_NUMBER_OF_ATTRIBUTES           8                      /*!< Maximum number of the supported attributes
                                                                            in the XML TAG*/
 
     #define MAX_ATTRIBUTES_NAME_LENGTH         30U                    /*!< Maximum number of characters per attribute
                                                                            name */
     #define MAX_ELEMENT_NAME_LENGTH            14U                    /*!< Maximum number of characters per element name */
+    #define MAX_INTERNED_NAMES                 16U                    /*!< Maximum number of the names which can be
+                                                                           given an ID by LwXMLP_srAddNameId */
     #define MAX_ATTRIBUTES_VALUE_LENGTH        100U                   /*!< Maximum number of characters per attribute
                                                                            value */
+    #define MAX_DTD_CACHE_ENTRIES              1U                     /*!< The number of the internal DTD subsets which
+                                                                           are kept by the DTD cache */
+    #define MAX_DTD_CACHE_SUBSET_LENGTH        512U                   /*!< The maximum length of the internal DTD subset
+                                                                           which can be cached */
+    #if(ALLOCATION_TYPE == INTERNAL_STATIC_ALLOCATION)
+        #define MAX_CONCURRENT_XML_INSTANCES   TOTAL_STATIC_XML_INSTANCES /*!< All the static instances may be open at
+                                                                               the same time */
+    #else
+        #define MAX_CONCURRENT_XML_INSTANCES   2U                     /*!< The maximum number of the instances which are
+                                                                           open at the same time, it sizes the pool of
+                                                                           the DTD tables */
+    #endif
+    #if(ENABLE_DTD_CACHE == STD_ON)
+        #define MAX_DTD_TABLES                 (MAX_CONCURRENT_XML_INSTANCES + MAX_DTD_CACHE_ENTRIES) /*!< Every open
+                                                                           instance and every DTD cache entry may own
+                                                                           tables, so the pool doesn't run out */
+    #else
+        #define MAX_DTD_TABLES                 MAX_CONCURRENT_XML_INSTANCES /*!< Every open instance may own tables, so
+                                                                               the pool doesn't run out */
+    #endif
     #define MAX_ENTITY_RESOLVING_DEPTH         3U                     /*!< Maximum depth of resolving of the entity */
+    #define MAX_ENTITY_EXPANSION_BYTES         65536U                 /*!< The default budget of the entity value bytes
+                                                                           which can be scanned while the references of
+                                                                           one document are expanded */
+    #define MAX_ENTITY_EXPANSION_RATIO         16U                    /*!< The default maximum ratio between the expanded
+                                                                           bytes and the received document bytes, 0
+                                                                           disables the ratio check */
+    #define ENTITY_EXPANSION_RATIO_THRESHOLD   8192U                  /*!< The expanded bytes which are allowed before
+                                                                           the expansion ratio is checked */
     #define MAX_FOUND_REFERENCE                4U                     /*!< Maximum allowed found references during
                                                                            entity resolving */
 #elif(CONFIGURATION_TYPE == MINIMUM_SIZE)
@@ -220,6 +368,53 @@
     #define ENABLE_COMMENT_WELL_FORM_CHECK     STD_OFF                /*!< Enable/Disable well form for the COMMENT */
     #define ENABLE_DECL_WELL_FORM_CHECK        STD_OFF                /*!< Enable/Disable well form for the DECLARATION */
     #define ENABLE_CDATA_WELL_FORM_CHECK       STD_OFF                /*!< Enable/Disable well form for the CDATA */
+    #define ENABLE_FAST_TEXT_SCANNING          STD_OFF                /*!< Enable/Disable the word/vector based scanning
+                                                                           for the text content, it uses SSE2/AVX2 or NEON
+                                                                           when the compiler provides them otherwise a
+                                                                           portable 32-bit word scanning is used */
+    #define ENABLE_BUFFER_SCRUBBING            STD_OFF                /*!< Enable/Disable clearing the consumed characters
+                                                                           of the circular buffer and the whole working
+                                                                           buffer before loading the text, when it is
+                                                                           disabled only the handed out tokens are
+                                                                           terminated */
+    #define ENABLE_PARSER_STATISTICS           STD_OFF                /*!< Enable/Disable the counters of the scanned bytes
+                                                                           which can be read by the upper layer to measure
+                                                                           the scanning cost of the fragmented input */
+    #define ENABLE_NAME_INTERNING              STD_OFF                /*!< Enable/Disable the table of the element and
+                                                                           attribute names IDs which is seeded by the
+                                                                           upper layer, so the events can be dispatched
+                                                                           by an integer instead of a string */
+    #define ENABLE_VIRTUAL_RING_BUFFER         STD_OFF                /*!< Enable/Disable mapping the circular buffer twice
+                                                                           back to back by a memory file, so the ready
+                                                                           data is always contiguous and the scanners
+                                                                           don't wrap, MAX_CIRCULAR_BUFFER_SIZE shall be
+                                                                           a multiple of the page size, e.g. 8192U for
+                                                                           the 4 KB pages. It is left for the Linux hosts
+                                                                           to enable since it needs memfd_create() and
+                                                                           LwXMLP_srCloseParser to release the mapping */
+    #if(ENABLE_BUFFER_SCRUBBING == STD_OFF)
+        #define ENABLE_IN_PLACE_TOKENIZATION   STD_OFF                /*!< Enable/Disable tokenizing the TAGs in their place
+                                                                           in the circular buffer instead of copying them
+                                                                           to the working buffer, the TAGs which wrap the
+                                                                           circular buffer, come from an entity value or
+                                                                           carry a reference are still copied. When it is
+                                                                           enabled the element name and the attributes
+                                                                           of the reported TAG are in the circular buffer,
+                                                                           so the callback shall not call
+                                                                           LwXMLP_u32AddXMLPortion or the other input
+                                                                           APIs of the same instance */
+    #else
+        #define ENABLE_IN_PLACE_TOKENIZATION   STD_OFF                /*!< Must disable the in place tokenizing, the
+                                                                           scrubbing clears the TAG before its event */
+    #endif
+    #if((ENABLE_DTD_WELL_FORM_CHECK == STD_ON) && (ENABLE_ENTITY_SUPPORT == STD_ON))
+        #define ENABLE_DTD_CACHE               STD_OFF                /*!< Enable/Disable the cache of the compiled internal
+                                                                           DTD subsets, the documents which carry the same
+                                                                           subset take its entities and attribute lists
+                                                                           from the cache without parsing it */
+    #else
+        #define ENABLE_DTD_CACHE               STD_OFF                /*!< Must disable the DTD cache */
+    #endif
     #define MAX_XML_PATH_LENGTH                100U                   /*!< The Maximum path length of the XML element */
     #define MAX_WORKING_BUFFER_SIZE            100U                   /*!< Maximum number of characters in the working
                                                                            buffer */
@@ -229,16 +424,13 @@
                                                                           which should be set by the user, and it shouldn't
                                                                           be larger than excpeted to avoid unwanted memory
                                                                           waste*/
-    #define MAX_ENTITY_VALUE_LENGTH            120U                   /*!< The maximum length of the entity value string,
-                                                                            it shouldn't exceed 255 */
+    #define MAX_ENTITY_ARENA_SIZE              2048U                  /*!< The number of bytes which are shared by the names
+                                                                            and the values of all the entities */
     #define MAX_ATTRIBUTES_LIST                16U                    /*!< Maximum number of attribute list declaration */
     #define MAX_OPERATORS_COUNT                10U                    /*!< Maximum operator counts inside the element
                                                                            content (children)*/
-    #define MAX_ENTITY_NAME_LENGTH             30U                    /*!< The maximum length of the entity Name string
-                                                                            including the Ampersand and the Semicolon,
-                                                                            it shouldn't exceed 255*/
     #define MAX_ENTITIES                       102U                   /*!< The maximum number of entities, shouldn't
-                                                                           exceed 255*/
+                                                                           exceed 32767*/
     #define MAX_NUMBER_OF_ATTRIBUTES           8                      /*!< Maximum number of the supported attributes
                                                                            in the XML TAG*/
 
@@ -247,7 +439,37 @@
     #define MAX_ATTRIBUTES_VALUE_LENGTH        100U                   /*!< Maximum number of characters per attribute
                                                                            value */
     #define MAX_ELEMENT_NAME_LENGTH            14U                    /*!< Maximum number of characters per element name */
+    #define MAX_INTERNED_NAMES                 8U                     /*!< Maximum number of the names which can be
+                                                                           given an ID by LwXMLP_srAddNameId */
+    #define MAX_DTD_CACHE_ENTRIES              1U                     /*!< The number of the internal DTD subsets which
+                                                                           are kept by the DTD cache */
+    #define MAX_DTD_CACHE_SUBSET_LENGTH        512U                   /*!< The maximum length of the internal DTD subset
+                                                                           which can be cached */
+    #if(ALLOCATION_TYPE == INTERNAL_STATIC_ALLOCATION)
+        #define MAX_CONCURRENT_XML_INSTANCES   TOTAL_STATIC_XML_INSTANCES /*!< All the static instances may be open at
+                                                                               the same time */
+    #else
+        #define MAX_CONCURRENT_XML_INSTANCES   2U                     /*!< The maximum number of the instances which are
+                                                                           open at the same time, it sizes the pool of
+                                                                           the DTD tables */
+    #endif
+    #if(ENABLE_DTD_CACHE == STD_ON)
+        #define MAX_DTD_TABLES                 (MAX_CONCURRENT_XML_INSTANCES + MAX_DTD_CACHE_ENTRIES) /*!< Every open
+                                                                           instance and every DTD cache entry may own
+                                                                           tables, so the pool doesn't run out */
+    #else
+        #define MAX_DTD_TABLES                 MAX_CONCURRENT_XML_INSTANCES /*!< Every open instance may own tables, so
+                                                                               the pool doesn't run out */
+    #endif
     #define MAX_ENTITY_RESOLVING_DEPTH         3U                     /*!< Maximum depth of resolving of the entity */
+    #define MAX_ENTITY_EXPANSION_BYTES         65536U                 /*!< The default budget of the entity value bytes
+                                                                           which can be scanned while the references of
+                                                                           one document are expanded */
+    #define MAX_ENTITY_EXPANSION_RATIO         16U                    /*!< The default maximum ratio between the expanded
+                                                                           bytes and the received document bytes, 0
+                                                                           disables the ratio check */
+    #define ENTITY_EXPANSION_RATIO_THRESHOLD   8192U                  /*!< The expanded bytes which are allowed before
+                                                                           the expansion ratio is checked */
     #define MAX_FOUND_REFERENCE                4U                     /*!< Maximum allowed found references during
                                                                            entity resolving */
 #endif
@@ -258,6 +480,16 @@
 ************************************************************************************************************************
 ********************************************************************************************************************
 */
+#if((ENABLE_VIRTUAL_RING_BUFFER == STD_ON) && ((MAX_CIRCULAR_BUFFER_SIZE % 4096U) != 0U))
+    #error "ENABLE_VIRTUAL_RING_BUFFER needs MAX_CIRCULAR_BUFFER_SIZE to be a multiple of the page size, e.g. 8192U"
+#endif
+#define LwXMLP_mEnterDTDCriticalSection()                             /*!< Lock the DTD tables pool and the DTD cache
+                                                                           which are shared by all the instances, it
+                                                                           shall be mapped to a mutex lock of the OS if
+                                                                           the instances run in different threads */
+#define LwXMLP_mExitDTDCriticalSection()                              /*!< Unlock the DTD tables pool and the DTD cache
+                                                                           which are locked by
+                                                                           LwXMLP_mEnterDTDCriticalSection */
 
 /*
 ********************************************************************************************************************
@@ -118,8 +118,8 @@ typedef enum
     csLargeResolvingTrialsProperty = 37,             /*!< More entities need to be resolved, increase MAX_ENTITY_RESOLVING_DEPTH */
      csLargeChildrenOperatorsProperty = 38,          /*!< Can't process all received attributes, increase MAX_OPERATORS_COUNT */
     csLargeEntityCountProperty = 39,                 /*!< Can't load entity, increase MAX_ENTITIES */
-    csLargeEntityNameProperty = 40,                  /*!< Can't load entity name, increase MAX_ENTITY_NAME_LENGTH */
-    csLargeEntityValueProperty = 41,                 /*!< Can't load entity name, increase MAX_ENTITY_VALUE_LENGTH */
+    csLargeEntityNameProperty = 40,                  /*!< Can't load entity name, increase MAX_ENTITY_ARENA_SIZE */
+    csLargeEntityValueProperty = 41,                 /*!< Can't load entity value, increase MAX_ENTITY_ARENA_SIZE */
     csDataWithoutStartTag = 42,                      /*!< Found data without being included in a start TAG */
     csInvalidReference = 43,                         /*!< Invalid Character Entity */
     csInvalidVersionOrder = 44,                      /*!< Invalid Version Attribute Order */
@@ -152,7 +152,12 @@ typedef enum
     csInvalidPassingParameter = 71,                  /*!< The parser received invalid parser instance */
     csEncodingDiscrepancy = 72,                      /*!< The parser detected Discrepancy between BOM and encoding type
                                                           in deceleration */
-    csMaximumXMLError = 73                           /*!< Maximum available number of errors */
+    csEntityExpansionBudgetExceeded = 73,            /*!< The expansion of the entities exceeded the budget of the
+                                                          instance, see LwXMLP_srSetExpansionBudget */
+    csDTDTablesExhausted = 74,                       /*!< There are no free DTD tables to hold the declarations of
+                                                          the document, more than MAX_CONCURRENT_XML_INSTANCES
+                                                          instances are open */
+    csMaximumXMLError = 75                           /*!< Maximum available number of errors */
 }LwXMLP_enumErrorType;
 /*! \enum LwXMLP_enumXMLEventTypes
     \brief The events that shall be fired up on detecting one of the XML document structure like start, end, text node,
@@ -180,6 +185,24 @@ typedef enum
     csParserError,                              /*!< Error is encountered during the parsing process*/
     csParsingFinished                           /*!< The parser detected the end of the XML document*/
 }LwXMLP_enumParserStatusType;
+/*! \struct LwXMLP_strXMLSegmentType
+    \brief one segment of a chained XML portion (e.g. a pbuf of a chain or an iovec entry) which is added by
+    LwXMLP_u32AddXMLPortionV
+*/
+typedef struct
+{
+    const INT8U                   *pu8Segment;            /*!< pointer to the bytes of the segment */
+          INT32U                   u32SegmentLength;      /*!< the number of the bytes of the segment */
+}LwXMLP_strXMLSegmentType;
+/*! \struct LwXMLP_strXMLSpanType
+    \brief a reported string which is given by its first byte and its length, so it can be used without searching
+    for its NULL terminator
+*/
+typedef struct
+{
+    const INT8U                   *pu8Span;               /*!< pointer to the first byte of the string */
+          INT32U                   u32SpanLength;         /*!< the number of the bytes of the string */
+}LwXMLP_strXMLSpanType;
 /*! brief LwXMLP_strXMLParseInstanceType
     the XML parser instance which shall be created/allocated when the parser is started and it will be used
            to post the XML document result